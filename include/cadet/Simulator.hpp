@@ -35,6 +35,13 @@ class ISolutionRecorder;
 class IParameterProvider;
 class INotificationCallback;
 
+/**
+ * @brief Opaque handle of a pre-resolved parameter
+ * @details Handles are obtained from ISimulator::resolveParameter() and remain valid for the
+ *          lifetime of the simulator. They are cheap to use for repeated parameter updates.
+ */
+typedef unsigned int ParameterHandle;
+
 enum class ConsistentInitialization : int
 {
 	/**
@@ -167,6 +174,60 @@ inline bool isValidConsistentInitialization(int ci) CADET_NOEXCEPT
 		&& (ci <= static_cast<typename std::underlying_type<ConsistentInitialization>::type>(ConsistentInitialization::NoneOnceThenLean));
 }
 
+/**
+ * @brief Time integration method
+ */
+enum class TimeIntegrator : int
+{
+	/**
+	 * @brief Variable order BDF method of IDAS (SUNDIALS)
+	 */
+	IDAS = 0,
+	/**
+	 * @brief Variable step size Radau IIA method of order 5
+	 */
+	RadauIIA = 1,
+};
+
+/**
+ * @brief Converts a TimeIntegrator to a string
+ * @param [in] ti TimeIntegrator to be converted
+ * @return String representation of the TimeIntegrator
+ */
+inline const char* to_string(TimeIntegrator ti) CADET_NOEXCEPT
+{
+	switch (ti)
+	{
+		case TimeIntegrator::IDAS:
+			return "IDAS";
+		case TimeIntegrator::RadauIIA:
+			return "RADAU_IIA";
+	}
+	return "Unknown";
+}
+
+/**
+ * @brief Converts a string to a TimeIntegrator
+ * @param [in] ti TimeIntegrator as string
+ * @param [out] result TimeIntegrator corresponding to the given string
+ * @return @c true if the string refers to a valid TimeIntegrator, otherwise @c false
+ */
+inline bool to_timeintegrator(const std::string& ti, TimeIntegrator& result) CADET_NOEXCEPT
+{
+	if (ti == "IDAS")
+	{
+		result = TimeIntegrator::IDAS;
+		return true;
+	}
+	else if (ti == "RADAU_IIA")
+	{
+		result = TimeIntegrator::RadauIIA;
+		return true;
+	}
+
+	return false;
+}
+
 /**
  * @brief Provides functionality to simulate a model using a time integrator
  */
@@ -258,6 +319,29 @@ public:
 	//! \param  [in]    value Value of the parameter
 	virtual void setParameterValue(const ParameterId& id, double value) = 0;
 
+	//! \brief Resolves a parameter for fast repeated updates
+	//! The storage locations of the parameter (including all multiplexed instances) are looked up once
+	//! and cached. Updating the parameter via the returned handle skips the lookup of the parameter in
+	//! the model hierarchy. If the parameter cannot be updated directly (e.g., because changing it
+	//! triggers an update of the discretization), the handle falls back to setParameterValue().
+	//! Cached storage locations are refreshed automatically after the model has been (re)configured.
+	//! \param  [in]    id Parameter ID of the parameter to be resolved
+	//! \return Handle of the parameter
+	virtual ParameterHandle resolveParameter(const ParameterId& id) = 0;
+
+	//! \brief Sets the value of a pre-resolved parameter
+	//! This function does not respect fused parameters and treats them as individuals.
+	//! \param  [in]    handle Handle of the parameter obtained from resolveParameter()
+	//! \param  [in]    value Value of the parameter
+	virtual void setParameterValue(ParameterHandle handle, double value) = 0;
+
+	//! \brief Sets the values of multiple pre-resolved parameters
+	//! This function does not respect fused parameters and treats them as individuals.
+	//! \param  [in]    handles Array with handles of the parameters obtained from resolveParameter()
+	//! \param  [in]    values Array with values of the parameters
+	//! \param  [in]    numParams Number of parameters
+	virtual void setParameterValues(ParameterHandle const* handles, double const* values, unsigned int numParams) = 0;
+
 	/**
 	 * @brief Checks whether a given parameter exists
 	 * @param [in] pId   pId   ParameterId that identifies the parameter uniquely
@@ -425,6 +509,16 @@ public:
 	 */
 	virtual void setConsistentInitializationSens(ConsistentInitialization ci) = 0;
 
+	/**
+	 * @brief Sets the time integration method
+	 * @details Sets the time integrator for the subsequent calls to integrate(). Defaults to IDAS.
+	 *          The Radau IIA integrator does not support forward sensitivities. If sensitivities
+	 *          are enabled, IDAS is used regardless of this setting.
+	 * 
+	 * @param [in] ti Time integration method
+	 */
+	virtual void setTimeIntegrator(TimeIntegrator ti) = 0;
+
 	/**
 	 * @brief Initializes the forward sensitivity subsystems with given initial values
 	 * @details The initial sensitivities are given by the argument @p initSens and their time derivatives
@@ -455,6 +549,26 @@ public:
 	 */
 	virtual void integrate() = 0;
 
+	/**
+	 * @brief Configures the search for a cyclic steady state
+	 * @details If enabled (@p maxCycles > 0), integrate() treats the full time span of all sections as
+	 *          one cycle and repeats it until the state at the beginning of a cycle matches the state at its
+	 *          end. The cycle map \f$ y_{\text{start}} \mapsto y_{\text{end}} \f$ is accelerated by Anderson mixing.
+	 *          Only the last cycle is reported to the solution recorder.
+	 * @param [in] maxCycles Maximum number of simulated cycles, @c 0 disables the cyclic steady state search
+	 * @param [in] tol Tolerance for the relative Euclidean norm of the cycle-to-cycle state change
+	 * @param [in] andersonDepth Number of previous cycles used for Anderson mixing, @c 0 disables acceleration
+	 */
+	virtual void configureCyclicSteadyState(unsigned int maxCycles, double tol, unsigned int andersonDepth) = 0;
+
+	/**
+	 * @brief Returns the cycle-to-cycle convergence norms of the last cyclic steady state search
+	 * @details The i-th element is the relative Euclidean norm of the state change over the i-th cycle.
+	 *          The vector is empty if the cyclic steady state search is disabled.
+	 * @return Vector with one convergence norm per simulated cycle
+	 */
+	virtual const std::vector<double>& getCyclicSteadyStateNorms() const = 0;
+
 
 	/**
 	 * @brief Returns the bare state vector for the last timepoint
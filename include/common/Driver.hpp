@@ -146,6 +146,56 @@ void configureSystemRecorder(cadet::InternalStorageSystemRecorder& recorder, Par
 		subRec->splitComponents(splitComponents);
 		subRec->splitPorts(splitPorts);
 		subRec->treatSingleAsMultiPortUnitOps(singleAsMultiPort);
+
+		// Storage format of the written fields
+		cadet::InternalStorageUnitOpRecorder::OutputFormat& fmt = subRec->outputFormat();
+		if (pp.exists("OUTPUT_SINGLE_PRECISION"))
+			fmt.singlePrecision = pp.getBool("OUTPUT_SINGLE_PRECISION");
+		if (pp.exists("OUTPUT_SHUFFLE"))
+			fmt.shuffle = pp.getBool("OUTPUT_SHUFFLE");
+		if (pp.exists("OUTPUT_COMPRESSION_LEVEL"))
+		{
+			const int level = pp.getInt("OUTPUT_COMPRESSION_LEVEL");
+			if ((level < 0) || (level > 9))
+				throw cadet::InvalidParameterException("Field OUTPUT_COMPRESSION_LEVEL has to be in [0, 9]");
+			fmt.compressionLevel = static_cast<unsigned int>(level);
+		}
+		if (pp.exists("OUTPUT_QUANTIZATION_TOL"))
+		{
+			fmt.quantizationTol = pp.getDouble("OUTPUT_QUANTIZATION_TOL");
+			if (fmt.quantizationTol < 0.0)
+				throw cadet::InvalidParameterException("Field OUTPUT_QUANTIZATION_TOL has to be non-negative");
+		}
+		if (pp.exists("OUTPUT_CHUNK_TIMESTEPS"))
+		{
+			const int chunk = pp.getInt("OUTPUT_CHUNK_TIMESTEPS");
+			if (chunk < 0)
+				throw cadet::InvalidParameterException("Field OUTPUT_CHUNK_TIMESTEPS has to be non-negative");
+			fmt.chunkTimesteps = static_cast<unsigned int>(chunk);
+		}
+
+		// Outlet moments, peaks, and fraction integrals computed on the fly
+		if (pp.exists("WRITE_OUTLET_ANALYTICS") && pp.getBool("WRITE_OUTLET_ANALYTICS"))
+		{
+			cadet::OutletAnalyticsUnitOpRecorder* const anaRec = new cadet::OutletAnalyticsUnitOpRecorder(i);
+			anaRec->treatSingleAsMultiPortUnitOps(singleAsMultiPort);
+
+			if (pp.exists("OUTLET_FRACTION_TIMES"))
+			{
+				const std::vector<double> fracTimes = pp.getDoubleArray("OUTLET_FRACTION_TIMES");
+				if (fracTimes.size() == 1)
+					throw cadet::InvalidParameterException("Field OUTLET_FRACTION_TIMES requires at least two elements");
+				for (std::size_t j = 1; j < fracTimes.size(); ++j)
+				{
+					if (fracTimes[j - 1] > fracTimes[j])
+						throw cadet::InvalidParameterException("Field OUTLET_FRACTION_TIMES has to be sorted in ascending order");
+				}
+
+				anaRec->fractionTimes(fracTimes);
+			}
+
+			recorder.addAnalyticsRecorder(anaRec);
+		}
 		pp.popScope();
 
 		recorder.addRecorder(subRec);
@@ -535,6 +585,10 @@ public:
 			writer.popGroup();
 		}
 
+		const std::vector<double>& cssNorms = _sim->getCyclicSteadyStateNorms();
+		if (!cssNorms.empty())
+			writer.vector("CYCLIC_STEADY_STATE_NORMS", cssNorms.size(), cssNorms.data());
+
 		if (_writeLastState)
 		{
 			unsigned int len = 0;
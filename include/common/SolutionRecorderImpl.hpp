@@ -53,12 +53,25 @@ public:
 		bool storeVolume;
 	};
 
+	/**
+	 * @brief Storage format of the written solution and sensitivity fields
+	 * @details Only affects the file representation, the recorded data is kept in double precision.
+	 */
+	struct OutputFormat
+	{
+		bool singlePrecision; //!< Store floating point fields as 32 bit floats
+		bool shuffle; //!< Apply byte shuffle filter before compression
+		unsigned int compressionLevel; //!< Deflate level (0 to 9)
+		double quantizationTol; //!< Absolute error bound of quantization, @c 0 disables quantization
+		unsigned int chunkTimesteps; //!< Number of time points per chunk, @c 0 uses the default chunk shape
+	};
+
 	InternalStorageUnitOpRecorder() : InternalStorageUnitOpRecorder(UnitOpIndep) { }
 
 	InternalStorageUnitOpRecorder(UnitOpIdx idx) : _cfgSolution({false, false, false, true, false, false, false}),
 		_cfgSolutionDot({false, false, false, false, false, false, false}), _cfgSensitivity({false, false, false, true, false, false, false}),
 		_cfgSensitivityDot({false, false, false, true, false, false, false}), _storeTime(false), _storeCoordinates(false), _splitComponents(true), _splitPorts(true),
-		_singleAsMultiPortUnitOps(false), _keepBulkSingletonDim(true), _keepParticleSingletonDim(true), _curCfg(nullptr), _nComp(0), _nVolumeDof(0), _nAxialCells(0), _nRadialCells(0),
+		_singleAsMultiPortUnitOps(false), _keepBulkSingletonDim(true), _keepParticleSingletonDim(true), _outFormat({false, false, 9, 0.0, 0}), _curCfg(nullptr), _nComp(0), _nVolumeDof(0), _nAxialCells(0), _nRadialCells(0),
 		_nInletPorts(0), _nOutletPorts(0), _numTimesteps(0), _numSens(0), _unitOp(idx), _needsReAlloc(false), _axialCoords(0), _radialCoords(0), _particleCoords(0)
 	{
 	}
@@ -433,6 +446,10 @@ public:
 	inline const StorageConfig& sensitivityDotConfig() const CADET_NOEXCEPT { return _cfgSensitivityDot; }
 	inline void sensitivityDotConfig(const StorageConfig& cfg) CADET_NOEXCEPT { _cfgSensitivityDot = cfg; }
 
+	inline OutputFormat& outputFormat() CADET_NOEXCEPT { return _outFormat; }
+	inline const OutputFormat& outputFormat() const CADET_NOEXCEPT { return _outFormat; }
+	inline void outputFormat(const OutputFormat& fmt) CADET_NOEXCEPT { _outFormat = fmt; }
+
 	inline bool storeTime() const CADET_NOEXCEPT { return _storeTime; }
 	inline void storeTime(bool st) CADET_NOEXCEPT { _storeTime = st; }
 
@@ -564,6 +581,25 @@ protected:
 
 	template <typename Writer_t>
 	void writeData(Writer_t& writer, const char* prefix, std::ostringstream& oss)
+	{
+		writer.singlePrecisionFields(_outFormat.singlePrecision);
+		writer.shuffleFields(_outFormat.shuffle);
+		writer.compressionLevel(_outFormat.compressionLevel);
+		writer.quantizeFields(_outFormat.quantizationTol);
+		writer.timeChunkSize(_outFormat.chunkTimesteps);
+
+		writeDataFields(writer, prefix, oss);
+
+		// Restore default format for fields written by other recorders
+		writer.singlePrecisionFields(false);
+		writer.shuffleFields(false);
+		writer.compressionLevel(9);
+		writer.quantizeFields(0.0);
+		writer.timeChunkSize(0);
+	}
+
+	template <typename Writer_t>
+	void writeDataFields(Writer_t& writer, const char* prefix, std::ostringstream& oss)
 	{
 		if (_curCfg->storeOutlet)
 		{
@@ -925,6 +961,7 @@ protected:
 	bool _singleAsMultiPortUnitOps;
 	bool _keepBulkSingletonDim;
 	bool _keepParticleSingletonDim;
+	OutputFormat _outFormat;
 
 	StorageConfig const* _curCfg;
 	Storage* _curStorage;
@@ -955,9 +992,393 @@ protected:
 };
 
 
+/**
+ * @brief Computes reductions of the outlet of a single unit operation on the fly
+ * @details Instead of storing the outlet trajectory, the following quantities are accumulated
+ *          for each outlet port and component while the solution is reported:
+ *          - zeroth moment (peak area) @f$ \mu_0 = \int c \, \mathrm{d}t @f$,
+ *          - first normalized moment (mean retention time) @f$ \mu_1 = \frac{1}{\mu_0} \int t c \, \mathrm{d}t @f$,
+ *          - second central moment (peak variance) @f$ \mu_2 = \frac{1}{\mu_0} \int (t - \mu_1)^2 c \, \mathrm{d}t @f$,
+ *          - peak height and peak time,
+ *          - integrals over user-defined time windows (fractions).
+ *          
+ *          Integrals are computed by the trapezoidal rule on the reported time points. Derivatives
+ *          of all quantities with respect to the sensitive parameters are obtained from the reported
+ *          forward sensitivities of the outlet. The sensitivity of the peak height is the outlet
+ *          sensitivity at the peak time.
+ */
+class OutletAnalyticsUnitOpRecorder : public ISolutionRecorder
+{
+public:
+
+	OutletAnalyticsUnitOpRecorder() : OutletAnalyticsUnitOpRecorder(UnitOpIndep) { }
+
+	OutletAnalyticsUnitOpRecorder(UnitOpIdx idx) : _unitOp(idx), _singleAsMultiPortUnitOps(false), _nComp(0), _nOutletPorts(0), _numSens(0),
+		_numTimesteps(0), _curTime(0.0), _lastTime(0.0), _curAcc(nullptr)
+	{
+	}
+
+	virtual ~OutletAnalyticsUnitOpRecorder() CADET_NOEXCEPT
+	{
+	}
+
+	virtual void clear()
+	{
+		_numTimesteps = 0;
+		_curTime = 0.0;
+		_lastTime = 0.0;
+
+		clear(_data);
+		for (Accumulator& acc : _sens)
+			clear(acc);
+
+		std::fill(_peakTime.begin(), _peakTime.end(), 0.0);
+		std::fill(_peakUpdated.begin(), _peakUpdated.end(), false);
+	}
+
+	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_numSens = numSens;
+		_sens.resize(numSens);
+	}
+
+	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_numSens = numSens;
+		_sens.resize(numSens);
+		allocateMemory();
+		clear();
+	}
+
+	virtual void unitOperationStructure(UnitOpIdx idx, const IModel& model, const ISolutionExporter& exporter)
+	{
+		// Only record one unit operation
+		if (idx != _unitOp)
+			return;
+
+		_nComp = exporter.numComponents();
+		_nOutletPorts = exporter.numOutletPorts();
+
+		allocateMemory();
+		clear();
+	}
+
+	virtual void beginTimestep(double t)
+	{
+		++_numTimesteps;
+		_lastTime = _curTime;
+		_curTime = t;
+	}
+
+	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
+	{
+		// Only record one unit operation
+		if ((idx != _unitOp) || !_curAcc || (_nOutletPorts == 0))
+			return;
+
+		exporter.writeOutlet(_buffer.data());
+
+		if (_curAcc == &_data)
+			updatePeaks();
+		else
+		{
+			// Record sensitivity at current peak time
+			for (std::size_t i = 0; i < _buffer.size(); ++i)
+			{
+				if (_peakUpdated[i])
+					_curAcc->peak[i] = _buffer[i];
+			}
+		}
+
+		accumulate(*_curAcc);
+	}
+
+	virtual void endUnitOperation() { }
+
+	virtual void endTimestep() { }
+
+	virtual void beginSolution()
+	{
+		_curAcc = &_data;
+	}
+
+	virtual void endSolution()
+	{
+		_curAcc = nullptr;
+	}
+
+	virtual void beginSolutionDerivative() { }
+
+	virtual void endSolutionDerivative() { }
+
+	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
+	{
+		_curAcc = &_sens[sensIdx];
+	}
+
+	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
+	{
+		endSolution();
+	}
+
+	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+
+	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+
+	template <typename Writer_t>
+	void writeSolution(Writer_t& writer)
+	{
+		const std::size_t nChannels = _buffer.size();
+		std::vector<double> mean(nChannels, 0.0);
+		std::vector<double> variance(nChannels, 0.0);
+		computeCentralMoments(_data, mean.data(), variance.data());
+
+		writeChannels(writer, "SOLUTION_OUTLET_MOMENT0", _data.moment0.data());
+		writeChannels(writer, "SOLUTION_OUTLET_MOMENT1", mean.data());
+		writeChannels(writer, "SOLUTION_OUTLET_MOMENT2", variance.data());
+		writeChannels(writer, "SOLUTION_OUTLET_PEAK_HEIGHT", _data.peak.data());
+		writeChannels(writer, "SOLUTION_OUTLET_PEAK_TIME", _peakTime.data());
+		writeFractions(writer, "SOLUTION_OUTLET_FRACTIONS", _data.fractions.data());
+	}
+
+	template <typename Writer_t>
+	void writeSensitivity(Writer_t& writer, unsigned int param)
+	{
+		const std::size_t nChannels = _buffer.size();
+		std::vector<double> mean(nChannels, 0.0);
+		std::vector<double> variance(nChannels, 0.0);
+		std::vector<double> sensMean(nChannels, 0.0);
+		std::vector<double> sensVariance(nChannels, 0.0);
+		computeCentralMoments(_data, mean.data(), variance.data());
+		computeCentralMomentSensitivities(_sens[param], mean.data(), sensMean.data(), sensVariance.data());
+
+		writeChannels(writer, "SENS_OUTLET_MOMENT0", _sens[param].moment0.data());
+		writeChannels(writer, "SENS_OUTLET_MOMENT1", sensMean.data());
+		writeChannels(writer, "SENS_OUTLET_MOMENT2", sensVariance.data());
+		writeChannels(writer, "SENS_OUTLET_PEAK_HEIGHT", _sens[param].peak.data());
+		writeFractions(writer, "SENS_OUTLET_FRACTIONS", _sens[param].fractions.data());
+	}
+
+	/**
+	 * @brief Computes mean retention time and peak variance from the accumulated moments
+	 * @param [out] mean Mean retention time (first normalized moment) of each outlet port and component
+	 * @param [out] variance Peak variance (second central moment) of each outlet port and component
+	 */
+	inline void centralMoments(double* mean, double* variance) const { computeCentralMoments(_data, mean, variance); }
+
+	inline const std::vector<double>& fractionTimes() const CADET_NOEXCEPT { return _fractionTimes; }
+	inline void fractionTimes(const std::vector<double>& ft)
+	{
+		_fractionTimes = ft;
+		allocateMemory();
+	}
+
+	inline bool treatSingleAsMultiPortUnitOps() const CADET_NOEXCEPT { return _singleAsMultiPortUnitOps; }
+	inline void treatSingleAsMultiPortUnitOps(bool smp) CADET_NOEXCEPT { _singleAsMultiPortUnitOps = smp; }
+
+	inline UnitOpIdx unitOperation() const CADET_NOEXCEPT { return _unitOp; }
+	inline void unitOperation(UnitOpIdx idx) CADET_NOEXCEPT { _unitOp = idx; }
+
+	inline unsigned int numDataPoints() const CADET_NOEXCEPT { return _numTimesteps; }
+	inline unsigned int numComponents() const CADET_NOEXCEPT { return _nComp; }
+	inline unsigned int numOutletPorts() const CADET_NOEXCEPT { return _nOutletPorts; }
+	inline unsigned int numFractions() const CADET_NOEXCEPT { return (_fractionTimes.size() > 1) ? _fractionTimes.size() - 1 : 0; }
+
+	inline double const* moment0() const CADET_NOEXCEPT { return _data.moment0.data(); }
+	inline double const* peakHeight() const CADET_NOEXCEPT { return _data.peak.data(); }
+	inline double const* peakTime() const CADET_NOEXCEPT { return _peakTime.data(); }
+	inline double const* fractions() const CADET_NOEXCEPT { return _data.fractions.data(); }
+	inline double const* sensMoment0(unsigned int idx) const CADET_NOEXCEPT { return _sens[idx].moment0.data(); }
+	inline double const* sensPeakHeight(unsigned int idx) const CADET_NOEXCEPT { return _sens[idx].peak.data(); }
+	inline double const* sensFractions(unsigned int idx) const CADET_NOEXCEPT { return _sens[idx].fractions.data(); }
+
+protected:
+
+	struct Accumulator
+	{
+		std::vector<double> last; //!< Outlet at the previous time point
+		std::vector<double> moment0; //!< Integral of c
+		std::vector<double> moment1; //!< Integral of t * c
+		std::vector<double> moment2; //!< Integral of t^2 * c
+		std::vector<double> peak; //!< Peak height (solution) or outlet sensitivity at peak time (sensitivities)
+		std::vector<double> fractions; //!< Integrals of c over fraction time windows (fraction-major)
+	};
+
+	inline void allocateMemory()
+	{
+		const std::size_t nChannels = _nComp * _nOutletPorts;
+		_buffer.resize(nChannels, 0.0);
+		_peakTime.resize(nChannels, 0.0);
+		_peakUpdated.resize(nChannels, false);
+
+		allocateMemory(_data, nChannels);
+		for (Accumulator& acc : _sens)
+			allocateMemory(acc, nChannels);
+	}
+
+	inline void allocateMemory(Accumulator& acc, std::size_t nChannels)
+	{
+		acc.last.resize(nChannels, 0.0);
+		acc.moment0.resize(nChannels, 0.0);
+		acc.moment1.resize(nChannels, 0.0);
+		acc.moment2.resize(nChannels, 0.0);
+		acc.peak.resize(nChannels, 0.0);
+		acc.fractions.resize(numFractions() * nChannels, 0.0);
+	}
+
+	inline void clear(Accumulator& acc)
+	{
+		std::fill(acc.last.begin(), acc.last.end(), 0.0);
+		std::fill(acc.moment0.begin(), acc.moment0.end(), 0.0);
+		std::fill(acc.moment1.begin(), acc.moment1.end(), 0.0);
+		std::fill(acc.moment2.begin(), acc.moment2.end(), 0.0);
+		std::fill(acc.peak.begin(), acc.peak.end(), 0.0);
+		std::fill(acc.fractions.begin(), acc.fractions.end(), 0.0);
+	}
+
+	inline void updatePeaks()
+	{
+		for (std::size_t i = 0; i < _buffer.size(); ++i)
+		{
+			_peakUpdated[i] = (_numTimesteps == 1) || (_buffer[i] > _data.peak[i]);
+			if (_peakUpdated[i])
+			{
+				_data.peak[i] = _buffer[i];
+				_peakTime[i] = _curTime;
+			}
+		}
+	}
+
+	inline void accumulate(Accumulator& acc)
+	{
+		const std::size_t nChannels = _buffer.size();
+
+		// Trapezoidal rule on the interval from the previous to the current time point
+		if (_numTimesteps > 1)
+		{
+			const double t0 = _lastTime;
+			const double t1 = _curTime;
+			const double dt = t1 - t0;
+
+			for (std::size_t i = 0; i < nChannels; ++i)
+			{
+				const double c0 = acc.last[i];
+				const double c1 = _buffer[i];
+
+				acc.moment0[i] += 0.5 * dt * (c0 + c1);
+				acc.moment1[i] += 0.5 * dt * (t0 * c0 + t1 * c1);
+				acc.moment2[i] += 0.5 * dt * (t0 * t0 * c0 + t1 * t1 * c1);
+			}
+
+			// Integrate linear interpolant over the part of the interval covered by each fraction
+			for (std::size_t f = 0; f < numFractions(); ++f)
+			{
+				const double a = std::max(t0, _fractionTimes[f]);
+				const double b = std::min(t1, _fractionTimes[f + 1]);
+				if ((b <= a) || (dt <= 0.0))
+					continue;
+
+				const double wA = (a - t0) / dt;
+				const double wB = (b - t0) / dt;
+				double* const frac = acc.fractions.data() + f * nChannels;
+				for (std::size_t i = 0; i < nChannels; ++i)
+				{
+					const double ca = acc.last[i] + wA * (_buffer[i] - acc.last[i]);
+					const double cb = acc.last[i] + wB * (_buffer[i] - acc.last[i]);
+					frac[i] += 0.5 * (b - a) * (ca + cb);
+				}
+			}
+		}
+
+		std::copy(_buffer.begin(), _buffer.end(), acc.last.begin());
+	}
+
+	inline void computeCentralMoments(const Accumulator& acc, double* mean, double* variance) const
+	{
+		for (std::size_t i = 0; i < _buffer.size(); ++i)
+		{
+			if (acc.moment0[i] == 0.0)
+			{
+				mean[i] = 0.0;
+				variance[i] = 0.0;
+				continue;
+			}
+
+			mean[i] = acc.moment1[i] / acc.moment0[i];
+			variance[i] = acc.moment2[i] / acc.moment0[i] - mean[i] * mean[i];
+		}
+	}
+
+	inline void computeCentralMomentSensitivities(const Accumulator& sens, double const* mean, double* sensMean, double* sensVariance) const
+	{
+		for (std::size_t i = 0; i < _buffer.size(); ++i)
+		{
+			const double m0 = _data.moment0[i];
+			if (m0 == 0.0)
+			{
+				sensMean[i] = 0.0;
+				sensVariance[i] = 0.0;
+				continue;
+			}
+
+			// Quotient rule applied to mean = m1 / m0 and variance = m2 / m0 - mean^2
+			sensMean[i] = (sens.moment1[i] - mean[i] * sens.moment0[i]) / m0;
+			sensVariance[i] = (sens.moment2[i] - _data.moment2[i] / m0 * sens.moment0[i]) / m0 - 2.0 * mean[i] * sensMean[i];
+		}
+	}
+
+	template <typename Writer_t>
+	void writeChannels(Writer_t& writer, const char* name, double const* data)
+	{
+		if (_nOutletPorts == 0)
+			return;
+
+		if ((_nOutletPorts == 1) && !_singleAsMultiPortUnitOps)
+			writer.template vector<double>(name, _nComp, data);
+		else
+			writer.template matrix<double>(name, _nOutletPorts, _nComp, data);
+	}
+
+	template <typename Writer_t>
+	void writeFractions(Writer_t& writer, const char* name, double const* data)
+	{
+		if ((_nOutletPorts == 0) || (numFractions() == 0))
+			return;
+
+		if ((_nOutletPorts == 1) && !_singleAsMultiPortUnitOps)
+			writer.template matrix<double>(name, numFractions(), _nComp, data);
+		else
+		{
+			const std::vector<std::size_t> layout = {numFractions(), _nOutletPorts, _nComp};
+			writer.template tensor<double>(name, layout.size(), layout.data(), data);
+		}
+	}
+
+	UnitOpIdx _unitOp;
+	bool _singleAsMultiPortUnitOps;
+	std::vector<double> _fractionTimes;
+
+	unsigned int _nComp;
+	unsigned int _nOutletPorts;
+	unsigned int _numSens;
+	unsigned int _numTimesteps;
+
+	double _curTime;
+	double _lastTime;
+	std::vector<double> _buffer;
+	std::vector<double> _peakTime;
+	std::vector<bool> _peakUpdated;
+
+	Accumulator* _curAcc;
+	Accumulator _data;
+	std::vector<Accumulator> _sens;
+};
+
+
 /**
  * @brief Stores pieces of the solution of the whole model system in recorders of single unit operations
  * @details Maintains a collection of InternalStorageUnitOpRecorder objects that store individual unit operations.
+ *          Optionally, OutletAnalyticsUnitOpRecorder objects compute reductions of unit operation outlets.
  *          The individual unit operation recorders are owned by this object and destroyed upon its own
  *          destruction.
  */
@@ -980,6 +1401,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->clear();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->clear();
 	}
 
 	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
@@ -992,6 +1416,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->prepare(numDofs, numSens, numTimesteps);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->prepare(numDofs, numSens, numTimesteps);
 	}
 
 	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
@@ -1006,6 +1433,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->notifyIntegrationStart(numDofs, numSens, numTimesteps);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->notifyIntegrationStart(numDofs, numSens, numTimesteps);
 	}
 
 	virtual void unitOperationStructure(UnitOpIdx idx, const IModel& model, const ISolutionExporter& exporter)
@@ -1013,6 +1443,9 @@ public:
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->unitOperationStructure(idx, model, exporter);
 
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->unitOperationStructure(idx, model, exporter);
+
 		// Reset for counting actual number of time steps
 		_numTimesteps = 0;
 	}
@@ -1025,72 +1458,108 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginTimestep(t);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginTimestep(t);
 	}
 
 	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginUnitOperation(idx, model, exporter);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginUnitOperation(idx, model, exporter);
 	}
 
 	virtual void endUnitOperation()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endUnitOperation();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endUnitOperation();
 	}
 
 	virtual void endTimestep()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endTimestep();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endTimestep();
 	}
 
 	virtual void beginSolution()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSolution();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginSolution();
 	}
 
 	virtual void endSolution()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSolution();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endSolution();
 	}
 
 	virtual void beginSolutionDerivative()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSolutionDerivative();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginSolutionDerivative();
 	}
 
 	virtual void endSolutionDerivative()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSolutionDerivative();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endSolutionDerivative();
 	}
 
 	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSensitivity(pId, sensIdx);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginSensitivity(pId, sensIdx);
 	}
 
 	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSensitivity(pId, sensIdx);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endSensitivity(pId, sensIdx);
 	}
 
 	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSensitivityDerivative(pId, sensIdx);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->beginSensitivityDerivative(pId, sensIdx);
 	}
 
 	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSensitivityDerivative(pId, sensIdx);
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			rec->endSensitivityDerivative(pId, sensIdx);
 	}
 
 	template <typename Writer_t>
@@ -1127,6 +1596,8 @@ public:
 
 			writer.pushGroup(oss.str());
 			rec->writeSolution(writer);
+			if (OutletAnalyticsUnitOpRecorder* const ana = analytics(rec->unitOperation()))
+				ana->writeSolution(writer);
 			writer.popGroup();
 		}
 	}
@@ -1149,6 +1620,8 @@ public:
 
 				writer.pushGroup(oss.str());
 				rec->writeSensitivity(writer, param);
+				if (OutletAnalyticsUnitOpRecorder* const ana = analytics(rec->unitOperation()))
+					ana->writeSensitivity(writer, param);
 				writer.popGroup();
 			}
 
@@ -1200,11 +1673,32 @@ public:
 		return nullptr;
 	}
 
+	inline void addAnalyticsRecorder(OutletAnalyticsUnitOpRecorder* rec)
+	{
+		_analytics.push_back(rec);
+	}
+
+	inline unsigned int numAnalyticsRecorders() const CADET_NOEXCEPT { return _analytics.size(); }
+
+	inline OutletAnalyticsUnitOpRecorder* analytics(UnitOpIdx idx) const CADET_NOEXCEPT
+	{
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+		{
+			if (rec->unitOperation() == idx)
+				return rec;
+		}
+		return nullptr;
+	}
+
 	inline void deleteRecorders()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			delete rec;
 		_recorders.clear();
+
+		for (OutletAnalyticsUnitOpRecorder* rec : _analytics)
+			delete rec;
+		_analytics.clear();
 	}
 
 	inline double const* time() const CADET_NOEXCEPT { return _time.data(); }
@@ -1212,6 +1706,7 @@ public:
 protected:
 
 	std::vector<InternalStorageUnitOpRecorder*> _recorders;
+	std::vector<OutletAnalyticsUnitOpRecorder*> _analytics;
 	unsigned int _numTimesteps;
 	unsigned int _numSens;
 	std::vector<double> _time;
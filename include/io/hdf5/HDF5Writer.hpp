@@ -16,6 +16,8 @@
 #include <vector>
 #include <string>
 #include <cstring>
+#include <cmath>
+#include <algorithm>
 
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
@@ -85,6 +87,27 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) {_writeExtendible = setExtendible;}
 
+	/// \brief Sets the deflate level (0 to 9) used when compression is enabled
+	inline void compressionLevel(unsigned int level) {_compressionLevel = std::min(level, 9u);}
+
+	/// \brief Enable/disable the byte shuffle filter that is applied before deflate compression
+	inline void shuffleFields(bool setShuffle) {_writeShuffled = setShuffle;}
+
+	/// \brief Enable/disable storing floating point tensors in single precision (32 bit) in the file
+	inline void singlePrecisionFields(bool setSinglePrecision) {_writeSinglePrecision = setSinglePrecision;}
+
+	/// \brief Sets the absolute error bound of the quantization of floating point tensors
+	/// \details Values are rounded to the nearest multiple of twice the error bound before they
+	///          are written, which leaves trailing mantissa bits zero and improves compression.
+	///          A bound of @c 0 disables quantization.
+	inline void quantizeFields(double absTol) {_quantizationTol = std::max(absTol, 0.0);}
+
+	/// \brief Sets the number of entries of the first (time) dimension per chunk
+	/// \details Chunks span the full extent of all other dimensions, so that reading a block of
+	///          consecutive time points touches as few chunks as possible. A value of @c 0 restores
+	///          the default chunk shape.
+	inline void timeChunkSize(std::size_t numTimesteps) {_timeChunkSize = numTimesteps;}
+
 private:
 
 	void writeWork(const std::string& dataSetName, hid_t memType, hid_t fileType, const std::size_t rank, const std::size_t* dims, const void* buffer, const std::size_t stride, const std::size_t blockSize);
@@ -92,6 +115,11 @@ private:
 	bool                    _writeScalar;
 	bool                    _writeExtendible;
 	bool                    _writeCompressed;
+	bool                    _writeShuffled;
+	bool                    _writeSinglePrecision;
+	unsigned int            _compressionLevel;
+	double                  _quantizationTol;
+	std::size_t             _timeChunkSize;
 	hsize_t*                _maxDims;
 	hsize_t*                _chunks;
 	double                  _chunkFactor;
@@ -102,6 +130,11 @@ HDF5Writer::HDF5Writer() :
 		_writeScalar(false),
 		_writeExtendible(true),
 		_writeCompressed(false),
+		_writeShuffled(false),
+		_writeSinglePrecision(false),
+		_compressionLevel(9),
+		_quantizationTol(0.0),
+		_timeChunkSize(0),
 		_maxDims(NULL),
 		_chunks(NULL),
 		_chunkFactor(1.5)
@@ -116,7 +149,30 @@ HDF5Writer::~HDF5Writer() CADET_NOEXCEPT { }
 template <>
 void HDF5Writer::write<double>(const std::string& dataSetName, const std::size_t rank, const std::size_t* dims, const double* buffer, const std::size_t stride, const std::size_t blockSize)
 {
-	writeWork(dataSetName, H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, rank, dims, buffer, stride, blockSize);
+	const hid_t fileType = (_writeSinglePrecision && !_writeScalar) ? H5T_IEEE_F32LE : H5T_IEEE_F64LE;
+	if ((_quantizationTol <= 0.0) || _writeScalar)
+	{
+		writeWork(dataSetName, H5T_NATIVE_DOUBLE, fileType, rank, dims, buffer, stride, blockSize);
+		return;
+	}
+
+	std::size_t bufSize = 1;
+	for (std::size_t i = 0; i < rank; ++i)
+		bufSize *= dims[i];
+
+	// Gather (possibly strided) data into a contiguous buffer and round to the quantization grid
+	const double quantum = 2.0 * _quantizationTol;
+	const std::size_t clampedStride = (stride <= 1) ? blockSize : stride;
+	std::vector<double> quantized(bufSize);
+
+	std::size_t counter = 0;
+	for (std::size_t i = 0; i < bufSize / blockSize; ++i)
+	{
+		for (std::size_t j = 0; j < blockSize; ++j, ++counter)
+			quantized[counter] = std::round(buffer[i * clampedStride + j] / quantum) * quantum;
+	}
+
+	writeWork(dataSetName, H5T_NATIVE_DOUBLE, fileType, rank, dims, quantized.data(), 1, 1);
 }
 
 template <>
@@ -261,12 +317,16 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 	hid_t dataSpace;
 	if (!_writeScalar)
 	{
-		if (_writeExtendible || _writeCompressed) // we need chunking
+		if (_writeExtendible || _writeCompressed || _writeShuffled) // we need chunking
 		{
 			_chunks  = new hsize_t[rank];
 			for (std::size_t i = 0; i < rank; ++i)
 				_chunks[i] = (_writeExtendible) ? static_cast<hsize_t>(dims[i] * _chunkFactor) : dims[i]; // leave some space in all dims, if extendible
 
+			// Time-major chunks: limit the first dimension and span all others
+			if ((_timeChunkSize > 0) && (rank > 0))
+				_chunks[0] = std::max<hsize_t>(std::min<hsize_t>(_chunks[0], _timeChunkSize), 1);
+
 			H5Pset_chunk(propList, rank, _chunks);
 			delete[] _chunks;
 		}
@@ -293,8 +353,11 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 		delete[] convDims;
 		delete[] _maxDims;
 
+		if (_writeShuffled) // shuffle bytes to group similar exponents and mantissas
+			H5Pset_shuffle(propList);
+
 		if (_writeCompressed) // enable compression
-			H5Pset_deflate(propList, 9);
+			H5Pset_deflate(propList, _compressionLevel);
 	}
 	else // reset _writeScalar
 	{
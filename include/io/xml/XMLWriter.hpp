@@ -90,6 +90,26 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) {}
 
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Sets the deflate level used when compression is enabled
+	inline void compressionLevel(unsigned int level) {}
+
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Enable/disable the byte shuffle filter applied before compression
+	inline void shuffleFields(bool setShuffle) {}
+
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Enable/disable storing floating point tensors in single precision
+	inline void singlePrecisionFields(bool setSinglePrecision) {}
+
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Sets the absolute error bound of the quantization of floating point tensors
+	inline void quantizeFields(double absTol) {}
+
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Sets the number of entries of the first (time) dimension per chunk
+	inline void timeChunkSize(std::size_t numTimesteps) {}
+
 private:
 
 	std::string _typeName;                      //!< Name of the type to be written
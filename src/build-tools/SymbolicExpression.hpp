@@ -0,0 +1,664 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides a small symbolic expression engine for the template code generator.
+ * Expressions are parsed from strings, stored as a hash-consed DAG (structurally
+ * identical subexpressions share one node), differentiated symbolically, and
+ * emitted as C++ code with common subexpressions hoisted into temporaries.
+ */
+
+#ifndef CADET_BUILDTOOLS_SYMBOLICEXPRESSION_HPP_
+#define CADET_BUILDTOOLS_SYMBOLICEXPRESSION_HPP_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <tuple>
+#include <functional>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
+#include <cmath>
+#include <cctype>
+
+namespace codegen
+{
+
+enum class Op : int
+{
+	Const,
+	Var,
+	Add,
+	Sub,
+	Mul,
+	Div,
+	Neg,
+	Pow,
+	Exp,
+	Log,
+	Sqrt
+};
+
+typedef int ExprId;
+
+/**
+ * @brief Node of an expression DAG
+ */
+struct Node
+{
+	Op op;
+	ExprId a;
+	ExprId b;
+	double value;
+	std::string name;
+};
+
+/**
+ * @brief Hash-consed pool of expression nodes
+ * @details Every node is created exactly once, so that identical subexpressions
+ *          are represented by the same id. This makes common subexpression elimination
+ *          a matter of counting references. Trivial algebraic simplifications (neutral
+ *          and absorbing elements, constant folding) are applied on construction.
+ */
+class ExpressionPool
+{
+public:
+
+	ExpressionPool() { }
+
+	ExprId constant(double v)
+	{
+		if (v == 0.0)
+			v = 0.0; // Normalize negative zero
+		return intern(Node{Op::Const, -1, -1, v, ""});
+	}
+
+	ExprId variable(const std::string& name) { return intern(Node{Op::Var, -1, -1, 0.0, name}); }
+
+	ExprId add(ExprId a, ExprId b)
+	{
+		if (isConst(a) && isConst(b))
+			return constant(value(a) + value(b));
+		if (isConst(a, 0.0))
+			return b;
+		if (isConst(b, 0.0))
+			return a;
+		if (_nodes[b].op == Op::Neg)
+			return sub(a, _nodes[b].a);
+		if (_nodes[a].op == Op::Neg)
+			return sub(b, _nodes[a].a);
+		return intern(Node{Op::Add, a, b, 0.0, ""});
+	}
+
+	ExprId sub(ExprId a, ExprId b)
+	{
+		if (isConst(a) && isConst(b))
+			return constant(value(a) - value(b));
+		if (isConst(b, 0.0))
+			return a;
+		if (isConst(a, 0.0))
+			return neg(b);
+		if (a == b)
+			return constant(0.0);
+		if (_nodes[b].op == Op::Neg)
+			return add(a, _nodes[b].a);
+		return intern(Node{Op::Sub, a, b, 0.0, ""});
+	}
+
+	ExprId mul(ExprId a, ExprId b)
+	{
+		if (isConst(a) && isConst(b))
+			return constant(value(a) * value(b));
+		if (isConst(a, 0.0) || isConst(b, 0.0))
+			return constant(0.0);
+		if (isConst(a, 1.0))
+			return b;
+		if (isConst(b, 1.0))
+			return a;
+		if (isConst(a, -1.0))
+			return neg(b);
+		if (isConst(b, -1.0))
+			return neg(a);
+		if (_nodes[a].op == Op::Neg)
+			return neg(mul(_nodes[a].a, b));
+		if (_nodes[b].op == Op::Neg)
+			return neg(mul(a, _nodes[b].a));
+		if ((_nodes[b].op == Op::Div) && isConst(_nodes[b].a, 1.0))
+			return div(a, _nodes[b].b);
+		if ((_nodes[a].op == Op::Div) && isConst(_nodes[a].a, 1.0))
+			return div(b, _nodes[a].b);
+		return intern(Node{Op::Mul, a, b, 0.0, ""});
+	}
+
+	ExprId div(ExprId a, ExprId b)
+	{
+		if (isConst(b, 0.0))
+			throw std::runtime_error("Division by constant zero in expression");
+		if (isConst(a) && isConst(b))
+			return constant(value(a) / value(b));
+		if (isConst(a, 0.0))
+			return constant(0.0);
+		if (isConst(b, 1.0))
+			return a;
+		if (a == b)
+			return constant(1.0);
+		if (_nodes[a].op == Op::Neg)
+			return neg(div(_nodes[a].a, b));
+		return intern(Node{Op::Div, a, b, 0.0, ""});
+	}
+
+	ExprId neg(ExprId a)
+	{
+		if (isConst(a))
+			return constant(-value(a));
+		if (_nodes[a].op == Op::Neg)
+			return _nodes[a].a;
+		if (_nodes[a].op == Op::Sub)
+			return sub(_nodes[a].b, _nodes[a].a);
+		return intern(Node{Op::Neg, a, -1, 0.0, ""});
+	}
+
+	ExprId pow(ExprId a, ExprId b)
+	{
+		if (isConst(a) && isConst(b))
+			return constant(std::pow(value(a), value(b)));
+		if (isConst(b, 0.0))
+			return constant(1.0);
+		if (isConst(b, 1.0))
+			return a;
+		if (isConst(b, -1.0))
+			return div(constant(1.0), a);
+		return intern(Node{Op::Pow, a, b, 0.0, ""});
+	}
+
+	ExprId exp(ExprId a)
+	{
+		if (isConst(a))
+			return constant(std::exp(value(a)));
+		if (_nodes[a].op == Op::Log)
+			return _nodes[a].a;
+		return intern(Node{Op::Exp, a, -1, 0.0, ""});
+	}
+
+	ExprId log(ExprId a)
+	{
+		if (isConst(a))
+			return constant(std::log(value(a)));
+		if (_nodes[a].op == Op::Exp)
+			return _nodes[a].a;
+		return intern(Node{Op::Log, a, -1, 0.0, ""});
+	}
+
+	ExprId sqrt(ExprId a)
+	{
+		if (isConst(a))
+			return constant(std::sqrt(value(a)));
+		return intern(Node{Op::Sqrt, a, -1, 0.0, ""});
+	}
+
+	inline const Node& operator[](ExprId id) const { return _nodes[id]; }
+	inline bool isConst(ExprId id) const { return _nodes[id].op == Op::Const; }
+	inline bool isConst(ExprId id, double v) const { return (_nodes[id].op == Op::Const) && (_nodes[id].value == v); }
+	inline bool isZero(ExprId id) const { return isConst(id, 0.0); }
+	inline bool isLeaf(ExprId id) const { return (_nodes[id].op == Op::Const) || (_nodes[id].op == Op::Var); }
+	inline double value(ExprId id) const { return _nodes[id].value; }
+
+	/**
+	 * @brief Checks whether an expression depends on the given variable
+	 * @param [in] e Expression
+	 * @param [in] var Name of the variable
+	 * @return @c true if the variable occurs in the expression, otherwise @c false
+	 */
+	bool dependsOn(ExprId e, const std::string& var) const
+	{
+		const Node& n = _nodes[e];
+		switch (n.op)
+		{
+			case Op::Const:
+				return false;
+			case Op::Var:
+				return n.name == var;
+			default:
+				return dependsOn(n.a, var) || ((n.b >= 0) && dependsOn(n.b, var));
+		}
+	}
+
+	/**
+	 * @brief Differentiates an expression with respect to a variable
+	 * @param [in] e Expression
+	 * @param [in] var Name of the variable
+	 * @return Derivative expression
+	 */
+	ExprId diff(ExprId e, const std::string& var)
+	{
+		const auto it = _diffCache.find(std::make_tuple(e, var));
+		if (it != _diffCache.end())
+			return it->second;
+
+		const Node n = _nodes[e];
+		ExprId d = -1;
+		switch (n.op)
+		{
+			case Op::Const:
+				d = constant(0.0);
+				break;
+			case Op::Var:
+				d = constant(n.name == var ? 1.0 : 0.0);
+				break;
+			case Op::Add:
+				d = add(diff(n.a, var), diff(n.b, var));
+				break;
+			case Op::Sub:
+				d = sub(diff(n.a, var), diff(n.b, var));
+				break;
+			case Op::Mul:
+				d = add(mul(diff(n.a, var), n.b), mul(n.a, diff(n.b, var)));
+				break;
+			case Op::Div:
+				// (a / b)' = (a' - (a / b) * b') / b reuses the node a / b
+				d = div(sub(diff(n.a, var), mul(e, diff(n.b, var))), n.b);
+				break;
+			case Op::Neg:
+				d = neg(diff(n.a, var));
+				break;
+			case Op::Pow:
+				if (!dependsOn(n.b, var))
+					d = mul(mul(n.b, pow(n.a, sub(n.b, constant(1.0)))), diff(n.a, var));
+				else
+					d = mul(e, add(mul(diff(n.b, var), log(n.a)), div(mul(n.b, diff(n.a, var)), n.a)));
+				break;
+			case Op::Exp:
+				d = mul(e, diff(n.a, var));
+				break;
+			case Op::Log:
+				d = div(diff(n.a, var), n.a);
+				break;
+			case Op::Sqrt:
+				d = div(diff(n.a, var), mul(constant(2.0), e));
+				break;
+		}
+
+		_diffCache[std::make_tuple(e, var)] = d;
+		return d;
+	}
+
+	/**
+	 * @brief Parses an expression from a string
+	 * @details Supports the binary operators @c +, @c -, @c *, @c /, and @c ^ (power),
+	 *          unary minus, parentheses, and the functions @c exp, @c log, @c sqrt, and @c pow.
+	 * @param [in] str Expression string
+	 * @param [in] isKnown Returns @c true if the given identifier is a valid variable name
+	 * @return Parsed expression
+	 */
+	ExprId parse(const std::string& str, const std::function<bool(const std::string&)>& isKnown)
+	{
+		Parser p(*this, str, isKnown);
+		return p.parse();
+	}
+
+protected:
+
+	typedef std::tuple<int, ExprId, ExprId, double, std::string> key_t;
+
+	ExprId intern(const Node& n)
+	{
+		const key_t key = std::make_tuple(static_cast<int>(n.op), n.a, n.b, n.value, n.name);
+		const auto it = _index.find(key);
+		if (it != _index.end())
+			return it->second;
+
+		const ExprId id = static_cast<ExprId>(_nodes.size());
+		_nodes.push_back(n);
+		_index[key] = id;
+		return id;
+	}
+
+	class Parser
+	{
+	public:
+		Parser(ExpressionPool& pool, const std::string& str, const std::function<bool(const std::string&)>& isKnown) : _pool(pool), _str(str), _pos(0), _isKnown(isKnown) { }
+
+		ExprId parse()
+		{
+			const ExprId e = parseSum();
+			skipSpace();
+			if (_pos != _str.size())
+				fail("Unexpected character");
+			return e;
+		}
+
+	protected:
+		ExpressionPool& _pool;
+		const std::string& _str;
+		std::size_t _pos;
+		const std::function<bool(const std::string&)>& _isKnown;
+
+		void fail(const std::string& msg) const
+		{
+			throw std::runtime_error(msg + " at position " + std::to_string(_pos) + " in expression \"" + _str + "\"");
+		}
+
+		void skipSpace()
+		{
+			while ((_pos < _str.size()) && std::isspace(static_cast<unsigned char>(_str[_pos])))
+				++_pos;
+		}
+
+		bool accept(char c)
+		{
+			skipSpace();
+			if ((_pos < _str.size()) && (_str[_pos] == c))
+			{
+				++_pos;
+				return true;
+			}
+			return false;
+		}
+
+		void expect(char c)
+		{
+			if (!accept(c))
+				fail(std::string("Expected '") + c + "'");
+		}
+
+		ExprId parseSum()
+		{
+			ExprId e = parseProduct();
+			while (true)
+			{
+				if (accept('+'))
+					e = _pool.add(e, parseProduct());
+				else if (accept('-'))
+					e = _pool.sub(e, parseProduct());
+				else
+					return e;
+			}
+		}
+
+		ExprId parseProduct()
+		{
+			ExprId e = parseUnary();
+			while (true)
+			{
+				if (accept('*'))
+					e = _pool.mul(e, parseUnary());
+				else if (accept('/'))
+					e = _pool.div(e, parseUnary());
+				else
+					return e;
+			}
+		}
+
+		ExprId parseUnary()
+		{
+			if (accept('-'))
+				return _pool.neg(parseUnary());
+			if (accept('+'))
+				return parseUnary();
+			return parsePower();
+		}
+
+		ExprId parsePower()
+		{
+			const ExprId base = parsePrimary();
+			if (accept('^'))
+				return _pool.pow(base, parseUnary());
+			return base;
+		}
+
+		ExprId parsePrimary()
+		{
+			skipSpace();
+			if (_pos >= _str.size())
+				fail("Unexpected end");
+
+			if (accept('('))
+			{
+				const ExprId e = parseSum();
+				expect(')');
+				return e;
+			}
+
+			const char c = _str[_pos];
+			if (std::isdigit(static_cast<unsigned char>(c)) || (c == '.'))
+			{
+				std::size_t len = 0;
+				const double v = std::stod(_str.substr(_pos), &len);
+				_pos += len;
+				return _pool.constant(v);
+			}
+
+			if (std::isalpha(static_cast<unsigned char>(c)) || (c == '_'))
+			{
+				const std::size_t start = _pos;
+				while ((_pos < _str.size()) && (std::isalnum(static_cast<unsigned char>(_str[_pos])) || (_str[_pos] == '_')))
+					++_pos;
+				const std::string ident = _str.substr(start, _pos - start);
+
+				if (accept('('))
+				{
+					const ExprId arg = parseSum();
+					if (ident == "pow")
+					{
+						expect(',');
+						const ExprId ex = parseSum();
+						expect(')');
+						return _pool.pow(arg, ex);
+					}
+					expect(')');
+					if (ident == "exp")
+						return _pool.exp(arg);
+					if (ident == "log")
+						return _pool.log(arg);
+					if (ident == "sqrt")
+						return _pool.sqrt(arg);
+					fail("Unknown function \"" + ident + "\"");
+				}
+
+				if (!_isKnown(ident))
+					fail("Unknown identifier \"" + ident + "\"");
+				return _pool.variable(ident);
+			}
+
+			fail("Unexpected character");
+			return -1;
+		}
+	};
+
+	std::vector<Node> _nodes;
+	std::map<key_t, ExprId> _index;
+	std::map<std::tuple<ExprId, std::string>, ExprId> _diffCache;
+};
+
+/**
+ * @brief Temporary variable emitted by the CodeEmitter
+ */
+struct Temporary
+{
+	std::string name;
+	std::string expr;
+};
+
+/**
+ * @brief Emits C++ code for a set of expressions that are evaluated in the same scope
+ * @details Non-leaf nodes that are referenced more than once by the given roots are
+ *          assigned to temporaries, which are returned in dependency order.
+ */
+class CodeEmitter
+{
+public:
+
+	/**
+	 * @brief Creates an emitter
+	 * @param [in] pool Expression pool
+	 * @param [in] renderVar Returns the C++ code of a variable
+	 * @param [in] prefix Prefix of the temporaries' names
+	 */
+	CodeEmitter(const ExpressionPool& pool, const std::function<std::string(const std::string&)>& renderVar, const std::string& prefix)
+		: _pool(pool), _renderVar(renderVar), _prefix(prefix) { }
+
+	/**
+	 * @brief Generates code for the given root expressions
+	 * @param [in] roots Expressions that are evaluated in this scope
+	 * @param [out] temps Temporaries that have to be declared before the roots are evaluated
+	 * @return C++ code of each root expression
+	 */
+	std::vector<std::string> emit(const std::vector<ExprId>& roots, std::vector<Temporary>& temps)
+	{
+		_refCount.clear();
+		_names.clear();
+		temps.clear();
+
+		for (ExprId r : roots)
+			countRefs(r);
+
+		for (ExprId r : roots)
+			declare(r, temps);
+
+		std::vector<std::string> code;
+		code.reserve(roots.size());
+		for (ExprId r : roots)
+			code.push_back(str(r));
+		return code;
+	}
+
+protected:
+
+	const ExpressionPool& _pool;
+	std::function<std::string(const std::string&)> _renderVar;
+	std::string _prefix;
+	std::map<ExprId, int> _refCount;
+	std::map<ExprId, std::string> _names;
+
+	void countRefs(ExprId e)
+	{
+		const int cnt = ++_refCount[e];
+		if ((cnt > 1) || _pool.isLeaf(e))
+			return;
+
+		const Node& n = _pool[e];
+		countRefs(n.a);
+		if (n.b >= 0)
+			countRefs(n.b);
+
+		// Small integer powers are expanded into products, which reference the base repeatedly
+		if ((n.op == Op::Pow) && (_pool.isConst(n.b, 2.0) || _pool.isConst(n.b, 3.0)))
+			++_refCount[n.a];
+	}
+
+	void declare(ExprId e, std::vector<Temporary>& temps)
+	{
+		if (_pool.isLeaf(e) || (_names.find(e) != _names.end()))
+			return;
+
+		const Node& n = _pool[e];
+		declare(n.a, temps);
+		if (n.b >= 0)
+			declare(n.b, temps);
+
+		if (_refCount[e] > 1)
+		{
+			const std::string name = _prefix + std::to_string(temps.size());
+			temps.push_back(Temporary{name, str(e)});
+			_names[e] = name;
+		}
+	}
+
+	static int precedence(Op op)
+	{
+		switch (op)
+		{
+			case Op::Add:
+			case Op::Sub:
+				return 1;
+			case Op::Mul:
+			case Op::Div:
+				return 2;
+			case Op::Neg:
+				return 3;
+			default:
+				return 4;
+		}
+	}
+
+	int precedenceOf(ExprId e) const
+	{
+		if (_names.find(e) != _names.end())
+			return 4;
+		if (_pool.isConst(e) && (_pool.value(e) < 0.0))
+			return 3;
+		return precedence(_pool[e].op);
+	}
+
+	std::string operand(ExprId e, int parentPrec, bool rightAssocSensitive) const
+	{
+		const int p = precedenceOf(e);
+		if ((p < parentPrec) || (rightAssocSensitive && (p == parentPrec)))
+			return "(" + str(e) + ")";
+		return str(e);
+	}
+
+	static std::string literal(double v)
+	{
+		std::ostringstream os;
+		os << std::setprecision(17) << v;
+		std::string s = os.str();
+		if (s.find_first_of(".eEn") == std::string::npos)
+			s += ".0";
+		return s;
+	}
+
+	std::string str(ExprId e) const
+	{
+		const auto it = _names.find(e);
+		if (it != _names.end())
+			return it->second;
+
+		const Node& n = _pool[e];
+		switch (n.op)
+		{
+			case Op::Const:
+				return literal(n.value);
+			case Op::Var:
+				return _renderVar(n.name);
+			case Op::Add:
+				return operand(n.a, 1, false) + " + " + operand(n.b, 1, false);
+			case Op::Sub:
+				return operand(n.a, 1, false) + " - " + operand(n.b, 1, true);
+			case Op::Mul:
+				return operand(n.a, 2, false) + " * " + operand(n.b, 2, false);
+			case Op::Div:
+				return operand(n.a, 2, false) + " / " + operand(n.b, 2, true);
+			case Op::Neg:
+				return "-" + operand(n.a, 3, true);
+			case Op::Pow:
+				if (_pool.isConst(n.b, 2.0))
+					return operand(n.a, 2, false) + " * " + operand(n.a, 2, true);
+				if (_pool.isConst(n.b, 3.0))
+					return operand(n.a, 2, false) + " * " + operand(n.a, 2, true) + " * " + operand(n.a, 2, true);
+				return "pow(" + str(n.a) + ", " + str(n.b) + ")";
+			case Op::Exp:
+				return "exp(" + str(n.a) + ")";
+			case Op::Log:
+				return "log(" + str(n.a) + ")";
+			case Op::Sqrt:
+				return "sqrt(" + str(n.a) + ")";
+		}
+		return "";
+	}
+};
+
+} // namespace codegen
+
+#endif  // CADET_BUILDTOOLS_SYMBOLICEXPRESSION_HPP_
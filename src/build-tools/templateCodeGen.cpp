@@ -13,10 +13,17 @@
 #include <json.hpp>
 #include <inja.hpp>
 
+#include "SymbolicExpression.hpp"
+
 #include <iostream>
 #include <sstream>
 #include <fstream>
 #include <exception>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <functional>
 
 /**
  * @file Provides a code generator tool using templates.
@@ -27,6 +34,22 @@
  * 
  * The template is taken from a file after the marker {slash}* <codegentemplate> *{slash}. If the marker is not
  * found, the full file is taken as template.
+ *
+ * A data block may contain a @c flux object that describes the flux of a binding model
+ * with one bound state per binding component:
+ * @code
+ *   "flux": {
+ *       "name": "LangmuirFlux",
+ *       "sums": [ { "name": "qSum", "expr": "q / qMax" } ],
+ *       "expr": "kD * q - kA * c * qMax * (1 - qSum)"
+ *   }
+ * @endcode
+ * The flux expression of component @c i may use the liquid phase concentration @c c, the bound
+ * state @c q, the parameters of the data block, and the sums. Each sum is taken over all bound
+ * components @c j of its expression, which may use @c c, @c q, and the parameters. The flux is
+ * differentiated symbolically with respect to @c c, @c q, and the sums, common subexpressions are
+ * extracted into temporaries, and the resulting code is added to the @c flux object (see
+ * generateFluxKernel()) for use in the template.
  */
 
 /**
@@ -59,6 +82,168 @@ void extractTemplate(std::string& templateFile, const std::string& markerTemplat
 	templateFile = templateFile.substr(pos + markerTemplate.size());
 }
 
+/**
+ * @brief Builds a function that renders a variable of a flux expression as C++ code
+ * @param [in] paramTypes Maps parameter names to their parameter type
+ * @param [in] castType Type that parameters are cast to
+ * @param [in] outer @c true if the variable is evaluated for the flux component (index @c i),
+ *             @c false if it is evaluated inside a sum (index @c j)
+ * @return Function that renders a variable
+ */
+std::function<std::string(const std::string&)> makeRenderer(const std::map<std::string, std::string>& paramTypes, const std::string& castType, bool outer)
+{
+	const std::string compIdx = outer ? "i" : "j";
+	const std::string bndIdx = outer ? "bndIdx" : "bndIdx2";
+
+	return [=](const std::string& var) -> std::string
+	{
+		if (var == "c")
+			return "yCp[" + compIdx + "]";
+		if (var == "q")
+			return "y[" + bndIdx + "]";
+
+		const auto it = paramTypes.find(var);
+		if (it == paramTypes.end())
+			return var;
+
+		if (it->second == "ScalarParameter")
+			return "static_cast<" + castType + ">(p->" + var + ")";
+		if (it->second == "ScalarBoundStateDependentParameter")
+			return "static_cast<" + castType + ">(p->" + var + "[" + bndIdx + "])";
+		return "static_cast<" + castType + ">(p->" + var + "[" + compIdx + "])";
+	};
+}
+
+/**
+ * @brief Converts a list of temporaries to JSON
+ * @param [in] temps Temporaries
+ * @return JSON array of objects with @c name and @c expr fields
+ */
+nlohmann::json toJson(const std::vector<codegen::Temporary>& temps)
+{
+	nlohmann::json arr = nlohmann::json::array();
+	for (const codegen::Temporary& t : temps)
+		arr.push_back({{"name", t.name}, {"expr", t.expr}});
+	return arr;
+}
+
+/**
+ * @brief Generates code for the flux and its analytic Jacobian from the flux expressions of a data block
+ * @details The following fields are added to the @c flux object:
+ *          - @c sumTemps, @c sums/value: Code for accumulating the sums (flux types)
+ *          - @c jacSumTemps, @c sums/jacValue: Code for accumulating the sums (@c double)
+ *          - @c resTemps, @c residual: Code for the flux of component @c i
+ *          - @c rowTemps, @c dc, @c dq, @c sums/dFdS: Partial derivatives of the flux of component @c i
+ *          - @c colTemps, @c dcSum, @c dqSum: Derivatives with respect to @c c_j and @c q_j via the sums
+ *          - @c hasDc, @c hasDq, @c sums/hasDFdS, @c hasDcSum, @c hasDqSum: Flags for structurally nonzero derivatives
+ *          - @c hasCoupling, @c dcAssign, @c dqAssign: Structural information on the Jacobian row
+ * @param [in,out] data Data block
+ */
+void generateFluxKernel(nlohmann::json& data)
+{
+	nlohmann::json& flux = data["flux"];
+
+	std::map<std::string, std::string> paramTypes;
+	for (const char* group : {"parameters", "constantParameters"})
+	{
+		if (data.count(group) == 0)
+			continue;
+
+		for (const nlohmann::json& p : data[group])
+		{
+			if (p["varName"].is_string())
+				paramTypes[p["varName"].get<std::string>()] = p["type"].get<std::string>();
+		}
+	}
+
+	std::vector<std::string> sumNames;
+	if (flux.count("sums") == 0)
+		flux["sums"] = nlohmann::json::array();
+
+	for (const nlohmann::json& s : flux["sums"])
+		sumNames.push_back(s["name"].get<std::string>());
+
+	const auto isParamOrState = [&](const std::string& id) { return (id == "c") || (id == "q") || (paramTypes.find(id) != paramTypes.end()); };
+	const auto isKnown = [&](const std::string& id) { return isParamOrState(id) || (std::find(sumNames.begin(), sumNames.end(), id) != sumNames.end()); };
+
+	codegen::ExpressionPool pool;
+
+	// Sums are evaluated per bound component j
+	std::vector<codegen::ExprId> sumExprs;
+	for (const nlohmann::json& s : flux["sums"])
+		sumExprs.push_back(pool.parse(s["expr"].get<std::string>(), isParamOrState));
+
+	const codegen::ExprId f = pool.parse(flux["expr"].get<std::string>(), isKnown);
+
+	std::vector<codegen::Temporary> temps;
+
+	// Flux (residual types)
+	{
+		codegen::CodeEmitter sumEmitter(pool, makeRenderer(paramTypes, "ParamType", false), "g");
+		const std::vector<std::string> sumCode = sumEmitter.emit(sumExprs, temps);
+		flux["sumTemps"] = toJson(temps);
+		for (std::size_t k = 0; k < sumCode.size(); ++k)
+			flux["sums"][k]["value"] = sumCode[k];
+
+		codegen::CodeEmitter resEmitter(pool, makeRenderer(paramTypes, "ParamType", true), "t");
+		flux["residual"] = resEmitter.emit({f}, temps)[0];
+		flux["resTemps"] = toJson(temps);
+	}
+
+	// Jacobian (double)
+	{
+		codegen::CodeEmitter sumEmitter(pool, makeRenderer(paramTypes, "double", false), "g");
+		const std::vector<std::string> sumCode = sumEmitter.emit(sumExprs, temps);
+		flux["jacSumTemps"] = toJson(temps);
+		for (std::size_t k = 0; k < sumCode.size(); ++k)
+			flux["sums"][k]["jacValue"] = sumCode[k];
+
+		// Partial derivatives of the flux of component i
+		std::vector<codegen::ExprId> rowRoots;
+		rowRoots.push_back(pool.diff(f, "c"));
+		rowRoots.push_back(pool.diff(f, "q"));
+		for (const std::string& s : sumNames)
+			rowRoots.push_back(pool.diff(f, s));
+
+		// Derivatives with respect to c_j and q_j that are propagated through the sums
+		codegen::ExprId dcSum = pool.constant(0.0);
+		codegen::ExprId dqSum = pool.constant(0.0);
+		for (std::size_t k = 0; k < sumNames.size(); ++k)
+		{
+			if (pool.isZero(rowRoots[2 + k]))
+				continue;
+
+			const codegen::ExprId dFdS = pool.variable("dFd" + sumNames[k]);
+			dcSum = pool.add(dcSum, pool.mul(dFdS, pool.diff(sumExprs[k], "c")));
+			dqSum = pool.add(dqSum, pool.mul(dFdS, pool.diff(sumExprs[k], "q")));
+		}
+
+		codegen::CodeEmitter rowEmitter(pool, makeRenderer(paramTypes, "double", true), "t");
+		const std::vector<std::string> rowCode = rowEmitter.emit(rowRoots, temps);
+		flux["rowTemps"] = toJson(temps);
+		flux["dc"] = rowCode[0];
+		flux["dq"] = rowCode[1];
+		flux["hasDc"] = !pool.isZero(rowRoots[0]);
+		flux["hasDq"] = !pool.isZero(rowRoots[1]);
+		for (std::size_t k = 0; k < sumNames.size(); ++k)
+		{
+			flux["sums"][k]["dFdS"] = rowCode[2 + k];
+			flux["sums"][k]["hasDFdS"] = !pool.isZero(rowRoots[2 + k]);
+		}
+
+		codegen::CodeEmitter colEmitter(pool, makeRenderer(paramTypes, "double", false), "s");
+		const std::vector<std::string> colCode = colEmitter.emit({dcSum, dqSum}, temps);
+		flux["colTemps"] = toJson(temps);
+		flux["dcSum"] = colCode[0];
+		flux["dqSum"] = colCode[1];
+		flux["hasDcSum"] = !pool.isZero(dcSum);
+		flux["hasDqSum"] = !pool.isZero(dqSum);
+		flux["hasCoupling"] = !pool.isZero(dcSum) || !pool.isZero(dqSum);
+		flux["dcAssign"] = pool.isZero(dcSum) ? "=" : "+=";
+		flux["dqAssign"] = pool.isZero(dqSum) ? "=" : "+=";
+	}
+}
+
 /**
  * @brief Processes a data block using a template
  * @details Applies data to the template and inserts the results into the output stream.
@@ -69,6 +254,9 @@ void extractTemplate(std::string& templateFile, const std::string& markerTemplat
 void processData(const std::string& templateFile, const std::string& dataBlock, std::ostringstream& output)
 {
 	nlohmann::json data = nlohmann::json::parse(dataBlock);
+	if (data.count("flux") > 0)
+		generateFluxKernel(data);
+
 	output << inja::render(templateFile, data);
 }
 
@@ -32,10 +32,15 @@
 	#include "common/Timer.hpp"
 #endif
 
+#ifdef CADET_MPI
+	#include <mpi.h>
+#endif
+
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <cctype>
+#include <algorithm>
 
 #ifndef CADET_LOGGING_DISABLE
 	template <>
@@ -55,8 +60,57 @@ namespace
 		cadet::log::RuntimeFilteringLogger<cadet::log::GlobalLogger>::level(newLL);
 #endif
 	}
+
+	inline int mpiRank()
+	{
+#ifdef CADET_MPI
+		int rank = 0;
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+		return rank;
+#else
+		return 0;
+#endif
+	}
+
+	inline int mpiSize()
+	{
+#ifdef CADET_MPI
+		int size = 1;
+		MPI_Comm_size(MPI_COMM_WORLD, &size);
+		return size;
+#else
+		return 1;
+#endif
+	}
+
+	inline void mpiBarrier()
+	{
+#ifdef CADET_MPI
+		MPI_Barrier(MPI_COMM_WORLD);
+#endif
+	}
+
+	inline int mpiMaxReturnCode(int returnCode)
+	{
+#ifdef CADET_MPI
+		MPI_Allreduce(MPI_IN_PLACE, &returnCode, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+		return returnCode;
+	}
 }
 
+#ifdef CADET_MPI
+	/**
+	 * @brief Scope class that initializes MPI on construction and finalizes it on destruction
+	 */
+	class MpiScope
+	{
+	public:
+		MpiScope(int& argc, char**& argv) { MPI_Init(&argc, &argv); }
+		~MpiScope() CADET_NOEXCEPT { MPI_Finalize(); }
+	};
+#endif
+
 class LogReceiver : public cadet::ILogReceiver
 {
 public:
@@ -220,6 +274,10 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 {
 	int returnCode = 0;
 	cadet::Driver drv;
+
+	// If the unit operations are distributed over multiple processes, all processes hold the full
+	// solution and only the first one shows progress and writes results
+	const bool isRootProcess = (mpiRank() == 0);
 	
 	{
 		DriverConfigurator_t dc;
@@ -233,7 +291,7 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 
 	std::unique_ptr<ProgressBarNotifier> pb = nullptr;
 
-	if (showProgressBar)
+	if (showProgressBar && isRootProcess)
 	{
 		pb = std::make_unique<ProgressBarNotifier>();
 		drv.simulator()->setNotificationCallback(pb.get());
@@ -260,14 +318,17 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 		returnCode = 3;
 	}
 
-	Writer_t writer;
-	if (inFileName == outFileName)
-		writer.openFile(outFileName, "rw");
-	else
-		writer.openFile(outFileName, "co");
+	if (isRootProcess)
+	{
+		Writer_t writer;
+		if (inFileName == outFileName)
+			writer.openFile(outFileName, "rw");
+		else
+			writer.openFile(outFileName, "co");
 
-	drv.write(writer);
-	writer.closeFile();
+		drv.write(writer);
+		writer.closeFile();
+	}
 
 #ifdef CADET_BENCHMARK_MODE
 	// Write timings in JSON format
@@ -307,8 +368,114 @@ int run(const std::string& inFileName, const std::string& outFileName, bool show
 }
 
 
+/**
+ * @brief Runs an ensemble of independent simulations stored in one HDF5 file
+ * @details Every group in the root of the input file that contains an @c input group is a
+ *          simulation. The simulations are distributed round-robin over all MPI processes.
+ *          The results of each simulation are written to the group of the same name in the
+ *          output file. Without MPI, all simulations are run one after another.
+ * @param [in] inFileName Name of the input file
+ * @param [in] outFileName Name of the output file
+ * @return Largest return code of all simulations
+ */
+int runEnsemble(const std::string& inFileName, const std::string& outFileName)
+{
+	const int rank = mpiRank();
+	const int nProcs = mpiSize();
+
+	std::vector<std::string> simNames;
+	{
+		cadet::io::HDF5Reader rd;
+		rd.openFile(inFileName, "r");
+		for (const std::string& name : rd.itemNames())
+		{
+			if (rd.isGroup(name) && rd.exists(name + "/input"))
+				simNames.push_back(name);
+		}
+		rd.closeFile();
+	}
+
+	if (rank == 0)
+	{
+		std::cout << "Running ensemble of " << simNames.size() << " simulations on " << nProcs << " processes" << std::endl;
+
+		// Create output file before any process writes to it
+		if (inFileName != outFileName)
+		{
+			cadet::io::HDF5Writer writer;
+			writer.openFile(outFileName, "co");
+			writer.closeFile();
+		}
+	}
+	mpiBarrier();
+
+	int returnCode = 0;
+	const std::size_t nRounds = (simNames.size() + nProcs - 1) / nProcs;
+	for (std::size_t round = 0; round < nRounds; ++round)
+	{
+		const std::size_t idxSim = round * nProcs + rank;
+		std::unique_ptr<cadet::Driver> drv = nullptr;
+		SignalHandlingNotifier shn;
+
+		// Errors of a single simulation must not stop the process, since all processes have to
+		// take part in writing the results
+		if (idxSim < simNames.size())
+		{
+			try
+			{
+				drv = std::make_unique<cadet::Driver>();
+
+				cadet::io::HDF5Reader rd;
+				rd.openFile(inFileName, "r");
+				rd.setGroup(simNames[idxSim] + "/input");
+
+				cadet::ParameterProviderImpl<cadet::io::HDF5Reader> pp(rd, false);
+				drv->configure(pp);
+				rd.closeFile();
+
+				drv->simulator()->setNotificationCallback(&shn);
+				drv->run();
+			}
+			catch (const cadet::IntegrationException& e)
+			{
+				std::cerr << "SOLVER ERROR in simulation " << simNames[idxSim] << ": " << e.what() << std::endl;
+				returnCode = std::max(returnCode, 3);
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << "ERROR in simulation " << simNames[idxSim] << ": " << e.what() << std::endl;
+				returnCode = std::max(returnCode, 1);
+				drv.reset();
+			}
+		}
+
+		// Processes write their results one after another
+		mpiBarrier();
+		for (int r = 0; r < nProcs; ++r)
+		{
+			if ((r == rank) && drv)
+			{
+				cadet::io::HDF5Writer writer;
+				writer.openFile(outFileName, "rw");
+				writer.unlinkGroup(simNames[idxSim] + "/output");
+				writer.setGroup(simNames[idxSim]);
+				drv->write(writer);
+				writer.closeFile();
+			}
+			mpiBarrier();
+		}
+	}
+
+	return mpiMaxReturnCode(returnCode);
+}
+
+
 int main(int argc, char** argv)
 {	
+#ifdef CADET_MPI
+	MpiScope mpiScope(argc, argv);
+#endif
+
 #ifdef CADET_BENCHMARK_MODE
 	// Benchmark the whole program from start to finish
 	BenchScope bsTotalTime;
@@ -322,6 +489,7 @@ int main(int argc, char** argv)
 	std::string outFileName = "";
 	cadet::LogLevel logLevel = cadet::LogLevel::Trace;
 	bool showProgressBar = false;
+	bool ensemble = false;
 
 	try
 	{
@@ -330,6 +498,7 @@ int main(int argc, char** argv)
 		cmd.setOutput(&customOut);
 
 		cmd >> (new TCLAP::SwitchArg("", "progress", "Show a progress bar"))->storeIn(&showProgressBar);
+		cmd >> (new TCLAP::SwitchArg("", "ensemble", "Run all simulations in the groups of an HDF5 file (distributed over MPI processes)"))->storeIn(&ensemble);
 		cmd >> (new TCLAP::ValueArg<cadet::LogLevel>("L", "loglevel", "Set the log level", false, cadet::LogLevel::Trace, "LogLevel"))->storeIn(&logLevel);
 		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("input", "Input file", true, "", "File"))->storeIn(&inFileName);
 		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("output", "Output file (defaults to input file)", false, "", "File"))->storeIn(&outFileName);
@@ -373,9 +542,19 @@ int main(int argc, char** argv)
 	const std::string fileExtOut = outFileName.substr(dotPosOut+1);
 	int returnCode = 0;
 
+	if (ensemble && !(cadet::util::caseInsensitiveEquals(fileExtIn, "h5") && cadet::util::caseInsensitiveEquals(fileExtOut, "h5")))
+	{
+		std::cerr << "Ensemble mode requires HDF5 input and output files" << std::endl;
+		return 2;
+	}
+
 	try
 	{
-		if (cadet::util::caseInsensitiveEquals(fileExtIn, "h5"))
+		if (ensemble)
+		{
+			returnCode = runEnsemble(inFileName, outFileName);
+		}
+		else if (cadet::util::caseInsensitiveEquals(fileExtIn, "h5"))
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
@@ -51,6 +51,12 @@ namespace cadet
 	extern "C" void LAPACK_FUNC(dgbtrs,DGBTRS) (char* trans, lapackInt_t* n, lapackInt_t* kl, lapackInt_t*  ku, lapackInt_t* nrhs,
 			double* ab, lapackInt_t* ldab, lapackInt_t* ipiv, double* b, lapackInt_t* ldb, lapackInt_t* info);
 
+	extern "C" void LAPACK_FUNC(sgbtrf,SGBTRF) (lapackInt_t* m, lapackInt_t* n, lapackInt_t* kl, lapackInt_t* ku, float* ab,
+			lapackInt_t* ldab, lapackInt_t* ipiv, lapackInt_t* info);
+
+	extern "C" void LAPACK_FUNC(sgbtrs,SGBTRS) (char* trans, lapackInt_t* n, lapackInt_t* kl, lapackInt_t*  ku, lapackInt_t* nrhs,
+			float* ab, lapackInt_t* ldab, lapackInt_t* ipiv, float* b, lapackInt_t* ldb, lapackInt_t* info);
+
 	extern "C" void LAPACK_FUNC(dgbmv,DGBMV) (char* trans, lapackInt_t* m, lapackInt_t* n, lapackInt_t* kl, lapackInt_t* ku,
 			double* alpha, double* a, lapackInt_t* lda, double* x, lapackInt_t* incx, double* beta,
 			double* y, lapackInt_t* incy);
@@ -80,6 +86,8 @@ namespace cadet
 		#ifdef CADET_LAPACK_UPPERCASE
 			#define LapackFactorDenseBanded DGBTRF_
 			#define LapackSolveDenseBanded DGBTRS_
+			#define LapackFactorDenseBandedSingle SGBTRF_
+			#define LapackSolveDenseBandedSingle SGBTRS_
 			#define LapackMultiplyDenseBanded DGBMV_
 			#define LapackFactorDense DGETRF_
 			#define LapackSolveDense DGETRS_
@@ -91,6 +99,8 @@ namespace cadet
 		#else
 			#define LapackFactorDenseBanded dgbtrf_
 			#define LapackSolveDenseBanded dgbtrs_
+			#define LapackFactorDenseBandedSingle sgbtrf_
+			#define LapackSolveDenseBandedSingle sgbtrs_
 			#define LapackMultiplyDenseBanded dgbmv_
 			#define LapackFactorDense dgetrf_
 			#define LapackSolveDense dgetrs_
@@ -105,6 +115,8 @@ namespace cadet
 			#ifdef CADET_LAPACK_UPPERCASE
 				#define LapackFactorDenseBanded _DGBTRF
 				#define LapackSolveDenseBanded _DGBTRS
+				#define LapackFactorDenseBandedSingle _SGBTRF
+				#define LapackSolveDenseBandedSingle _SGBTRS
 				#define LapackMultiplyDenseBanded _DGBMV
 				#define LapackFactorDense _DGETRF
 				#define LapackSolveDense _DGETRS
@@ -116,6 +128,8 @@ namespace cadet
 			#else
 				#define LapackFactorDenseBanded _dgbtrf
 				#define LapackSolveDenseBanded _dgbtrs
+				#define LapackFactorDenseBandedSingle _sgbtrf
+				#define LapackSolveDenseBandedSingle _sgbtrs
 				#define LapackMultiplyDenseBanded _dgbmv
 				#define LapackFactorDense _dgetrf
 				#define LapackSolveDense _dgetrs
@@ -129,6 +143,8 @@ namespace cadet
 			#ifdef CADET_LAPACK_UPPERCASE
 				#define LapackFactorDenseBanded DGBTRF
 				#define LapackSolveDenseBanded DGBTRS
+				#define LapackFactorDenseBandedSingle SGBTRF
+				#define LapackSolveDenseBandedSingle SGBTRS
 				#define LapackMultiplyDenseBanded DGBMV
 				#define LapackFactorDense DGETRF
 				#define LapackSolveDense DGETRS
@@ -140,6 +156,8 @@ namespace cadet
 			#else
 				#define LapackFactorDenseBanded dgbtrf
 				#define LapackSolveDenseBanded dgbtrs
+				#define LapackFactorDenseBandedSingle sgbtrf
+				#define LapackSolveDenseBandedSingle sgbtrs
 				#define LapackMultiplyDenseBanded dgbmv
 				#define LapackFactorDense dgetrf
 				#define LapackSolveDense dgetrs
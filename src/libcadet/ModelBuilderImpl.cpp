@@ -37,6 +37,7 @@ namespace cadet
 		void registerLumpedRateModelWithPores(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models);
 		void registerLumpedRateModelWithoutPores(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models);
 		void registerCSTRModel(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models);
+		void registerCompartmentNetworkModel(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models);
 #ifdef ENABLE_GRM_2D
 		void registerGeneralRateModel2D(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models);
 #endif
@@ -44,6 +45,7 @@ namespace cadet
 		namespace inlet
 		{
 			void registerPiecewiseCubicPoly(std::unordered_map<std::string, std::function<IInletProfile*()>>& inlets);
+			void registerTabulated(std::unordered_map<std::string, std::function<IInletProfile*()>>& inlets);
 		} // namespace inlet
 
 		namespace extfun
@@ -62,6 +64,7 @@ namespace cadet
 		model::registerLumpedRateModelWithPores(_modelCreators);
 		model::registerLumpedRateModelWithoutPores(_modelCreators);
 		model::registerCSTRModel(_modelCreators);
+		model::registerCompartmentNetworkModel(_modelCreators);
 
 #ifdef ENABLE_GRM_2D
 		model::registerGeneralRateModel2D(_modelCreators);
@@ -69,6 +72,7 @@ namespace cadet
 
 		// Register all available inlet profiles
 		model::inlet::registerPiecewiseCubicPoly(_inletCreators);
+		model::inlet::registerTabulated(_inletCreators);
 
 		// Register all available external functions
 		model::extfun::registerLinearInterpolation(_extFunCreators);
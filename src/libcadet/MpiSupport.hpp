@@ -0,0 +1,122 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Helper functions for distributed execution via MPI.
+ *
+ * If CADET is built without MPI support (i.e., @c CADET_MPI is not defined), all functions
+ * behave as if there is a single process.
+ */
+
+#ifndef LIBCADET_MPI_SUPPORT_HPP_
+#define LIBCADET_MPI_SUPPORT_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#ifdef CADET_MPI
+	#include <mpi.h>
+#endif
+
+namespace cadet
+{
+
+namespace mpi
+{
+
+#ifdef CADET_MPI
+
+	/**
+	 * @brief Returns whether MPI has been initialized by the application
+	 * @return @c true if MPI can be used, otherwise @c false
+	 */
+	inline bool isInitialized() CADET_NOEXCEPT
+	{
+		int initialized = 0;
+		int finalized = 0;
+		MPI_Initialized(&initialized);
+		MPI_Finalized(&finalized);
+		return initialized && !finalized;
+	}
+
+	/**
+	 * @brief Returns the rank of the current process in @c MPI_COMM_WORLD
+	 * @return Rank of the current process, @c 0 if MPI is not initialized
+	 */
+	inline int rank() CADET_NOEXCEPT
+	{
+		if (!isInitialized())
+			return 0;
+
+		int r = 0;
+		MPI_Comm_rank(MPI_COMM_WORLD, &r);
+		return r;
+	}
+
+	/**
+	 * @brief Returns the number of processes in @c MPI_COMM_WORLD
+	 * @return Number of processes, @c 1 if MPI is not initialized
+	 */
+	inline int size() CADET_NOEXCEPT
+	{
+		if (!isInitialized())
+			return 1;
+
+		int s = 1;
+		MPI_Comm_size(MPI_COMM_WORLD, &s);
+		return s;
+	}
+
+	/**
+	 * @brief Distributes contiguous segments of a vector to all processes
+	 * @details Process @c r owns the segment starting at @p displs[r] with length
+	 *          @p counts[r]. On exit, all processes hold all segments.
+	 * @param [in,out] data Vector
+	 * @param [in] counts Length of the segment of each process
+	 * @param [in] displs Offset of the segment of each process
+	 */
+	inline void allGatherSegments(double* data, int const* counts, int const* displs)
+	{
+		MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, data, counts, displs, MPI_DOUBLE, MPI_COMM_WORLD);
+	}
+
+	/**
+	 * @brief Sums a vector element-wise over all processes
+	 * @param [in,out] data Vector that is replaced by the sum over all processes
+	 * @param [in] n Number of elements
+	 */
+	inline void allReduceSum(double* data, int n)
+	{
+		MPI_Allreduce(MPI_IN_PLACE, data, n, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+	}
+
+	inline void allReduceSum(int* data, int n)
+	{
+		MPI_Allreduce(MPI_IN_PLACE, data, n, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+	}
+
+#else
+
+	inline bool isInitialized() CADET_NOEXCEPT { return false; }
+	inline int rank() CADET_NOEXCEPT { return 0; }
+	inline int size() CADET_NOEXCEPT { return 1; }
+	inline void allGatherSegments(double* data, int const* counts, int const* displs) { }
+	inline void allReduceSum(double* data, int n) { }
+	inline void allReduceSum(int* data, int n) { }
+
+#endif
+
+} // namespace mpi
+
+} // namespace cadet
+
+#endif  // LIBCADET_MPI_SUPPORT_HPP_
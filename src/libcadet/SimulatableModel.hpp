@@ -155,6 +155,21 @@ public:
 	 */
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value) = 0;
 
+	/**
+	 * @brief Collects the storage of a parameter for direct value updates
+	 * @details Appends all parameter instances that setParameter() updates for the given parameter
+	 *          (including multiplexed instances) to @p ptrs. Setting the value of all returned
+	 *          instances is equivalent to calling setParameter() with a @c double value.
+	 *          
+	 *          If setting the parameter requires further actions (e.g., updating the discretization)
+	 *          or the parameter is not found, @c false is returned and the parameter has to be set
+	 *          by setParameter(). Returned pointers are invalidated when the model is reconfigured.
+	 * @param [in] pId ParameterId that identifies the parameter uniquely
+	 * @param [in,out] ptrs List the parameter instances are appended to
+	 * @return @c true if the parameter can be set directly via the returned instances, otherwise @c false
+	 */
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs) = 0;
+
 	/**
 	 * @brief Clears all sensitive parameters
 	 */
@@ -179,6 +194,22 @@ public:
 	 */
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac) = 0;
 
+	/**
+	 * @brief Adapts the spatial discretization to the current solution
+	 * @details This function is called before notifyDiscontinuousSectionTransition() when a new section is
+	 *          about to be integrated. The model may change its spatial grid, but not the number of DOFs or the
+	 *          structure of its Jacobian. If the grid has changed, the state vector and its time derivative are
+	 *          remapped to the new grid in place. Consistent initialization is performed afterwards.
+	 *
+	 *          This function is not called if sensitivities are computed.
+	 *
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the new section that is about to be integrated
+	 * @param [in,out] simState State of the simulation (state vector and its time derivative)
+	 * @return @c true if the discretization has changed, otherwise @c false
+	 */
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState) = 0;
+
 	/**
 	 * @brief Applies initial conditions to the state vector and its time derivative
 	 * @details The initial conditions do not need to be consistent at this point. On a (discontinuous)
@@ -316,6 +347,19 @@ public:
 	 */
 	virtual double residualNorm(const SimulationTime& simTime, const ConstSimulationState& simState) = 0;
 
+	/**
+	 * @brief Multiplies a vector with the time derivative Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$ of the entire system
+	 * @details The operation @f$ z = \frac{\partial F}{\partial \dot{y}} x @f$ is performed.
+	 *          This is required by time integrators whose iteration matrix cannot be expressed as
+	 *          @f$ \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} @f$ alone.
+	 * 
+	 * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+	 * @param [in] simState State of the simulation (state vector and its time derivative)
+	 * @param [in] yS Vector @f$ x @f$ that is transformed by the Jacobian
+	 * @param [out] ret Vector @f$ z @f$ which stores the result of the operation
+	 */
+	virtual void multiplyWithDerivativeJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double* ret) = 0;
+
 	/**
 	 * @brief Computes the residual of the forward sensitivity systems
 	 * 
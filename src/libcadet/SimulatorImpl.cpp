@@ -18,6 +18,7 @@
 #include "SimulatableModel.hpp"
 #include "ParamIdUtil.hpp"
 #include "SimulationTypes.hpp"
+#include "nonlin/AndersonAcceleration.hpp"
 
 #include <idas/idas.h>
 #include <idas/idas_impl.h>
@@ -27,6 +28,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cstdlib>
+#include <cmath>
 
 #include "AutoDiff.hpp"
 #include "LoggingUtils.hpp"
@@ -346,7 +348,8 @@ namespace cadet
 		_nThreads(0), _sensErrorTestEnabled(true), _maxNewtonIter(3), _maxErrorTestFail(7), _maxConvTestFail(10),
 		_maxNewtonIterSens(3), _curSec(0), _skipConsistencyStateY(false), _skipConsistencySensitivity(false),
 		_consistentInitMode(ConsistentInitialization::Full), _consistentInitModeSens(ConsistentInitialization::Full),
-		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _notification(nullptr)
+		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _notification(nullptr),
+		_cssMaxCycles(0), _cssTol(1e-8), _cssAndersonDepth(5), _timeIntegrator(TimeIntegrator::IDAS)
 	{
 #if defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 		LOG(Debug) << "Resetting AD directions from " << ad::getDirections() << " to default " << ad::getMaxDirections();
@@ -370,6 +373,7 @@ namespace cadet
 			NVec_DestroyArray(_vecFwdYsDot, _sensitiveParams.slices());
 		}
 		_sensitiveParams.clear();
+		invalidateParameterHandles();
 
 		if (_vecStateYdot)
 			NVec_Destroy(_vecStateYdot);
@@ -479,23 +483,7 @@ namespace cadet
 				return;
 
 			N_Vector absTolTemp = NVec_New(_model->numDofs());
-			const unsigned int pureDofs = _model->numPureDofs();
-
-			// Check whether user has given us full absolute error for all (pure) DOFs
-			if (_absTol.size() >= pureDofs)
-			{
-				// Copy error tolerances for pure data
-				std::copy(_absTol.data(), _absTol.data() + pureDofs, NVEC_DATA(absTolTemp));
-
-				// Calculate error tolerances for coupling DOFs and append them
-				const std::vector<double> addAbsErrTol = _model->calculateErrorTolsForAdditionalDofs(_absTol.data(), _absTol.size());
-				std::copy(addAbsErrTol.data(), addAbsErrTol.data() + addAbsErrTol.size(), NVEC_DATA(absTolTemp) + pureDofs);
-			}
-			else
-			{
-				// We've received an expandable error specification
-				_model->expandErrorTol(_absTol.data(), _absTol.size(), NVEC_DATA(absTolTemp));
-			}
+			expandAbsoluteErrorTolerance(NVEC_DATA(absTolTemp));
 
 			IDASVtolerances(_idaMemBlock, _relTol, absTolTemp);
 			NVec_Destroy(absTolTemp);
@@ -504,6 +492,33 @@ namespace cadet
 			IDASStolerances(_idaMemBlock, _relTol, _absTol[0]);
 	}
 
+	void Simulator::expandAbsoluteErrorTolerance(double* absTol) const
+	{
+		if (_absTol.size() == 1)
+		{
+			std::fill(absTol, absTol + _model->numDofs(), _absTol[0]);
+			return;
+		}
+
+		const unsigned int pureDofs = _model->numPureDofs();
+
+		// Check whether user has given us full absolute error for all (pure) DOFs
+		if (_absTol.size() >= pureDofs)
+		{
+			// Copy error tolerances for pure data
+			std::copy(_absTol.data(), _absTol.data() + pureDofs, absTol);
+
+			// Calculate error tolerances for coupling DOFs and append them
+			const std::vector<double> addAbsErrTol = _model->calculateErrorTolsForAdditionalDofs(_absTol.data(), _absTol.size());
+			std::copy(addAbsErrTol.data(), addAbsErrTol.data() + addAbsErrTol.size(), absTol + pureDofs);
+		}
+		else
+		{
+			// We've received an expandable error specification
+			_model->expandErrorTol(_absTol.data(), _absTol.size(), absTol);
+		}
+	}
+
 	void Simulator::preFwdSensInit(unsigned int nSens)
 	{
 		// Turn off solution of sensitivity systems (this will be overridden by a call to IDASensInit below)
@@ -696,6 +711,11 @@ namespace cadet
 		_consistentInitModeSens = ci;
 	}
 
+	void Simulator::setTimeIntegrator(TimeIntegrator ti)
+	{
+		_timeIntegrator = ti;
+	}
+
 	std::unordered_map<ParameterId, double> Simulator::getAllParameterValues() const
 	{
 		std::unordered_map<ParameterId, double> data;
@@ -904,6 +924,65 @@ namespace cadet
 			_model->setParameter(id, value);
 	}
 
+	ParameterHandle Simulator::resolveParameter(const ParameterId& id)
+	{
+		// Reuse existing handle of the same parameter
+		for (std::size_t i = 0; i < _paramHandles.size(); ++i)
+		{
+			if (_paramHandles[i].id == id)
+				return static_cast<ParameterHandle>(i);
+		}
+
+		_paramHandles.push_back(ResolvedParameter{id, std::vector<active*>(), false, false});
+		return static_cast<ParameterHandle>(_paramHandles.size() - 1);
+	}
+
+	void Simulator::resolveParameterHandle(unsigned int idx)
+	{
+		ResolvedParameter& rp = _paramHandles[idx];
+		rp.ptrs.clear();
+		rp.direct = true;
+
+		if (isSectionTimeParameter(rp.id, _sectionTimes.size()))
+			rp.ptrs.push_back(&_sectionTimes[rp.id.section]);
+
+		if (_model && !_model->getParameterPointers(rp.id, rp.ptrs) && _model->hasParameter(rp.id))
+			rp.direct = false;
+
+		rp.resolved = true;
+	}
+
+	void Simulator::invalidateParameterHandles() CADET_NOEXCEPT
+	{
+		for (ResolvedParameter& rp : _paramHandles)
+			rp.resolved = false;
+	}
+
+	void Simulator::setParameterValue(ParameterHandle handle, double value)
+	{
+		if (handle >= _paramHandles.size())
+			throw InvalidParameterException("Parameter handle " + std::to_string(handle) + " exceeds number of resolved parameters (" + std::to_string(_paramHandles.size()) + ")");
+
+		if (!_paramHandles[handle].resolved)
+			resolveParameterHandle(handle);
+
+		const ResolvedParameter& rp = _paramHandles[handle];
+		if (!rp.direct)
+		{
+			setParameterValue(rp.id, value);
+			return;
+		}
+
+		for (active* p : rp.ptrs)
+			p->setValue(value);
+	}
+
+	void Simulator::setParameterValues(ParameterHandle const* handles, double const* values, unsigned int numParams)
+	{
+		for (unsigned int i = 0; i < numParams; ++i)
+			setParameterValue(handles[i], values[i]);
+	}
+
 	void Simulator::setSolutionTimes(const std::vector<double>& solutionTimes)
 	{
 		_solutionTimes = solutionTimes;
@@ -946,6 +1025,7 @@ namespace cadet
 			_sectionTimes.push_back(sectionTimes[i]);
 
 		_sectionContinuity = sectionContinuity;
+		invalidateParameterHandles();
 
 		// Set AD sensitivities
 		unsigned int globalIdx = 0;
@@ -971,6 +1051,89 @@ namespace cadet
 	}
 
 	void Simulator::integrate()
+	{
+		_cssNorms.clear();
+
+		if (_cssMaxCycles == 0)
+		{
+			integrateSections();
+			return;
+		}
+
+		integrateCyclicSteadyState();
+	}
+
+	void Simulator::configureCyclicSteadyState(unsigned int maxCycles, double tol, unsigned int andersonDepth)
+	{
+		_cssMaxCycles = maxCycles;
+		_cssTol = tol;
+		_cssAndersonDepth = andersonDepth;
+	}
+
+	void Simulator::integrateCyclicSteadyState()
+	{
+		const unsigned int nDof = NVEC_LENGTH(_vecStateY);
+		const bool wantSensitivities = _sensitiveParams.slices() > 0;
+
+		nonlin::AndersonAcceleration accel;
+		accel.resize(nDof, _cssAndersonDepth);
+
+		// Start of current cycle and cycle map value
+		std::vector<double> yStart(NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateY) + nDof);
+		std::vector<double> yEnd(nDof);
+
+		double totalTime = 0.0;
+		for (unsigned int cycle = 0; cycle < _cssMaxCycles; ++cycle)
+		{
+			const bool finished = integrateSections();
+			totalTime += _lastIntTime;
+
+			if (!finished)
+				break;
+
+			double const* const y = NVEC_DATA(_vecStateY);
+			std::copy(y, y + nDof, yEnd.begin());
+
+			double normDiff = 0.0;
+			double normEnd = 0.0;
+			for (unsigned int i = 0; i < nDof; ++i)
+			{
+				const double d = yEnd[i] - yStart[i];
+				normDiff += d * d;
+				normEnd += yEnd[i] * yEnd[i];
+			}
+			const double norm = std::sqrt(normDiff) / std::max(std::sqrt(normEnd), 1e-300);
+			_cssNorms.push_back(norm);
+
+			LOG(Debug) << "Cyclic steady state: cycle " << cycle << " norm " << norm << " (history " << accel.historySize() << ")";
+
+			if (norm <= _cssTol)
+				break;
+
+			if (cycle + 1 == _cssMaxCycles)
+			{
+				LOG(Warning) << "Cyclic steady state not reached after " << _cssMaxCycles << " cycles (norm " << norm << ")";
+				break;
+			}
+
+			// Drop the mixing history if the iteration diverges
+			if ((_cssNorms.size() >= 2) && (norm > _cssNorms[_cssNorms.size() - 2]))
+				accel.reset();
+
+			accel.next(yStart.data(), yEnd.data());
+
+			// Restart from accelerated state, time derivative is recomputed by consistent initialization
+			applyInitialCondition(yStart.data());
+
+			// Sensitivities are carried over from the end of the cycle
+			if (wantSensitivities)
+				_skipConsistencySensitivity = false;
+		}
+
+		_lastIntTime = totalTime;
+	}
+
+	bool Simulator::integrateSections()
 	{
 		// In this function the model is integrated by IDAS from the SUNDIALS package.
 		// The authors of IDAS recommend to restart the time integrator when a discontinuity
@@ -1029,12 +1192,30 @@ namespace cadet
 		// Setup AD vectors by model
 		_model->prepareADvectors(AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
 
-		std::vector<double>::const_iterator it;
-		double tOut = 0.0;
-
 		const bool writeAtUserTimes = _solutionTimes.size() > 0;
 		const bool wantSensitivities = _sensitiveParams.slices() > 0;
 
+		// Select time integrator
+		bool useRadau = (_timeIntegrator == TimeIntegrator::RadauIIA);
+		if (useRadau && wantSensitivities)
+		{
+			LOG(Warning) << "Time integrator " << to_string(_timeIntegrator) << " does not support sensitivities, falling back to " << to_string(TimeIntegrator::IDAS);
+			useRadau = false;
+		}
+
+		if (useRadau)
+		{
+			_radau.initialize(_model, [this](double t) { return getCurrentSection(t); }, AdJacobianParams{_vecADres, _vecADy, 0});
+
+			std::vector<double> absTol(_model->numDofs(), 0.0);
+			expandAbsoluteErrorTolerance(absTol.data());
+			_radau.setTolerances(_relTol, absTol.data());
+			_radau.setLimits(_maxStepSize, _maxSteps, _maxErrorTestFail, _maxConvTestFail);
+			_radau.clearStatistics();
+		}
+
+		LOG(Debug) << "Time integrator: " << to_string(useRadau ? TimeIntegrator::RadauIIA : TimeIntegrator::IDAS);
+
 		LOG(Debug) << "#MaxNewton: " << _maxNewtonIter << ", #MaxErrTestFail: " << _maxErrorTestFail << ", #MaxConvTestFail: " << _maxConvTestFail;
 		if (wantSensitivities)
 		{
@@ -1047,14 +1228,6 @@ namespace cadet
 			_model->reportSolutionStructure(*_solRecorder);
 		}
 
-		// Decide whether to use user specified solution output times (IDA_NORMAL)
-		// or internal integrator steps (IDA_ONE_STEP)
-		int idaTask = IDA_ONE_STEP;
-		if (writeAtUserTimes)
-		{
-			idaTask = IDA_NORMAL;
-		}
-
 		LOG(Debug) << "Integration span: [" << static_cast<double>(_sectionTimes[0]) << ", " << static_cast<double>(_sectionTimes.back()) << "] sections";
 
 		if (writeAtUserTimes)
@@ -1090,12 +1263,12 @@ namespace cadet
 
 			LOG(Debug) << " ###### SECTION " << _curSec << " from " << startTime << " to " << endTime;
 
-			// IDAS Step 7.3: Set the initial step size
-			const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
-			IDASetInitStep(_idaMemBlock, stepSize);
-
-			// IDAS Step 7.4: Set the stop time
-			IDASetStopTime(_idaMemBlock, endTime);
+			// Adapt spatial discretization to the current solution (state is remapped in place)
+			if (!wantSensitivities && _model->adaptDiscretization(curT, _curSec, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}))
+			{
+				LOG(Debug) << "Spatial discretization adapted, forcing consistent initialization";
+				_skipConsistencyStateY = false;
+			}
 
 			// Update Jacobian
 			_model->notifyDiscontinuousSectionTransition(curT, _curSec, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
@@ -1201,189 +1374,323 @@ namespace cadet
 				if (!_notification->timeIntegrationSection(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 				{
 					_lastIntTime = _timerIntegration.stop();
-					return;
+					return false;
 				}
 			}
 
-			// IDAS Step 5.2: Re-initialization of the solver
-			IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
-			if (wantSensitivities)
-				IDASensReInit(_idaMemBlock, IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+			// Integrate until the end of the continuous time slice
+			const bool completed = useRadau ? integrateSectionRadau(startTime, endTime, tEnd, writeAtUserTimes, curT)
+				: integrateSectionIdas(startTime, endTime, tEnd, writeAtUserTimes, curT);
+			if (!completed)
+			{
+				_lastIntTime = _timerIntegration.stop();
+				return false;
+			}
 
-			// Inititalize the IDA solver flag
-			int solverFlag = IDA_SUCCESS;
+		} // for (_sec ...)
 
-			if (writeAtUserTimes)
-			{
-				// Write initial conditions only if desired by user
-				if (_curSec == 0 && _solutionTimes.front() == curT)
-					writeSolution(curT);
+		_lastIntTime = _timerIntegration.stop();
 
-				// Initialize iterator and forward it to the first solution time that lies inside the current section
-				it = _solutionTimes.begin();
-				while ((*it) <= startTime) ++it;
-			}
-			else
-			{
-				// Always write initial conditions if solutions are written at integration times
-				if (_curSec == 0) writeSolution(curT);
+		if (useRadau)
+		{
+			const timeint::RadauStatistics& stats = _radau.statistics();
+			LOG(Debug) << "=== #Steps: " << stats.numSteps << "\n=== #Restarts: " << stats.numRestarts << "\n=== #Residual evals: " << stats.numResidualEvals
+				<< "\n=== #Jacobian evals: " << stats.numJacobianEvals << "\n=== #Error test fails: " << stats.numErrorTestFailures
+				<< "\n=== #Newton iters: " << stats.numNewtonIterations << "\n=== #Conv test fails: " << stats.numConvergenceFailures
+				<< "\n=== #GMRES iters: " << stats.numGmresIterations;
+		}
 
-				// Here tOut - only during the first call to IDASolve - specifies the direction
-				// and rough scale of the independent variable, see IDAS Guide p.33
-				tOut = endTime;
-			}
+		if (_notification)
+			_notification->timeIntegrationEnd();
+
+		return true;
+	}
+
+	bool Simulator::integrateSectionIdas(double startTime, double endTime, double tEnd, bool writeAtUserTimes, double& curT)
+	{
+		const bool wantSensitivities = _sensitiveParams.slices() > 0;
+
+		// Decide whether to use user specified solution output times (IDA_NORMAL)
+		// or internal integrator steps (IDA_ONE_STEP)
+		const int idaTask = writeAtUserTimes ? IDA_NORMAL : IDA_ONE_STEP;
+
+		std::vector<double>::const_iterator it;
+		double tOut = 0.0;
+
+		// IDAS Step 7.3: Set the initial step size
+		const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
+		IDASetInitStep(_idaMemBlock, stepSize);
+
+		// IDAS Step 7.4: Set the stop time
+		IDASetStopTime(_idaMemBlock, endTime);
+
+		// IDAS Step 5.2: Re-initialization of the solver
+		IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
+		if (wantSensitivities)
+			IDASensReInit(_idaMemBlock, IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+
+		// Inititalize the IDA solver flag
+		int solverFlag = IDA_SUCCESS;
+
+		if (writeAtUserTimes)
+		{
+			// Write initial conditions only if desired by user
+			if (_curSec == 0 && _solutionTimes.front() == curT)
+				writeSolution(curT);
 
-			// Main loop which integrates the system until reaching the end time of the current section
-			// or until an error occures
-			while ((solverFlag == IDA_SUCCESS) || (solverFlag == IDA_ROOT_RETURN))
+			// Initialize iterator and forward it to the first solution time that lies inside the current section
+			it = _solutionTimes.begin();
+			while ((*it) <= startTime) ++it;
+		}
+		else
+		{
+			// Always write initial conditions if solutions are written at integration times
+			if (_curSec == 0) writeSolution(curT);
+
+			// Here tOut - only during the first call to IDASolve - specifies the direction
+			// and rough scale of the independent variable, see IDAS Guide p.33
+			tOut = endTime;
+		}
+
+		// Main loop which integrates the system until reaching the end time of the current section
+		// or until an error occures
+		while ((solverFlag == IDA_SUCCESS) || (solverFlag == IDA_ROOT_RETURN))
+		{
+			// Update tOut if we write solutions at user specified times
+			if (writeAtUserTimes)
 			{
-				// Update tOut if we write solutions at user specified times
-				if (writeAtUserTimes)
-				{
-					// Check if user specified times are sufficiently long.
-					// otherwise integrate till IDA_TSTOP_RETURN
-					if (it == _solutionTimes.end())
-						break;
-					else
-						tOut = *it;
-				}
+				// Check if user specified times are sufficiently long.
+				// otherwise integrate till IDA_TSTOP_RETURN
+				if (it == _solutionTimes.end())
+					break;
+				else
+					tOut = *it;
+			}
 
-				// IDA Step 11: Advance solution in time
-				solverFlag = IDASolve(_idaMemBlock, tOut, &curT, _vecStateY, _vecStateYdot, idaTask);
-				LOG(Debug) << "Solve from " << curT << " to " << tOut << " => "
-					<< (solverFlag == IDA_SUCCESS ? "IDA_SUCCESS" : "") << (solverFlag == IDA_TSTOP_RETURN ? "IDA_TSTOP_RETURN" : "");
+			// IDA Step 11: Advance solution in time
+			solverFlag = IDASolve(_idaMemBlock, tOut, &curT, _vecStateY, _vecStateYdot, idaTask);
+			LOG(Debug) << "Solve from " << curT << " to " << tOut << " => "
+				<< (solverFlag == IDA_SUCCESS ? "IDA_SUCCESS" : "") << (solverFlag == IDA_TSTOP_RETURN ? "IDA_TSTOP_RETURN" : "");
 
 #ifdef CADET_DEBUG
-				{
-					long nTimeSteps = 0;
-					IDAGetNumSteps(_idaMemBlock, &nTimeSteps);
+			{
+				long nTimeSteps = 0;
+				IDAGetNumSteps(_idaMemBlock, &nTimeSteps);
 
-					double curStepSize = 0.0;
-					IDAGetCurrentStep(_idaMemBlock, &curStepSize);
+				double curStepSize = 0.0;
+				IDAGetCurrentStep(_idaMemBlock, &curStepSize);
 
-					double lastStepSize = 0.0;
-					IDAGetLastStep(_idaMemBlock, &lastStepSize);
+				double lastStepSize = 0.0;
+				IDAGetLastStep(_idaMemBlock, &lastStepSize);
 
-					long nResEvals = 0;
-					IDAGetNumResEvals(_idaMemBlock, &nResEvals);
+				long nResEvals = 0;
+				IDAGetNumResEvals(_idaMemBlock, &nResEvals);
 
-					long nErrTestFail = 0;
-					IDAGetNumErrTestFails(_idaMemBlock, &nErrTestFail);
+				long nErrTestFail = 0;
+				IDAGetNumErrTestFails(_idaMemBlock, &nErrTestFail);
 
-					long nNonLin = 0;
-					IDAGetNumNonlinSolvIters(_idaMemBlock, &nNonLin);
+				long nNonLin = 0;
+				IDAGetNumNonlinSolvIters(_idaMemBlock, &nNonLin);
 
-					long nConvFail = 0;
-					IDAGetNumNonlinSolvConvFails(_idaMemBlock, &nConvFail);
+				long nConvFail = 0;
+				IDAGetNumNonlinSolvConvFails(_idaMemBlock, &nConvFail);
 
-					LOG(Debug) << "=== #Steps: " << nTimeSteps << "\n=== #Residual evals: " << nResEvals << "\n=== #Error test fails: " << nErrTestFail
-						<< "\n=== #Newton iters: " << nNonLin << "\n=== #Conv test fails: " << nConvFail << "\n=== Last step size: " << lastStepSize
-						<< "\n=== Next step size: " << curStepSize;
+				LOG(Debug) << "=== #Steps: " << nTimeSteps << "\n=== #Residual evals: " << nResEvals << "\n=== #Error test fails: " << nErrTestFail
+					<< "\n=== #Newton iters: " << nNonLin << "\n=== #Conv test fails: " << nConvFail << "\n=== Last step size: " << lastStepSize
+					<< "\n=== Next step size: " << curStepSize;
 
-					if (wantSensitivities)
-					{
-						long nSensResEvals = 0;
-						IDAGetSensNumResEvals(_idaMemBlock, &nSensResEvals);
+				if (wantSensitivities)
+				{
+					long nSensResEvals = 0;
+					IDAGetSensNumResEvals(_idaMemBlock, &nSensResEvals);
 
-						long nSensErrTestFails = 0;
-						IDAGetSensNumErrTestFails(_idaMemBlock, &nSensErrTestFails);
+					long nSensErrTestFails = 0;
+					IDAGetSensNumErrTestFails(_idaMemBlock, &nSensErrTestFails);
 
-						long nSensNonLin = 0;
-						IDAGetSensNumNonlinSolvIters(_idaMemBlock, &nSensNonLin);
+					long nSensNonLin = 0;
+					IDAGetSensNumNonlinSolvIters(_idaMemBlock, &nSensNonLin);
 
-						long nSensConvFail = 0;
-						IDAGetSensNumNonlinSolvConvFails(_idaMemBlock, &nSensConvFail);
+					long nSensConvFail = 0;
+					IDAGetSensNumNonlinSolvConvFails(_idaMemBlock, &nSensConvFail);
 
-						LOG(Debug) << "=== #Sens residual evals: " << nSensResEvals << "\n=== #Sens error test fails: " << nSensErrTestFails
-							<< "\n=== #Sens Newton iters: " << nSensNonLin << "\n=== #Sens conv test fails: " << nSensConvFail;
-					}
+					LOG(Debug) << "=== #Sens residual evals: " << nSensResEvals << "\n=== #Sens error test fails: " << nSensErrTestFails
+						<< "\n=== #Sens Newton iters: " << nSensNonLin << "\n=== #Sens conv test fails: " << nSensConvFail;
 				}
-	#endif
-				switch (solverFlag)
+			}
+#endif
+			switch (solverFlag)
+			{
+			case IDA_SUCCESS:
+				// tOut was reached
+
+				// Extract sensitivity information from IDA (required for consistent initialization
+				// and output of sensitivities)
+				if (wantSensitivities)
 				{
-				case IDA_SUCCESS:
-					// tOut was reached
+					IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
+					IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
+				}
+				writeSolution(curT);
+
+				if (writeAtUserTimes)
+					++it;
 
-					// Extract sensitivity information from IDA (required for consistent initialization
-					// and output of sensitivities)
-					if (wantSensitivities)
+				// Notify user and check for user abort
+				if (_notification)
+				{
+					const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+					if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 					{
-						IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
-						IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
+						_lastIntTime = _timerIntegration.stop();
+						return false;
 					}
-					writeSolution(curT);
+				}
+				break;
+			case IDA_ROOT_RETURN:
+				// A root was found
+				// Eventually call some routine
+				break;
+			case IDA_TSTOP_RETURN:
+				// Extract sensitivity information from IDA (required for consistent initialization
+				// and output of sensitivities)
+				if (wantSensitivities)
+				{
+					IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
+					IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
+				}
 
-					if (writeAtUserTimes)
-						++it;
+				// Section end time was reached (in previous step)
+				if (!writeAtUserTimes && (endTime == static_cast<double>(_sectionTimes.back())))
+				{
+					// Write a solution for the ultimate endTime in the last section,
+					// when we write at integration times.
+					writeSolution(curT);
+				}
 
-					// Notify user and check for user abort
-					if (_notification)
-					{
-						const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
-						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
-						{
-							_lastIntTime = _timerIntegration.stop();
-							return;
-						}
-					}
-					break;
-				case IDA_ROOT_RETURN:
-					// A root was found
-					// Eventually call some routine
-					break;
-				case IDA_TSTOP_RETURN:
-					// Extract sensitivity information from IDA (required for consistent initialization
-					// and output of sensitivities)
-					if (wantSensitivities)
+				// Notify user and check for user abort
+				if (_notification)
+				{
+					const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+					if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
 					{
-						IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
-						IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
+						_lastIntTime = _timerIntegration.stop();
+						return false;
 					}
+				}
+				break;
+			default:
+				_lastIntTime = _timerIntegration.stop();
 
-					// Section end time was reached (in previous step)
-					if (!writeAtUserTimes && (endTime == static_cast<double>(_sectionTimes.back())))
-					{
-						// Write a solution for the ultimate endTime in the last section,
-						// when we write at integration times.
-						writeSolution(curT);
-					}
+				// An error occured
+				const std::string errorFlag = getIDAReturnFlagName(solverFlag);
+				LOG(Error) << "IDASolve returned " << errorFlag << " at t = " << curT;
 
-					// Notify user and check for user abort
-					if (_notification)
-					{
-						const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
-						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
-						{
-							_lastIntTime = _timerIntegration.stop();
-							return;
-						}
-					}
-					break;
-				default:
-					_lastIntTime = _timerIntegration.stop();
+				if (_notification)
+				{
+					const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+					_notification->timeIntegrationError(errorFlag.c_str(), _curSec, curT, progress);
+				}
+
+				throw IntegrationException(std::string("Error in IDASolve: ") + errorFlag + std::string(" at t = ") + std::to_string(curT)); //todo might not be necessary
+				break;
+			} // switch
+
+		} // while
+
+		return true;
+	}
+
+	bool Simulator::integrateSectionRadau(double startTime, double endTime, double tEnd, bool writeAtUserTimes, double& curT)
+	{
+		const unsigned int nDof = _model->numDofs();
+
+		// Radau IIA is a one-step method and restarts at full order, so the step size
+		// proposed at the end of the previous section is used if it is larger than the
+		// initial step size
+		double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
+		if (stepSize <= 0.0)
+			stepSize = 1e-6 * (endTime - startTime);
+		if (_curSec > 0)
+			stepSize = std::max(stepSize, _radau.nextStepSize());
+
+		_radau.reset(startTime, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), stepSize);
+
+		std::vector<double>::const_iterator it;
+		if (writeAtUserTimes)
+		{
+			// Write initial conditions only if desired by user
+			if (_curSec == 0 && _solutionTimes.front() == curT)
+				writeSolution(curT);
+
+			// Initialize iterator and forward it to the first solution time that lies inside the current section
+			it = _solutionTimes.begin();
+			while ((it != _solutionTimes.end()) && (*it <= startTime)) ++it;
+		}
+		else if (_curSec == 0)
+		{
+			// Always write initial conditions if solutions are written at integration times
+			writeSolution(curT);
+		}
+
+		while (curT < endTime)
+		{
+			const timeint::RadauStepResult flag = _radau.step(endTime);
+			if (flag != timeint::RadauStepResult::Success)
+			{
+				_lastIntTime = _timerIntegration.stop();
+
+				const std::string errorFlag = timeint::to_string(flag);
+				LOG(Error) << "Radau IIA returned " << errorFlag << " at t = " << _radau.time();
+
+				if (_notification)
+				{
+					const double progress = (_radau.time() - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+					_notification->timeIntegrationError(errorFlag.c_str(), _curSec, _radau.time(), progress);
+				}
+
+				throw IntegrationException(std::string("Error in Radau IIA: ") + errorFlag + std::string(" at t = ") + std::to_string(_radau.time()));
+			}
 
-					// An error occured
-					const std::string errorFlag = getIDAReturnFlagName(solverFlag);
-					LOG(Error) << "IDASolve returned " << errorFlag << " at t = " << curT;
+			curT = _radau.time();
 
+			if (writeAtUserTimes)
+			{
+				// Evaluate the collocation polynomial at all solution times covered by the last step
+				for (; (it != _solutionTimes.end()) && (*it <= curT); ++it)
+				{
+					_radau.interpolate(*it, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
+					writeSolution(*it);
+
+					// Notify user and check for user abort
 					if (_notification)
 					{
-						const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
-						_notification->timeIntegrationError(errorFlag.c_str(), _curSec, curT, progress);
+						const double progress = (*it - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+						if (!_notification->timeIntegrationStep(_curSec, *it, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
+							return false;
 					}
+				}
+			}
 
-					throw IntegrationException(std::string("Error in IDASolve: ") + errorFlag + std::string(" at t = ") + std::to_string(curT)); //todo might not be necessary
-					break;
-				} // switch
-
-			} // while
+			std::copy_n(_radau.state(), nDof, NVEC_DATA(_vecStateY));
+			std::copy_n(_radau.stateDerivative(), nDof, NVEC_DATA(_vecStateYdot));
 
-		} // for (_sec ...)
+			if (!writeAtUserTimes)
+			{
+				// The end of a section is only written in the last section
+				if ((curT < endTime) || (endTime == static_cast<double>(_sectionTimes.back())))
+					writeSolution(curT);
 
-		_lastIntTime = _timerIntegration.stop();
+				// Notify user and check for user abort
+				if (_notification)
+				{
+					const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
+					if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
+						return false;
+				}
+			}
+		}
 
-		if (_notification)
-			_notification->timeIntegrationEnd();
+		return true;
 	}
 
 	double const* Simulator::getLastSolution(unsigned int& len) const
@@ -1475,6 +1782,13 @@ namespace cadet
 		if (paramProvider.exists("MAX_NEWTON_ITER_SENS"))
 			_maxNewtonIterSens = paramProvider.getInt("MAX_NEWTON_ITER_SENS");
 
+		if (paramProvider.exists("METHOD"))
+		{
+			const std::string method = paramProvider.getString("METHOD");
+			if (!to_timeintegrator(method, _timeIntegrator))
+				throw InvalidParameterException("Unknown time integrator " + method + " in field METHOD");
+		}
+
 		paramProvider.popScope();
 
 		if (paramProvider.exists("NTHREADS"))
@@ -1496,6 +1810,22 @@ namespace cadet
 		if (paramProvider.exists("CONSISTENT_INIT_MODE_SENS"))
 			_consistentInitModeSens = toConsistentInitialization(paramProvider.getInt("CONSISTENT_INIT_MODE_SENS"));
 
+		_cssMaxCycles = 0;
+		if (paramProvider.exists("cyclic_steady_state"))
+		{
+			paramProvider.pushScope("cyclic_steady_state");
+
+			_cssMaxCycles = std::max(paramProvider.getInt("MAX_CYCLES"), 0);
+
+			if (paramProvider.exists("TOL"))
+				_cssTol = paramProvider.getDouble("TOL");
+
+			if (paramProvider.exists("ANDERSON_DEPTH"))
+				_cssAndersonDepth = std::max(paramProvider.getInt("ANDERSON_DEPTH"), 0);
+
+			paramProvider.popScope();
+		}
+
 		// @todo: Read more configuration values
 	}
 
@@ -1621,6 +1951,9 @@ namespace cadet
 		// Set all AD directions for parameter sensitivities again
 		resetSensParams();
 
+		// Parameter storage may have been reallocated
+		invalidateParameterHandles();
+
 		return success;
 	}
 
@@ -1635,6 +1968,9 @@ namespace cadet
 		// Set all AD directions for parameter sensitivities again
 		resetSensParams();
 
+		// Parameter storage may have been reallocated
+		invalidateParameterHandles();
+
 		return success;
 	}
 
@@ -28,6 +28,7 @@
 #include "AutoDiff.hpp"
 #include "SlicedVector.hpp"
 #include "common/Timer.hpp"
+#include "timeint/RadauIIA.hpp"
 
 namespace cadet
 {
@@ -69,6 +70,9 @@ public:
 	virtual void setSensitiveParameter(ParameterId const* ids, double const* diffFactors, unsigned int numParams, double absTolS);
 	virtual void setSensitiveParameter(ParameterId const* ids, unsigned int numParams, double absTolS);
 	virtual void setParameterValue(const ParameterId& id, double value);
+	virtual ParameterHandle resolveParameter(const ParameterId& id);
+	virtual void setParameterValue(ParameterHandle handle, double value);
+	virtual void setParameterValues(ParameterHandle const* handles, double const* values, unsigned int numParams);
 
 	virtual void setSolutionTimes(const std::vector<double>& solutionTimes);
 	virtual const std::vector<double>& getSolutionTimes() const;
@@ -85,6 +89,7 @@ public:
 	virtual void skipConsistentInitialization();
 	virtual void setConsistentInitialization(ConsistentInitialization ci);
 	virtual void setConsistentInitializationSens(ConsistentInitialization ci);
+	virtual void setTimeIntegrator(TimeIntegrator ti);
 
 	virtual void initializeFwdSensitivities();
 	virtual void initializeFwdSensitivities(double const * const* const initSens, double const * const* const initSensDot);
@@ -93,6 +98,9 @@ public:
 
 	virtual void integrate();
 
+	virtual void configureCyclicSteadyState(unsigned int maxCycles, double tol, unsigned int andersonDepth);
+	virtual const std::vector<double>& getCyclicSteadyStateNorms() const { return _cssNorms; }
+
 	virtual double const* getLastSolution(unsigned int& len) const;
 	virtual double const* getLastSolutionDerivative(unsigned int& len) const;
 
@@ -140,6 +148,42 @@ protected:
 	 */
 	void clearModel() CADET_NOEXCEPT;
 
+	/**
+	 * @brief Integrates the model once over all sections
+	 * @return @c true if the end of the last section has been reached, @c false if the user aborted
+	 */
+	bool integrateSections();
+
+	/**
+	 * @brief Repeats the integration over all sections until a cyclic steady state is reached
+	 * @details Uses Anderson acceleration on the map from the state at the beginning of a cycle to
+	 *          the state at its end. The convergence norm of each cycle is stored in @a _cssNorms.
+	 */
+	void integrateCyclicSteadyState();
+
+	/**
+	 * @brief Integrates a continuous time slice using IDAS
+	 * @param [in] startTime Start time of the time slice
+	 * @param [in] endTime End time of the time slice
+	 * @param [in] tEnd End time of the whole integration
+	 * @param [in] writeAtUserTimes Determines whether solutions are written at user specified times
+	 * @param [out] curT Time point reached by the time integrator
+	 * @return @c true if the end of the time slice has been reached, @c false if the user aborted
+	 */
+	bool integrateSectionIdas(double startTime, double endTime, double tEnd, bool writeAtUserTimes, double& curT);
+
+	/**
+	 * @brief Integrates a continuous time slice using the Radau IIA integrator
+	 * @details Solutions at user specified times are obtained from the collocation polynomial.
+	 * @param [in] startTime Start time of the time slice
+	 * @param [in] endTime End time of the time slice
+	 * @param [in] tEnd End time of the whole integration
+	 * @param [in] writeAtUserTimes Determines whether solutions are written at user specified times
+	 * @param [out] curT Time point reached by the time integrator
+	 * @return @c true if the end of the time slice has been reached, @c false if the user aborted
+	 */
+	bool integrateSectionRadau(double startTime, double endTime, double tEnd, bool writeAtUserTimes, double& curT);
+
 	/**
 	 * @brief Writes the solution at time point t
 	 * @param [in] t Current time point
@@ -203,6 +247,18 @@ protected:
 	 */
 	void resetSensParams();
 
+	/**
+	 * @brief Looks up the storage locations of a pre-resolved parameter
+	 * @param [in] idx Index of the parameter handle
+	 */
+	void resolveParameterHandle(unsigned int idx);
+
+	/**
+	 * @brief Marks the storage locations of all pre-resolved parameters as stale
+	 * @details This is necessary if the model or the section times have been changed.
+	 */
+	void invalidateParameterHandles() CADET_NOEXCEPT;
+
 	/**
 	 * @brief Updates the error tolerances in IDAS
 	 * @details Sets the absolute and relative error tolerances in IDAS. If the absolute error
@@ -213,6 +269,13 @@ protected:
 	 */
 	void updateMainErrorTolerances();
 
+	/**
+	 * @brief Expands the absolute error tolerances to all DOFs of the model
+	 * @details Requires a model to be present.
+	 * @param [out] absTol Absolute error tolerance of each DOF
+	 */
+	void expandAbsoluteErrorTolerance(double* absTol) const;
+
 	friend int ::cadet::residualDaeWrapper(double t, N_Vector y, N_Vector yDot, N_Vector res, void* userData);
 
 	friend int ::cadet::linearSolveWrapper(IDAMem IDA_mem, N_Vector rhs, N_Vector weight, N_Vector yCur, N_Vector yDotCur, N_Vector resCur);
@@ -246,6 +309,18 @@ protected:
 	util::SlicedVector<ParameterId> _sensitiveParams; //!< Stores (fused) sensitive parameters
 	std::vector<double> _sensitiveParamsFactor; //!< Stores the factors of the linear sensitive parameter combinations
 	std::vector<active> _sectionTimes; //!< Stores the AD variables used for SECTION_TIMES parameter derivatives
+
+	/**
+	 * @brief Pre-resolved parameter
+	 */
+	struct ResolvedParameter
+	{
+		ParameterId id; //!< Parameter id
+		std::vector<active*> ptrs; //!< Storage locations of all instances of the parameter
+		bool direct; //!< Determines whether the parameter can be set directly via @a ptrs
+		bool resolved; //!< Determines whether @a ptrs and @a direct are up to date
+	};
+	std::vector<ResolvedParameter> _paramHandles; //!< Pre-resolved parameters indexed by ParameterHandle
 	
 	double _relTolS; //!< Relative tolerance for forward sensitivity systems in the time integration
 	std::vector<double> _absTolS; //!< Absolute tolerances for forward sensitivity systems in the time integration
@@ -279,6 +354,14 @@ protected:
 	double _lastIntTime; //!< Last simulation duration
 
 	INotificationCallback* _notification; //!< Callback handler for notifications
+
+	unsigned int _cssMaxCycles; //!< Maximum number of cycles in cyclic steady state search, @c 0 disables the search
+	double _cssTol; //!< Tolerance of the cycle-to-cycle state change in cyclic steady state search
+	unsigned int _cssAndersonDepth; //!< Number of previous cycles used for Anderson mixing
+	std::vector<double> _cssNorms; //!< Cycle-to-cycle convergence norms of the last cyclic steady state search
+
+	TimeIntegrator _timeIntegrator; //!< Selected time integration method
+	timeint::RadauIIA _radau; //!< Radau IIA time integrator
 };
 
 } // namespace cadet
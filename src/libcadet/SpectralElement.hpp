@@ -0,0 +1,320 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides Legendre-Gauss-Lobatto and Gauss-Radau nodes, quadrature weights, and differentiation
+ * matrices for nodal spectral element and orthogonal collocation methods
+ */
+
+#ifndef LIBCADET_SPECTRALELEMENT_HPP_
+#define LIBCADET_SPECTRALELEMENT_HPP_
+
+#include <vector>
+#include <cmath>
+#include <utility>
+
+namespace cadet
+{
+
+namespace spectral
+{
+
+	/**
+	 * @brief Evaluates the Legendre polynomial @f$ P_N @f$ and its derivative
+	 * @param [in] N Polynomial degree
+	 * @param [in] x Evaluation point in @f$ [-1, 1] @f$
+	 * @param [out] p Value @f$ P_N(x) @f$
+	 * @param [out] dp Derivative @f$ P_N'(x) @f$
+	 */
+	inline void legendre(unsigned int N, double x, double& p, double& dp)
+	{
+		if (N == 0)
+		{
+			p = 1.0;
+			dp = 0.0;
+			return;
+		}
+
+		// Three term recurrence
+		double pPrev = 1.0;
+		double dpPrev = 0.0;
+		p = x;
+		dp = 1.0;
+		for (unsigned int k = 2; k <= N; ++k)
+		{
+			const double pNext = ((2.0 * k - 1.0) * x * p - (k - 1.0) * pPrev) / k;
+			const double dpNext = dpPrev + (2.0 * k - 1.0) * p;
+			pPrev = p;
+			p = pNext;
+			dpPrev = dp;
+			dp = dpNext;
+		}
+	}
+
+	/**
+	 * @brief Computes the Legendre-Gauss-Lobatto (LGL) nodes and quadrature weights on @f$ [-1, 1] @f$
+	 * @details The @f$ N+1 @f$ nodes are the end points @f$ \pm 1 @f$ and the roots of @f$ P_N' @f$.
+	 *          They are returned in ascending order. The interior nodes are obtained by Newton
+	 *          iteration starting from the Chebyshev-Gauss-Lobatto nodes.
+	 * @param [in] N Polynomial degree (at least 1)
+	 * @param [out] nodes LGL nodes
+	 * @param [out] weights LGL quadrature weights
+	 */
+	inline void lglNodesAndWeights(unsigned int N, std::vector<double>& nodes, std::vector<double>& weights)
+	{
+		const double pi = 3.14159265358979323846;
+		nodes.resize(N + 1);
+		weights.resize(N + 1);
+
+		nodes[0] = -1.0;
+		nodes[N] = 1.0;
+		for (unsigned int i = 1; i < N; ++i)
+		{
+			double x = -std::cos(pi * i / N);
+			for (int it = 0; it < 100; ++it)
+			{
+				// Newton iteration on (1 - x^2) P_N'(x) = N (P_{N-1}(x) - x P_N(x))
+				double p = 0.0;
+				double dp = 0.0;
+				double pm = 0.0;
+				double dpm = 0.0;
+				legendre(N, x, p, dp);
+				legendre(N - 1, x, pm, dpm);
+
+				const double f = pm - x * p;
+				const double df = dpm - p - x * dp;
+				const double dx = f / df;
+				x -= dx;
+				if (std::abs(dx) <= 1e-15)
+					break;
+			}
+			nodes[i] = x;
+		}
+
+		for (unsigned int i = 0; i <= N; ++i)
+		{
+			double p = 0.0;
+			double dp = 0.0;
+			legendre(N, nodes[i], p, dp);
+			weights[i] = 2.0 / (N * (N + 1.0) * p * p);
+		}
+	}
+
+	/**
+	 * @brief Computes the nodal differentiation matrix on the LGL nodes
+	 * @details The row-major matrix @f$ D @f$ maps nodal values of a polynomial of degree @f$ N @f$
+	 *          to the nodal values of its derivative, @f$ D_{ij} = \ell_j'(x_i) @f$.
+	 * @param [in] nodes LGL nodes in ascending order
+	 * @param [out] D Row-major differentiation matrix of size @f$ (N+1) \times (N+1) @f$
+	 */
+	inline void lglDerivativeMatrix(const std::vector<double>& nodes, std::vector<double>& D)
+	{
+		const unsigned int n = nodes.size();
+		const unsigned int N = n - 1;
+		D.assign(n * n, 0.0);
+
+		std::vector<double> pN(n);
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			double dp = 0.0;
+			legendre(N, nodes[i], pN[i], dp);
+		}
+
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			for (unsigned int j = 0; j < n; ++j)
+			{
+				if (i != j)
+					D[i * n + j] = pN[i] / (pN[j] * (nodes[i] - nodes[j]));
+			}
+		}
+
+		D[0] = -0.25 * N * (N + 1.0);
+		D[n * n - 1] = 0.25 * N * (N + 1.0);
+	}
+
+	/**
+	 * @brief Evaluates the Jacobi polynomial @f$ P_N^{(\alpha, \beta)} @f$ and its derivative
+	 * @param [in] N Polynomial degree
+	 * @param [in] alpha Parameter @f$ \alpha > -1 @f$
+	 * @param [in] beta Parameter @f$ \beta > -1 @f$
+	 * @param [in] x Evaluation point in @f$ [-1, 1] @f$
+	 * @param [out] p Value @f$ P_N^{(\alpha, \beta)}(x) @f$
+	 * @param [out] dp Derivative of @f$ P_N^{(\alpha, \beta)} @f$ at @f$ x @f$
+	 */
+	inline void jacobi(unsigned int N, double alpha, double beta, double x, double& p, double& dp)
+	{
+		if (N == 0)
+		{
+			p = 1.0;
+			dp = 0.0;
+			return;
+		}
+
+		// Three term recurrence
+		const double ab = alpha + beta;
+		double pPrev = 1.0;
+		double dpPrev = 0.0;
+		p = 0.5 * (alpha - beta + (ab + 2.0) * x);
+		dp = 0.5 * (ab + 2.0);
+		for (unsigned int k = 2; k <= N; ++k)
+		{
+			const double a1 = 2.0 * k * (k + ab) * (2.0 * k + ab - 2.0);
+			const double a2 = (2.0 * k + ab - 1.0) * (alpha * alpha - beta * beta);
+			const double a3 = (2.0 * k + ab - 2.0) * (2.0 * k + ab - 1.0) * (2.0 * k + ab);
+			const double a4 = 2.0 * (k + alpha - 1.0) * (k + beta - 1.0) * (2.0 * k + ab);
+
+			const double pNext = ((a2 + a3 * x) * p - a4 * pPrev) / a1;
+			const double dpNext = ((a2 + a3 * x) * dp + a3 * p - a4 * dpPrev) / a1;
+			pPrev = p;
+			p = pNext;
+			dpPrev = dp;
+			dp = dpNext;
+		}
+	}
+
+	/**
+	 * @brief Computes Gauss-Radau nodes and quadrature weights on @f$ [0, 1] @f$ for the weight function @f$ u^\beta @f$
+	 * @details The rule uses @f$ n @f$ nodes, the last of which is the fixed end point @f$ u = 1 @f$. The
+	 *          interior nodes are the roots of @f$ P_{n-1}^{(1, \beta)}(2u - 1) @f$, which are obtained by
+	 *          Newton iteration with deflation. The rule integrates polynomials up to degree @f$ 2n - 2 @f$
+	 *          exactly. Nodes are returned in ascending order.
+	 * @param [in] n Number of nodes (at least 1)
+	 * @param [in] beta Exponent @f$ \beta > -1 @f$ of the weight function
+	 * @param [out] nodes Quadrature nodes
+	 * @param [out] weights Quadrature weights
+	 */
+	inline void radauNodesAndWeights(unsigned int n, double beta, std::vector<double>& nodes, std::vector<double>& weights)
+	{
+		const double pi = 3.14159265358979323846;
+		const unsigned int N = n - 1;
+		nodes.resize(n);
+		weights.resize(n);
+
+		// Interior nodes on [-1, 1]
+		for (unsigned int i = 0; i < N; ++i)
+		{
+			double x = -std::cos(pi * (2.0 * i + 1.0) / (2.0 * N));
+			if (i > 0)
+				x = 0.5 * (x + nodes[i - 1]);
+
+			for (int it = 0; it < 100; ++it)
+			{
+				double p = 0.0;
+				double dp = 0.0;
+				jacobi(N, 1.0, beta, x, p, dp);
+
+				// Deflate previously found roots
+				double s = 0.0;
+				for (unsigned int j = 0; j < i; ++j)
+					s += 1.0 / (x - nodes[j]);
+
+				const double dx = p / (dp - s * p);
+				x -= dx;
+				if (std::abs(dx) <= 1e-15)
+					break;
+			}
+			nodes[i] = x;
+		}
+
+		// Map to [0, 1] and append end point
+		for (unsigned int i = 0; i < N; ++i)
+			nodes[i] = 0.5 * (nodes[i] + 1.0);
+		nodes[N] = 1.0;
+
+		// Weights from moment equations sum_j w_j u_j^k = 1 / (k + beta + 1), k = 0, ..., n-1
+		std::vector<double> mat(n * n);
+		for (unsigned int k = 0; k < n; ++k)
+		{
+			weights[k] = 1.0 / (k + beta + 1.0);
+			for (unsigned int j = 0; j < n; ++j)
+				mat[k * n + j] = std::pow(nodes[j], static_cast<double>(k));
+		}
+
+		// Gaussian elimination with partial pivoting
+		for (unsigned int c = 0; c < n; ++c)
+		{
+			unsigned int piv = c;
+			for (unsigned int r = c + 1; r < n; ++r)
+			{
+				if (std::abs(mat[r * n + c]) > std::abs(mat[piv * n + c]))
+					piv = r;
+			}
+
+			if (piv != c)
+			{
+				for (unsigned int j = 0; j < n; ++j)
+					std::swap(mat[c * n + j], mat[piv * n + j]);
+				std::swap(weights[c], weights[piv]);
+			}
+
+			for (unsigned int r = c + 1; r < n; ++r)
+			{
+				const double f = mat[r * n + c] / mat[c * n + c];
+				for (unsigned int j = c; j < n; ++j)
+					mat[r * n + j] -= f * mat[c * n + j];
+				weights[r] -= f * weights[c];
+			}
+		}
+
+		for (unsigned int c = n; c-- > 0; )
+		{
+			for (unsigned int j = c + 1; j < n; ++j)
+				weights[c] -= mat[c * n + j] * weights[j];
+			weights[c] /= mat[c * n + c];
+		}
+	}
+
+	/**
+	 * @brief Computes the nodal differentiation matrix on arbitrary distinct nodes
+	 * @details Uses the barycentric form of the Lagrange basis. The row-major matrix @f$ D @f$ satisfies
+	 *          @f$ D_{ij} = \ell_j'(x_i) @f$.
+	 * @param [in] nodes Distinct interpolation nodes
+	 * @param [out] D Row-major differentiation matrix
+	 */
+	inline void derivativeMatrix(const std::vector<double>& nodes, std::vector<double>& D)
+	{
+		const unsigned int n = nodes.size();
+		D.assign(n * n, 0.0);
+
+		std::vector<double> bw(n, 1.0);
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			for (unsigned int j = 0; j < n; ++j)
+			{
+				if (i != j)
+					bw[i] *= nodes[i] - nodes[j];
+			}
+			bw[i] = 1.0 / bw[i];
+		}
+
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			double diag = 0.0;
+			for (unsigned int j = 0; j < n; ++j)
+			{
+				if (i == j)
+					continue;
+
+				D[i * n + j] = bw[j] / (bw[i] * (nodes[i] - nodes[j]));
+				diag -= D[i * n + j];
+			}
+			D[i * n + i] = diag;
+		}
+	}
+
+} // namespace spectral
+
+} // namespace cadet
+
+#endif  // LIBCADET_SPECTRALELEMENT_HPP_
@@ -12,6 +12,8 @@
 
 #include "graph/GraphAlgos.hpp"
 
+#include <algorithm>
+
 namespace cadet
 {
 
@@ -97,6 +99,52 @@ namespace graph
 			return false;
 		}
 
+		void stronglyConnectedComponentsHelper(const cadet::util::SlicedVector<int>& adjList, int u, int& counter, std::vector<int>& index,
+			std::vector<int>& lowLink, std::vector<char>& onStack, std::vector<int>& stack, cadet::util::SlicedVector<int>& components)
+		{
+			// Assign discovery index
+			index[u] = counter;
+			lowLink[u] = counter;
+			++counter;
+
+			stack.push_back(u);
+			onStack[u] = 1;
+
+			// Iterate over adjacent nodes
+			int const* const adj = adjList[u];
+			const int nAdj = adjList.sliceSize(u);
+			for (int n = 0; n < nAdj; ++n)
+			{
+				const int nu = adj[n];
+				if (index[nu] < 0)
+				{
+					// Depth-first traversal
+					stronglyConnectedComponentsHelper(adjList, nu, counter, index, lowLink, onStack, stack, components);
+					lowLink[u] = std::min(lowLink[u], lowLink[nu]);
+				}
+				else if (onStack[nu])
+				{
+					// Node is part of the current component
+					lowLink[u] = std::min(lowLink[u], index[nu]);
+				}
+			}
+
+			// Check if u is root of a component
+			if (lowLink[u] != index[u])
+				return;
+
+			// Pop component from stack
+			components.pushBackSlice(0);
+			int v = 0;
+			do
+			{
+				v = stack.back();
+				stack.pop_back();
+				onStack[v] = 0;
+				components.pushBackInLastSlice(v);
+			} while (v != u);
+		}
+
 	} // namespace detail
 
 
@@ -123,6 +171,46 @@ namespace graph
 		return false;
 	}
 
+
+	cadet::util::SlicedVector<int> stronglyConnectedComponents(const cadet::util::SlicedVector<int>& adjList)
+	{
+		const int nUnits = adjList.slices();
+
+		cadet::util::SlicedVector<int> components;
+		components.reserve(nUnits, nUnits);
+
+		std::vector<int> index(nUnits, -1);
+		std::vector<int> lowLink(nUnits, 0);
+		std::vector<char> onStack(nUnits, 0);
+		std::vector<int> stack;
+		stack.reserve(nUnits);
+
+		int counter = 0;
+		for (int u = 0; u < nUnits; ++u)
+		{
+			// Visit node if it has not been discovered yet
+			if (index[u] >= 0)
+				continue;
+
+			detail::stronglyConnectedComponentsHelper(adjList, u, counter, index, lowLink, onStack, stack, components);
+		}
+
+		return components;
+	}
+
+
+	bool hasSelfLoop(const cadet::util::SlicedVector<int>& adjList, int u)
+	{
+		int const* const adj = adjList[u];
+		const int nAdj = adjList.sliceSize(u);
+		for (int n = 0; n < nAdj; ++n)
+		{
+			if (adj[n] == u)
+				return true;
+		}
+		return false;
+	}
+
 } // namespace graph
 
 } // namespace cadet
@@ -55,6 +55,37 @@ namespace graph
 	 */
 	bool topologicalSort(const cadet::util::SlicedVector<int>& adjList, std::vector<int>& topoOrder);
 
+	/**
+	 * @brief      Computes the strongly connected components of the given directed graph
+	 * @details    A strongly connected component is a maximal set of nodes such that
+	 *             each node can be reached from every other node of the set. Hence, all
+	 *             cycles of the graph are contained in strongly connected components.
+	 *             Contracting each component to a single node yields an acyclic graph.
+	 *
+	 *             The components are returned in reverse topological order of the
+	 *             contracted graph, that is, all nodes a component depends on are
+	 *             contained in components listed after it (last component has to be
+	 *             processed first).
+	 *
+	 *             Based on Tarjan, Depth-first search and linear graph algorithms,
+	 *             SIAM J. Comput. 1 (1972).
+	 *
+	 * @param[in]  adjList    List of adjacent nodes for each node, see adjacencyListFromConnectionList()
+	 *
+	 * @return     Strongly connected components, each slice contains the nodes of one component
+	 */
+	cadet::util::SlicedVector<int> stronglyConnectedComponents(const cadet::util::SlicedVector<int>& adjList);
+
+	/**
+	 * @brief      Checks whether the given node is connected to itself
+	 *
+	 * @param[in]  adjList    List of adjacent nodes for each node, see adjacencyListFromConnectionList()
+	 * @param[in]  u          Node
+	 *
+	 * @return     @c true if the node has an edge to itself, @c false otherwise
+	 */
+	bool hasSelfLoop(const cadet::util::SlicedVector<int>& adjList, int u);
+
 } // namespace graph
 
 } // namespace cadet
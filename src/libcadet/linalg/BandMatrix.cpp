@@ -216,6 +216,14 @@ bool FactorizableBandMatrix::factorize()
 	lapackInt_t ldab = stride();
 	lapackInt_t flag = 0;
 
+	if (_mixedPrecision)
+	{
+		// Factorize a single precision copy and keep the original matrix for iterative refinement
+		_factorsSingle.assign(_data, _data + stride() * _rows);
+		LapackFactorDenseBandedSingle(&n, &n, &kl, &ku, _factorsSingle.data(), &ldab, _pivot, &flag);
+		return flag == 0;
+	}
+
 	LapackFactorDenseBanded(&n, &n, &kl, &ku, _data, &ldab, _pivot, &flag);
 
 	// If the flag is -i (for i > 0), the ith argument is invalid
@@ -225,6 +233,33 @@ bool FactorizableBandMatrix::factorize()
 
 bool FactorizableBandMatrix::solve(double* rhs) const
 {
+	if (_mixedPrecision)
+	{
+		// Keep right hand side for computing residuals
+		_refinementWork.resize(2 * _rows);
+		double* const b = _refinementWork.data();
+		double* const r = b + _rows;
+		std::copy_n(rhs, _rows, b);
+
+		if (!solveSingle(rhs))
+			return false;
+
+		// Iterative refinement: x = x + A^{-1} (b - A x) with residual in double precision
+		for (unsigned int step = 0; step < _refinementSteps; ++step)
+		{
+			std::copy_n(b, _rows, r);
+			multiplyVector(rhs, -1.0, 1.0, r);
+
+			if (!solveSingle(r))
+				return false;
+
+			for (int i = 0; i < _rows; ++i)
+				rhs[i] += r[i];
+		}
+
+		return true;
+	}
+
 	// Since LAPACK uses column-major storage and we use row-major,
 	// we actually have constructed the transposed matrix. Thus,
 	// upper and lower diagonals interchange.
@@ -245,6 +280,23 @@ bool FactorizableBandMatrix::solve(double* rhs) const
 	return flag == 0;
 }
 
+bool FactorizableBandMatrix::solveSingle(double* rhs) const
+{
+	lapackInt_t n = _rows;
+	lapackInt_t kl = _upperBand;
+	lapackInt_t ku = _lowerBand;
+	lapackInt_t nrhs = 1;
+	lapackInt_t ldab = stride();
+	lapackInt_t flag = 0;
+	char trans[] = "T";
+
+	_rhsSingle.assign(rhs, rhs + _rows);
+	LapackSolveDenseBandedSingle(trans, &n, &kl, &ku, &nrhs, const_cast<float*>(_factorsSingle.data()), &ldab, const_cast<lapackInt_t*>(_pivot), _rhsSingle.data(), &n, &flag);
+	std::copy(_rhsSingle.begin(), _rhsSingle.end(), rhs);
+
+	return flag == 0;
+}
+
 bool FactorizableBandMatrix::solve(double const* scalingFactors, double* rhs) const
 {
 	for (int i = 0; i < _rows; ++i)
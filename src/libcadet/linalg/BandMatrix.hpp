@@ -24,6 +24,7 @@
 
 #include <ostream>
 #include <algorithm>
+#include <vector>
 
 namespace cadet
 {
@@ -964,6 +965,10 @@ std::ostream& operator<<(std::ostream& out, const BandMatrix& bm);
  *          LAPACK needs additional space to hold intermediate values when calling a
  *          factorization routine. This space, and the required pivoting arrays, are
  *          also stored in this class.
+ *
+ *          In mixed precision mode (see setMixedPrecision()), the matrix is factorized in
+ *          single precision and the original matrix is kept in double precision. Solutions
+ *          are improved by iterative refinement against the double precision matrix.
 * @todo Refactor and combine code with BandMatrix in order to save LOC
   */
 class FactorizableBandMatrix
@@ -979,7 +984,8 @@ public:
 	 * @brief Creates an empty, unitialized band matrix
 	 * @details No memory is allocated for the matrix. Users have to call resize() first.
 	 */
-	FactorizableBandMatrix() CADET_NOEXCEPT : _data(nullptr), _lowerBand(0), _upperBand(0), _rows(0), _capacity(0), _pivot(nullptr) { }
+	FactorizableBandMatrix() CADET_NOEXCEPT : _data(nullptr), _lowerBand(0), _upperBand(0), _rows(0), _capacity(0), _pivot(nullptr),
+		_mixedPrecision(false), _refinementSteps(0) { }
 	~FactorizableBandMatrix() CADET_NOEXCEPT
 	{
 		delete[] _pivot;
@@ -987,14 +993,16 @@ public:
 	}
 
 	FactorizableBandMatrix(const FactorizableBandMatrix& cpy) : _data(new double[cpy.stride() * cpy._rows]),
-		_lowerBand(cpy._lowerBand), _upperBand(cpy._upperBand), _rows(cpy._rows), _capacity(cpy._capacity), _pivot(new lapackInt_t[cpy._rows])
+		_lowerBand(cpy._lowerBand), _upperBand(cpy._upperBand), _rows(cpy._rows), _capacity(cpy._capacity), _pivot(new lapackInt_t[cpy._rows]),
+		_mixedPrecision(cpy._mixedPrecision), _refinementSteps(cpy._refinementSteps), _factorsSingle(cpy._factorsSingle)
 	{
 		copyValues(cpy._data);
 		copyPivot(cpy._pivot);
 	}
 
 	FactorizableBandMatrix(FactorizableBandMatrix&& cpy) CADET_NOEXCEPT : _data(cpy._data), _lowerBand(cpy._lowerBand), _upperBand(cpy._upperBand),
-		_rows(cpy._rows), _capacity(cpy._capacity), _pivot(cpy._pivot)
+		_rows(cpy._rows), _capacity(cpy._capacity), _pivot(cpy._pivot), _mixedPrecision(cpy._mixedPrecision), _refinementSteps(cpy._refinementSteps),
+		_factorsSingle(std::move(cpy._factorsSingle))
 	{
 		cpy._data = nullptr;
 		cpy._pivot = nullptr;
@@ -1023,6 +1031,10 @@ public:
 		_pivot = new lapackInt_t[_rows];
 		copyPivot(cpy._pivot);
 
+		_mixedPrecision = cpy._mixedPrecision;
+		_refinementSteps = cpy._refinementSteps;
+		_factorsSingle = cpy._factorsSingle;
+
 		return *this;
 	}
 
@@ -1041,6 +1053,10 @@ public:
 		_pivot = cpy._pivot;
 		cpy._pivot = nullptr;
 
+		_mixedPrecision = cpy._mixedPrecision;
+		_refinementSteps = cpy._refinementSteps;
+		_factorsSingle = std::move(cpy._factorsSingle);
+
 		return *this;
 	}
 
@@ -1324,10 +1340,39 @@ public:
 
 	/**
 	 * @brief Factorizes the BandMatrix using LAPACK (performs LU factorization)
+	 * @details In mixed precision mode, the LU factors are computed in single precision and
+	 *          the matrix itself is left unchanged.
 	 * @return @c true if the factorization was successful, otherwise @c false
 	 */
 	bool factorize();
 
+	/**
+	 * @brief Enables or disables mixed precision factorization
+	 * @details In mixed precision mode, the matrix is factorized in single precision, which halves
+	 *          the memory traffic of factorization and solution. The solution is improved by
+	 *          @p refinementSteps steps of iterative refinement, which compute the residual with
+	 *          the original matrix in double precision. The matrix is not overwritten by its factors
+	 *          in this mode.
+	 *
+	 *          Iterative refinement converges if the condition number of the matrix is well below
+	 *          the inverse of the single precision machine epsilon (about @f$ 10^7 @f$).
+	 * @param [in] enabled Determines whether mixed precision is used
+	 * @param [in] refinementSteps Number of iterative refinement steps
+	 */
+	inline void setMixedPrecision(bool enabled, unsigned int refinementSteps)
+	{
+		_mixedPrecision = enabled;
+		_refinementSteps = refinementSteps;
+		if (!enabled)
+			_factorsSingle.clear();
+	}
+
+	/**
+	 * @brief Returns whether mixed precision factorization is used
+	 * @return @c true if the matrix is factorized in single precision, otherwise @c false
+	 */
+	inline bool mixedPrecision() const CADET_NOEXCEPT { return _mixedPrecision; }
+
 	/**
 	 * @brief Uses the factorized matrix to solve the equation @f$ Ax = b @f$ with LAPACK
 	 * @details Before the equation can be solved, the matrix has to be factorized first by calling factorize().
@@ -1388,6 +1433,14 @@ protected:
 	int _capacity; //!< Allocated memory in sizeof(double)
 	lapackInt_t* _pivot; //!< Pointer to an array which is used for pivoting by factorization methods
 
+	bool _mixedPrecision; //!< Determines whether the matrix is factorized in single precision
+	unsigned int _refinementSteps; //!< Number of iterative refinement steps in mixed precision mode
+	std::vector<float> _factorsSingle; //!< LU factors in single precision (mixed precision mode)
+	mutable std::vector<float> _rhsSingle; //!< Right hand side in single precision (mixed precision mode)
+	mutable std::vector<double> _refinementWork; //!< Right hand side and residual for iterative refinement (mixed precision mode)
+
+	bool solveSingle(double* rhs) const;
+
 	/**
 	 * @brief Returns the total number of elements in a row including additional storage for factorization
 	 * @param [in] lowerBand Number of lower diagonals (excluding the main diagonal)
@@ -0,0 +1,182 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "linalg/BatchedBandMatrix.hpp"
+
+#include <cmath>
+#include <algorithm>
+#include <utility>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+bool BatchedBandMatrix::factorize()
+{
+	const int nb = _batchSize;
+	const int n = _rows;
+
+	for (int j = 0; j < n; ++j)
+	{
+		// Number of subdiagonal elements in current column
+		const int km = std::min(_lowerBand, n - 1 - j);
+
+		// Last column affected by the elimination step, which includes fill-in from pivoting
+		const int ju = std::min(j + _lowerBand + _upperBand, n - 1);
+
+		// Find pivot and interchange rows in each block separately
+		for (int k = 0; k < nb; ++k)
+		{
+			int pivotOffset = 0;
+			double maxVal = std::abs(element(j, j)[k]);
+			for (int i = 1; i <= km; ++i)
+			{
+				const double val = std::abs(element(j + i, j)[k]);
+				if (val > maxVal)
+				{
+					maxVal = val;
+					pivotOffset = i;
+				}
+			}
+
+			if (maxVal == 0.0)
+				return false;
+
+			_pivot[static_cast<std::size_t>(j) * nb + k] = j + pivotOffset;
+			if (pivotOffset != 0)
+			{
+				for (int col = j; col <= ju; ++col)
+					std::swap(element(j, col)[k], element(j + pivotOffset, col)[k]);
+			}
+		}
+
+		// Compute multipliers (column of L)
+		double const* const pivotElem = element(j, j);
+		for (int i = 1; i <= km; ++i)
+		{
+			double* const mult = element(j + i, j);
+			for (int k = 0; k < nb; ++k)
+				mult[k] /= pivotElem[k];
+		}
+
+		// Update trailing submatrix
+		for (int col = j + 1; col <= ju; ++col)
+		{
+			double const* const pivotRow = element(j, col);
+			for (int i = 1; i <= km; ++i)
+			{
+				double const* const mult = element(j + i, j);
+				double* const target = element(j + i, col);
+				for (int k = 0; k < nb; ++k)
+					target[k] -= mult[k] * pivotRow[k];
+			}
+		}
+	}
+
+	return true;
+}
+
+bool BatchedBandMatrix::solve(double* rhs, int blockStride) const
+{
+	const int nb = _batchSize;
+	const int n = _rows;
+	double* const b = _rhsWork.data();
+
+	// Gather right hand sides into interleaved storage
+	for (int k = 0; k < nb; ++k)
+	{
+		double const* const src = rhs + static_cast<std::size_t>(k) * blockStride;
+		for (int i = 0; i < n; ++i)
+			b[static_cast<std::size_t>(i) * nb + k] = src[i];
+	}
+
+	// Forward substitution with L and row interchanges
+	for (int j = 0; j < n; ++j)
+	{
+		double* const bj = b + static_cast<std::size_t>(j) * nb;
+		int const* const piv = _pivot.data() + static_cast<std::size_t>(j) * nb;
+		for (int k = 0; k < nb; ++k)
+		{
+			if (piv[k] != j)
+				std::swap(bj[k], b[static_cast<std::size_t>(piv[k]) * nb + k]);
+		}
+
+		const int km = std::min(_lowerBand, n - 1 - j);
+		for (int i = 1; i <= km; ++i)
+		{
+			double const* const mult = element(j + i, j);
+			double* const bi = bj + static_cast<std::size_t>(i) * nb;
+			for (int k = 0; k < nb; ++k)
+				bi[k] -= mult[k] * bj[k];
+		}
+	}
+
+	// Backward substitution with U, which has lowerBand + upperBand superdiagonals
+	for (int j = n - 1; j >= 0; --j)
+	{
+		double* const bj = b + static_cast<std::size_t>(j) * nb;
+		double const* const diag = element(j, j);
+		for (int k = 0; k < nb; ++k)
+			bj[k] /= diag[k];
+
+		for (int i = std::max(0, j - _lowerBand - _upperBand); i < j; ++i)
+		{
+			double const* const upper = element(i, j);
+			double* const bi = b + static_cast<std::size_t>(i) * nb;
+			for (int k = 0; k < nb; ++k)
+				bi[k] -= upper[k] * bj[k];
+		}
+	}
+
+	// Scatter solution back
+	for (int k = 0; k < nb; ++k)
+	{
+		double* const dest = rhs + static_cast<std::size_t>(k) * blockStride;
+		for (int i = 0; i < n; ++i)
+			dest[i] = b[static_cast<std::size_t>(i) * nb + k];
+	}
+
+	return true;
+}
+
+bool BatchedBandMatrix::solve(int blk, double* rhs) const
+{
+	const int n = _rows;
+
+	// Forward substitution with L and row interchanges
+	for (int j = 0; j < n; ++j)
+	{
+		const int piv = _pivot[static_cast<std::size_t>(j) * _batchSize + blk];
+		if (piv != j)
+			std::swap(rhs[j], rhs[piv]);
+
+		const int km = std::min(_lowerBand, n - 1 - j);
+		for (int i = 1; i <= km; ++i)
+			rhs[j + i] -= element(j + i, j)[blk] * rhs[j];
+	}
+
+	// Backward substitution with U
+	for (int j = n - 1; j >= 0; --j)
+	{
+		rhs[j] /= element(j, j)[blk];
+		for (int i = std::max(0, j - _lowerBand - _upperBand); i < j; ++i)
+			rhs[i] -= element(i, j)[blk] * rhs[j];
+	}
+
+	return true;
+}
+
+}  // namespace linalg
+
+}  // namespace cadet
@@ -0,0 +1,209 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a batch of banded matrices with identical structure stored interleaved
+ */
+
+#ifndef LIBCADET_BATCHEDBANDMATRIX_HPP_
+#define LIBCADET_BATCHEDBANDMATRIX_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "common/CompilerSpecific.hpp"
+
+#include <vector>
+#include <algorithm>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+/**
+ * @brief Batch of square banded matrices with identical size and bandwidths
+ * @details All matrices (blocks) of the batch are stored interleaved, that is, the same element
+ *          of all blocks is stored contiguously in memory (block index runs fastest). The LU
+ *          factorization with partial pivoting and the forward / backward substitution are
+ *          performed for all blocks simultaneously. Since the innermost loops run over the
+ *          blocks, they are easily vectorized by the compiler.
+ *
+ *          Each block is stored in LAPACK's banded column-major format with additional space
+ *          for fill-in created by pivoting. Element @f$ (i,j) @f$ of block @f$ k @f$ is
+ *          located at @f$ \left( j \cdot \text{ld} + k_l + k_u + i - j \right) \cdot n_b + k @f$,
+ *          where @f$ \text{ld} = 2 k_l + k_u + 1 @f$ is the stride of a column and @f$ n_b @f$
+ *          is the number of blocks.
+ *
+ *          Values are set block by block from a BandMatrix or FactorizableBandMatrix using
+ *          copyBlock(). After factorize() has been called, the matrix contents are replaced
+ *          by their LU factorizations.
+ */
+class BatchedBandMatrix
+{
+public:
+
+	BatchedBandMatrix() : _batchSize(0), _rows(0), _lowerBand(0), _upperBand(0) { }
+
+	/**
+	 * @brief Resizes the batch and its matrices
+	 * @details All elements are set to @c 0.
+	 * @param [in] batchSize Number of matrices in the batch
+	 * @param [in] rows Number of rows (and columns) of each matrix
+	 * @param [in] lowerBand Number of lower diagonals
+	 * @param [in] upperBand Number of upper diagonals
+	 */
+	inline void resize(int batchSize, int rows, int lowerBand, int upperBand)
+	{
+		_batchSize = batchSize;
+		_rows = rows;
+		_lowerBand = lowerBand;
+		_upperBand = upperBand;
+
+		_data.assign(static_cast<std::size_t>(_batchSize) * _rows * stride(), 0.0);
+		_pivot.assign(static_cast<std::size_t>(_batchSize) * _rows, 0);
+		_rhsWork.resize(static_cast<std::size_t>(_batchSize) * _rows);
+	}
+
+	/**
+	 * @brief Copies a single banded matrix into a block of the batch
+	 * @details The source matrix has to have the same number of rows. Its bandwidths must not
+	 *          exceed the bandwidths of the batch. Fill-in elements of the block are reset.
+	 * @param [in] blk Index of the block
+	 * @param [in] src Source matrix, either a BandMatrix or a FactorizableBandMatrix
+	 * @tparam MatrixType Type of the source matrix
+	 */
+	template <class MatrixType>
+	inline void copyBlock(int blk, const MatrixType& src)
+	{
+		cadet_assert(src.rows() == _rows);
+		cadet_assert(src.lowerBandwidth() <= _lowerBand);
+		cadet_assert(src.upperBandwidth() <= _upperBand);
+
+		const int nElem = _rows * stride();
+		for (int i = 0; i < nElem; ++i)
+			_data[static_cast<std::size_t>(i) * _batchSize + blk] = 0.0;
+
+		const int lb = src.lowerBandwidth();
+		const int ub = src.upperBandwidth();
+		for (int row = 0; row < _rows; ++row)
+		{
+			const int firstDiag = std::max(-lb, -row);
+			const int lastDiag = std::min(ub, _rows - 1 - row);
+			for (int diag = firstDiag; diag <= lastDiag; ++diag)
+				element(row, row + diag)[blk] = src.centered(row, diag);
+		}
+	}
+
+	/**
+	 * @brief Returns an element of a block
+	 * @param [in] blk Index of the block
+	 * @param [in] row Row index
+	 * @param [in] col Column index, has to be within the band (including fill-in)
+	 * @return Element of the block
+	 */
+	inline double operator()(int blk, int row, int col) const { return element(row, col)[blk]; }
+
+	/**
+	 * @brief Factorizes all matrices of the batch using LU decomposition with partial pivoting
+	 * @details The matrices are overwritten by their factorizations.
+	 * @return @c true if all matrices have been factorized successfully, otherwise @c false
+	 */
+	bool factorize();
+
+	/**
+	 * @brief Solves the linear systems of all blocks
+	 * @details The right hand sides of all blocks are expected to be stored one after another
+	 *          with a fixed distance of @p blockStride elements. They are overwritten by the
+	 *          solutions. Uses internal work memory, so this function must not be called
+	 *          concurrently on the same object.
+	 *
+	 *          The matrices have to be factorized before by calling factorize().
+	 * @param [in,out] rhs Pointer to the right hand side of the first block, overwritten by the solution
+	 * @param [in] blockStride Distance between the right hand sides of two consecutive blocks
+	 * @return @c true if the systems have been solved successfully, otherwise @c false
+	 */
+	bool solve(double* rhs, int blockStride) const;
+
+	/**
+	 * @brief Solves the linear system of a single block
+	 * @details The matrices have to be factorized before by calling factorize().
+	 * @param [in] blk Index of the block
+	 * @param [in,out] rhs Right hand side of the block, overwritten by the solution
+	 * @return @c true if the system has been solved successfully, otherwise @c false
+	 */
+	bool solve(int blk, double* rhs) const;
+
+	/**
+	 * @brief Returns the number of matrices in the batch
+	 * @return Number of matrices
+	 */
+	inline int batchSize() const CADET_NOEXCEPT { return _batchSize; }
+
+	/**
+	 * @brief Returns the number of rows of each matrix
+	 * @return Number of rows
+	 */
+	inline int rows() const CADET_NOEXCEPT { return _rows; }
+
+	/**
+	 * @brief Returns the number of lower diagonals
+	 * @return Number of lower diagonals
+	 */
+	inline int lowerBandwidth() const CADET_NOEXCEPT { return _lowerBand; }
+
+	/**
+	 * @brief Returns the number of upper diagonals
+	 * @return Number of upper diagonals
+	 */
+	inline int upperBandwidth() const CADET_NOEXCEPT { return _upperBand; }
+
+	/**
+	 * @brief Returns the number of stored elements per column of a single matrix
+	 * @details Includes the space required for fill-in.
+	 * @return Stride of a column
+	 */
+	inline int stride() const CADET_NOEXCEPT { return 2 * _lowerBand + _upperBand + 1; }
+
+protected:
+
+	/**
+	 * @brief Returns a pointer to the given element of the first block
+	 * @details The same element of the other blocks directly follows.
+	 * @param [in] row Row index
+	 * @param [in] col Column index
+	 * @return Pointer to the element
+	 */
+	inline double* element(int row, int col)
+	{
+		return _data.data() + (static_cast<std::size_t>(col) * stride() + _lowerBand + _upperBand + row - col) * _batchSize;
+	}
+
+	inline double const* element(int row, int col) const
+	{
+		return _data.data() + (static_cast<std::size_t>(col) * stride() + _lowerBand + _upperBand + row - col) * _batchSize;
+	}
+
+	int _batchSize; //!< Number of matrices
+	int _rows; //!< Number of rows of each matrix
+	int _lowerBand; //!< Number of lower diagonals
+	int _upperBand; //!< Number of upper diagonals
+	std::vector<double> _data; //!< Interleaved matrix elements (block index runs fastest)
+	std::vector<int> _pivot; //!< Interleaved pivot rows (block index runs fastest)
+	mutable std::vector<double> _rhsWork; //!< Interleaved right hand sides used in solve()
+};
+
+} // namespace linalg
+
+} // namespace cadet
+
+#endif  // LIBCADET_BATCHEDBANDMATRIX_HPP_
@@ -0,0 +1,135 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a small least-recently-used cache of factorized matrices
+ */
+
+#ifndef LIBCADET_FACTORIZATIONCACHE_HPP_
+#define LIBCADET_FACTORIZATIONCACHE_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace cadet
+{
+
+namespace linalg
+{
+
+/**
+ * @brief Least-recently-used cache of factorized matrices keyed by a scalar
+ * @details If the Jacobian of a system is constant, the factorization of the time-discretized
+ *          Jacobian @f$ J + \alpha M @f$ only depends on the BDF factor @f$ \alpha @f$. This
+ *          class stores copies of a few factorizations along with their @f$ \alpha @f$ such that
+ *          they can be reused instead of assembling and factorizing the matrix again.
+ *
+ *          Keys are compared exactly. The most recently used entry is kept in front, the least
+ *          recently used one is evicted if the capacity is exceeded.
+ * @tparam MatrixType Type of the factorized matrix, has to be copy-assignable
+ */
+template <class MatrixType>
+class FactorizationCache
+{
+public:
+
+	FactorizationCache() : _capacity(0) { }
+
+	/**
+	 * @brief Sets the maximum number of cached factorizations
+	 * @details Least recently used entries are dropped if the cache holds more entries.
+	 * @param [in] capacity Maximum number of cached factorizations, @c 0 disables the cache
+	 */
+	inline void setCapacity(unsigned int capacity)
+	{
+		_capacity = capacity;
+		if (_entries.size() > _capacity)
+			_entries.resize(_capacity);
+	}
+
+	/**
+	 * @brief Returns the maximum number of cached factorizations
+	 * @return Maximum number of cached factorizations
+	 */
+	inline unsigned int capacity() const CADET_NOEXCEPT { return _capacity; }
+
+	/**
+	 * @brief Returns the number of cached factorizations
+	 * @return Number of cached factorizations
+	 */
+	inline unsigned int size() const CADET_NOEXCEPT { return _entries.size(); }
+
+	/**
+	 * @brief Removes all cached factorizations
+	 * @details The memory of the entries is released.
+	 */
+	inline void clear() { _entries.clear(); }
+
+	/**
+	 * @brief Looks up the factorization belonging to the given key
+	 * @details On success, the entry is marked as most recently used.
+	 * @param [in] key Key of the factorization
+	 * @return Pointer to the factorized matrix or @c nullptr if the key is not cached
+	 */
+	inline const MatrixType* find(double key)
+	{
+		for (std::size_t i = 0; i < _entries.size(); ++i)
+		{
+			if (_entries[i].first != key)
+				continue;
+
+			// Move entry to front
+			std::rotate(_entries.begin(), _entries.begin() + i, _entries.begin() + i + 1);
+			return &_entries.front().second;
+		}
+		return nullptr;
+	}
+
+	/**
+	 * @brief Stores a copy of the given factorization
+	 * @details The new entry is marked as most recently used. If the cache is full, the memory of
+	 *          the least recently used entry is reused.
+	 * @param [in] key Key of the factorization
+	 * @param [in] mat Factorized matrix
+	 * @return Pointer to the cached copy or @c nullptr if the cache is disabled
+	 */
+	inline const MatrixType* insert(double key, const MatrixType& mat)
+	{
+		if (_capacity == 0)
+			return nullptr;
+
+		if (_entries.size() < _capacity)
+			_entries.emplace_back(key, mat);
+		else
+		{
+			_entries.back().first = key;
+			_entries.back().second = mat;
+		}
+
+		std::rotate(_entries.begin(), _entries.end() - 1, _entries.end());
+		return &_entries.front().second;
+	}
+
+protected:
+	unsigned int _capacity; //!< Maximum number of entries
+	std::vector<std::pair<double, MatrixType>> _entries; //!< Cached factorizations with their keys, most recently used first
+};
+
+} // namespace linalg
+
+} // namespace cadet
+
+#endif  // LIBCADET_FACTORIZATIONCACHE_HPP_
@@ -236,6 +236,15 @@ public:
 	 */
 	virtual bool dependsOnTime() const CADET_NOEXCEPT = 0;
 
+	/**
+	 * @brief Returns whether the Jacobian of the binding fluxes is constant
+	 * @details The Jacobian is constant if the fluxes are affine in the state and their
+	 *          coefficients neither depend on time nor on the position (e.g., via external
+	 *          functions). Unit operations may use this to reuse Jacobians and their factorizations.
+	 * @return @c true if the Jacobian is constant, otherwise @c false
+	 */
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT = 0;
+
 	/**
 	 * @brief Returns whether this binding model requires workspace
 	 * @details The workspace may be required for consistent initialization and / or evaluation
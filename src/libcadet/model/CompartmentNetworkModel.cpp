@@ -0,0 +1,1888 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "model/CompartmentNetworkModel.hpp"
+#include "ParamReaderHelper.hpp"
+#include "cadet/Exceptions.hpp"
+#include "cadet/ExternalFunction.hpp"
+#include "cadet/SolutionRecorder.hpp"
+#include "ConfigurationHelper.hpp"
+#include "model/BindingModel.hpp"
+#include "model/ReactionModel.hpp"
+#include "SimulationTypes.hpp"
+#include "linalg/DenseMatrix.hpp"
+#include "linalg/BandMatrix.hpp"
+#include "linalg/Norms.hpp"
+#include "linalg/Subset.hpp"
+#include "model/parts/BindingCellKernel.hpp"
+
+#include "AdUtils.hpp"
+
+#include "LoggingUtils.hpp"
+#include "Logging.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "ParallelSupport.hpp"
+#ifdef CADET_PARALLELIZE
+	#include <tbb/parallel_for.h>
+#endif
+
+namespace cadet
+{
+
+namespace model
+{
+
+CompartmentNetworkModel::CompartmentNetworkModel(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
+	_outletCompartment(0), _porosity(1.0), _flowRateIn(0.0), _flowRateOut(0.0), _jacDiscFactorized(&_jacDisc), _constJacobian(false),
+	_jacobianCurrent(false), _checkJacobianCache(false), _jacFlowRateOut(0.0), _jacInlet(), _analyticJac(true), _jacobianAdDirs(0),
+	_factorizeJacobian(false), _tempState(nullptr), _initC(0), _initQ(0), _initState(0), _initStateDot(0)
+{
+	// All compartments share the same binding and reaction model
+	_singleBinding = true;
+	_singleDynReaction = true;
+
+	_disc.nBound = nullptr;
+	_disc.boundOffset = nullptr;
+}
+
+CompartmentNetworkModel::~CompartmentNetworkModel() CADET_NOEXCEPT
+{
+	delete[] _tempState;
+
+	delete[] _disc.nBound;
+	delete[] _disc.boundOffset;
+}
+
+unsigned int CompartmentNetworkModel::numDofs() const CADET_NOEXCEPT
+{
+	// Compartment DOFs: nCompartment * nComp mobile phase and nCompartment * (sum boundStates) solid phase
+	// Inlet DOFs: nComp
+	return _disc.nCompartment * (_disc.nComp + _disc.strideBound) + _disc.nComp;
+}
+
+unsigned int CompartmentNetworkModel::numPureDofs() const CADET_NOEXCEPT
+{
+	// Compartment DOFs: nCompartment * nComp mobile phase and nCompartment * (sum boundStates) solid phase
+	return _disc.nCompartment * (_disc.nComp + _disc.strideBound);
+}
+
+bool CompartmentNetworkModel::usesAD() const CADET_NOEXCEPT
+{
+#ifdef CADET_CHECK_ANALYTIC_JACOBIAN
+	// We always need AD if we want to check the analytical Jacobian
+	return true;
+#else
+	// We only need AD if we are not computing the Jacobian analytically
+	return !_analyticJac;
+#endif
+}
+
+bool CompartmentNetworkModel::configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper)
+{
+	// ==== Read discretization
+	_disc.nComp = paramProvider.getInt("NCOMP");
+
+	std::vector<int> nBound(_disc.nComp, 0);
+	if (paramProvider.exists("NBOUND"))
+		nBound = paramProvider.getIntArray("NBOUND");
+
+	if (nBound.size() < _disc.nComp)
+		throw InvalidParameterException("Field NBOUND contains too few elements (NCOMP = " + std::to_string(_disc.nComp) + " required)");
+
+	_disc.nBound = new unsigned int[_disc.nComp];
+	std::copy_n(nBound.begin(), _disc.nComp, _disc.nBound);
+
+	// Precompute offsets and total number of bound states (DOFs in solid phase)
+	_disc.boundOffset = new unsigned int[_disc.nComp];
+	_disc.boundOffset[0] = 0;
+	for (unsigned int i = 1; i < _disc.nComp; ++i)
+	{
+		_disc.boundOffset[i] = _disc.boundOffset[i-1] + _disc.nBound[i-1];
+	}
+	_disc.strideBound = _disc.boundOffset[_disc.nComp-1] + _disc.nBound[_disc.nComp - 1];
+
+	// ==== Read network structure
+	const int nCompartment = paramProvider.getInt("NCOMPARTMENT");
+	if (nCompartment < 1)
+		throw InvalidParameterException("Field NCOMPARTMENT has to be positive");
+
+	_disc.nCompartment = nCompartment;
+
+	_outletCompartment = _disc.nCompartment - 1;
+	if (paramProvider.exists("OUTLET_COMPARTMENT"))
+	{
+		const int outletCompartment = paramProvider.getInt("OUTLET_COMPARTMENT");
+		if ((outletCompartment < 0) || (outletCompartment >= nCompartment))
+			throw InvalidParameterException("Field OUTLET_COMPARTMENT has to be in [0, NCOMPARTMENT)");
+
+		_outletCompartment = outletCompartment;
+	}
+
+	// The sparsity pattern of the flow matrix determines the sparsity pattern of the Jacobian
+	const std::vector<double> flowMatrix = paramProvider.getDoubleArray("FLOW_MATRIX");
+	if (flowMatrix.size() != _disc.nCompartment * _disc.nCompartment)
+		throw InvalidParameterException("Field FLOW_MATRIX has to contain NCOMPARTMENT * NCOMPARTMENT elements");
+
+	const int strideCompartment = _disc.nComp + _disc.strideBound;
+	int lowerBandwidth = strideCompartment - 1;
+	int upperBandwidth = strideCompartment - 1;
+
+	_flowSource.clear();
+	_flowTarget.clear();
+	for (unsigned int src = 0; src < _disc.nCompartment; ++src)
+	{
+		for (unsigned int tgt = 0; tgt < _disc.nCompartment; ++tgt)
+		{
+			const double val = flowMatrix[src * _disc.nCompartment + tgt];
+			if (val == 0.0)
+				continue;
+
+			if (src == tgt)
+				throw InvalidParameterException("Diagonal of field FLOW_MATRIX has to be zero");
+
+			_flowSource.push_back(src);
+			_flowTarget.push_back(tgt);
+
+			// Row of the target compartment depends on the source compartment
+			const int offset = (static_cast<int>(src) - static_cast<int>(tgt)) * strideCompartment;
+			if (offset < 0)
+				lowerBandwidth = std::max(lowerBandwidth, -offset);
+			else
+				upperBandwidth = std::max(upperBandwidth, offset);
+		}
+	}
+	_flow.resize(_flowSource.size());
+
+	// Determine whether analytic Jacobian should be used but don't set it right now.
+	// We need to setup Jacobian matrices first.
+#ifndef CADET_CHECK_ANALYTIC_JACOBIAN
+	bool analyticJac = true;
+	if (paramProvider.exists("USE_ANALYTIC_JACOBIAN"))
+		analyticJac = paramProvider.getBool("USE_ANALYTIC_JACOBIAN");
+#else
+	const bool analyticJac = false;
+#endif
+
+	// Number of factorizations that are kept if the Jacobian is constant within a section
+	int cacheSize = 4;
+
+	// Create nonlinear solver for consistent initialization
+	if (paramProvider.exists("discretization"))
+	{
+		paramProvider.pushScope("discretization");
+
+		if (paramProvider.exists("FACTORIZATION_CACHE_SIZE"))
+			cacheSize = paramProvider.getInt("FACTORIZATION_CACHE_SIZE");
+
+		configureNonlinearSolver(paramProvider);
+		paramProvider.popScope();
+	}
+	else
+		configureNonlinearSolver();
+
+	if (cacheSize < 0)
+		throw InvalidParameterException("Field FACTORIZATION_CACHE_SIZE has to be non-negative");
+
+	_jacDiscCache.clear();
+	_jacDiscCache.setCapacity(cacheSize);
+
+	// Allocate space for initial conditions
+	_initC.resize(_disc.nComp);
+	_initQ.resize(_disc.strideBound);
+
+	// Allocate memory
+	_volume.resize(_disc.nCompartment);
+	_inletDistribution.resize(_disc.nCompartment);
+
+	_jacInlet.resize(_disc.nComp * _disc.nCompartment);
+
+	_jac.resize(_disc.nCompartment * strideCompartment, lowerBandwidth, upperBandwidth);
+	_jacDisc.resize(_disc.nCompartment * strideCompartment, lowerBandwidth, upperBandwidth);
+
+	// Set whether analytic Jacobian is used
+	useAnalyticJacobian(analyticJac);
+
+	// ==== Construct and configure binding model
+	clearBindingModels();
+	_binding.push_back(nullptr);
+
+	if (paramProvider.exists("ADSORPTION_MODEL"))
+		_binding[0] = helper.createBindingModel(paramProvider.getString("ADSORPTION_MODEL"));
+	else
+		_binding[0] = helper.createBindingModel("NONE");
+
+	if (!_binding[0])
+		throw InvalidParameterException("Unknown binding model " + paramProvider.getString("ADSORPTION_MODEL"));
+
+	bool bindingConfSuccess = true;
+	if (_binding[0]->usesParamProviderInDiscretizationConfig())
+		paramProvider.pushScope("adsorption");
+
+	bindingConfSuccess = _binding[0]->configureModelDiscretization(paramProvider, _disc.nComp, _disc.nBound, _disc.boundOffset);
+
+	if (_binding[0]->usesParamProviderInDiscretizationConfig())
+		paramProvider.popScope();
+
+	// ==== Construct and configure dynamic reaction model
+	bool reactionConfSuccess = true;
+	clearDynamicReactionModels();
+	_dynReaction.push_back(nullptr);
+
+	if (paramProvider.exists("REACTION_MODEL"))
+	{
+		_dynReaction[0] = helper.createDynamicReactionModel(paramProvider.getString("REACTION_MODEL"));
+		if (!_dynReaction[0])
+			throw InvalidParameterException("Unknown dynamic reaction model " + paramProvider.getString("REACTION_MODEL"));
+
+		if (_dynReaction[0]->usesParamProviderInDiscretizationConfig())
+			paramProvider.pushScope("reaction");
+
+		reactionConfSuccess = _dynReaction[0]->configureModelDiscretization(paramProvider, _disc.nComp, _disc.nBound, _disc.boundOffset);
+
+		if (_dynReaction[0]->usesParamProviderInDiscretizationConfig())
+			paramProvider.popScope();
+	}
+
+	// Setup the memory for tempState based on state vector
+	_tempState = new double[numDofs()];
+
+	return bindingConfSuccess && reactionConfSuccess;
+}
+
+bool CompartmentNetworkModel::configure(IParameterProvider& paramProvider)
+{
+	_parameters.clear();
+
+	_porosity = 1.0;
+	if (paramProvider.exists("POROSITY"))
+		_porosity = paramProvider.getDouble("POROSITY");
+
+	if ((static_cast<double>(_porosity) <= 0.0) || (static_cast<double>(_porosity) > 1.0))
+		throw InvalidParameterException("Field POROSITY has to be in (0, 1]");
+
+	// Read compartment volumes
+	const std::vector<double> volume = paramProvider.getDoubleArray("COMPARTMENT_VOLUME");
+	if (volume.size() != _disc.nCompartment)
+		throw InvalidParameterException("Field COMPARTMENT_VOLUME has to contain NCOMPARTMENT elements");
+
+	for (unsigned int i = 0; i < _disc.nCompartment; ++i)
+	{
+		if (volume[i] <= 0.0)
+			throw InvalidParameterException("Field COMPARTMENT_VOLUME has to be positive");
+
+		_volume[i] = volume[i];
+	}
+
+	// Read flow rates, the sparsity pattern has been fixed in configureModelDiscretization()
+	const std::vector<double> flowMatrix = paramProvider.getDoubleArray("FLOW_MATRIX");
+	if (flowMatrix.size() != _disc.nCompartment * _disc.nCompartment)
+		throw InvalidParameterException("Field FLOW_MATRIX has to contain NCOMPARTMENT * NCOMPARTMENT elements");
+
+	unsigned int flowIdx = 0;
+	for (unsigned int i = 0; i < flowMatrix.size(); ++i)
+	{
+		if ((flowIdx < _flow.size()) && (_flowSource[flowIdx] * _disc.nCompartment + _flowTarget[flowIdx] == i))
+		{
+			if (flowMatrix[i] < 0.0)
+				throw InvalidParameterException("Field FLOW_MATRIX has to be non-negative");
+
+			_flow[flowIdx] = flowMatrix[i];
+			++flowIdx;
+		}
+		else if (flowMatrix[i] != 0.0)
+			throw InvalidParameterException("Sparsity pattern of field FLOW_MATRIX must not change after discretization has been configured");
+	}
+
+	// Read distribution of inlet flow (defaults to first compartment)
+	std::fill(_inletDistribution.begin(), _inletDistribution.end(), 0.0);
+	if (paramProvider.exists("INLET_DISTRIBUTION"))
+	{
+		const std::vector<double> inletDist = paramProvider.getDoubleArray("INLET_DISTRIBUTION");
+		if (inletDist.size() != _disc.nCompartment)
+			throw InvalidParameterException("Field INLET_DISTRIBUTION has to contain NCOMPARTMENT elements");
+
+		ad::copyToAd(inletDist.data(), _inletDistribution.data(), _disc.nCompartment);
+	}
+	else
+		_inletDistribution[0] = 1.0;
+
+	// Add parameters to map
+	_parameters[makeParamId(hashString("POROSITY"), _unitOpIdx, CompIndep, ParTypeIndep, BoundStateIndep, ReactionIndep, SectionIndep)] = &_porosity;
+	registerParam1DArray(_parameters, _volume, [=](bool multi, unsigned int i) { return makeParamId(hashString("COMPARTMENT_VOLUME"), _unitOpIdx, CompIndep, ParTypeIndep, BoundStateIndep, i, SectionIndep); });
+	registerParam1DArray(_parameters, _inletDistribution, [=](bool multi, unsigned int i) { return makeParamId(hashString("INLET_DISTRIBUTION"), _unitOpIdx, CompIndep, ParTypeIndep, BoundStateIndep, i, SectionIndep); });
+
+	// Flow rates are identified by their source (bound state index) and target (reaction index) compartment
+	for (unsigned int i = 0; i < _flow.size(); ++i)
+		_parameters[makeParamId(hashString("FLOW_MATRIX"), _unitOpIdx, CompIndep, ParTypeIndep, _flowSource[i], _flowTarget[i], SectionIndep)] = _flow.data() + i;
+
+	// Register initial conditions parameters
+	for (unsigned int i = 0; i < _disc.nComp; ++i)
+		_parameters[makeParamId(hashString("INIT_C"), _unitOpIdx, i, ParTypeIndep, BoundStateIndep, ReactionIndep, SectionIndep)] = _initC.data() + i;
+
+	if (_binding[0])
+	{
+		std::vector<ParameterId> initParams(_disc.strideBound);
+		_binding[0]->fillBoundPhaseInitialParameters(initParams.data(), _unitOpIdx, cadet::ParTypeIndep);
+
+		for (unsigned int i = 0; i < _disc.strideBound; ++i)
+			_parameters[initParams[i]] = _initQ.data() + i;
+	}
+
+	// Reconfigure binding model
+	bool bindingConfSuccess = true;
+	if (_binding[0] && paramProvider.exists("adsorption") && _binding[0]->requiresConfiguration())
+	{
+		paramProvider.pushScope("adsorption");
+		bindingConfSuccess = _binding[0]->configure(paramProvider, _unitOpIdx, cadet::ParTypeIndep);
+		paramProvider.popScope();
+	}
+
+	// Reconfigure dynamic reaction model
+	bool reactionConfSuccess = true;
+	if (_dynReaction[0] && paramProvider.exists("reaction") && _dynReaction[0]->requiresConfiguration())
+	{
+		paramProvider.pushScope("reaction");
+		reactionConfSuccess = _dynReaction[0]->configure(paramProvider, _unitOpIdx, cadet::ParTypeIndep);
+		paramProvider.popScope();
+	}
+
+	return bindingConfSuccess && reactionConfSuccess;
+}
+
+unsigned int CompartmentNetworkModel::threadLocalMemorySize() const CADET_NOEXCEPT
+{
+	LinearMemorySizer lms;
+
+	// Memory for parts::cell::residualKernel = residualImpl()
+	if (_binding[0] && _binding[0]->requiresWorkspace())
+		lms.addBlock(_binding[0]->workspaceSize(_disc.nComp, _disc.strideBound, _disc.nBound));
+
+	if (_dynReaction[0])
+	{
+		lms.addBlock(_dynReaction[0]->workspaceSize(_disc.nComp, _disc.strideBound, _disc.nBound));
+		lms.add<active>(_disc.strideBound);
+		lms.add<double>(_disc.strideBound * (_disc.strideBound + _disc.nComp));
+	}
+
+	lms.commit();
+	const std::size_t resKernelSize = lms.bufferSize();
+
+	// Memory for consistentInitialSensitivity()
+	lms.add<double>(_disc.strideBound);
+	lms.add<double>(_disc.strideBound);
+
+	lms.commit();
+
+	// Memory for consistentInitialState()
+	const unsigned int strideCompartment = _disc.nComp + _disc.strideBound;
+	lms.add<double>(_nonlinearSolver->workspaceSize(strideCompartment));
+	lms.add<double>(strideCompartment);
+	lms.add<double>(strideCompartment);
+	lms.add<double>(strideCompartment);
+	lms.add<double>(strideCompartment * strideCompartment);
+	lms.add<double>(_disc.nComp);
+	lms.addBlock(_binding[0]->workspaceSize(_disc.nComp, _disc.strideBound, _disc.nBound));
+	lms.addBlock(resKernelSize);
+
+	lms.commit();
+
+	return lms.bufferSize();
+}
+
+void CompartmentNetworkModel::useAnalyticJacobian(const bool analyticJac)
+{
+#ifndef CADET_CHECK_ANALYTIC_JACOBIAN
+	_analyticJac = analyticJac;
+	if (!_analyticJac)
+		_jacobianAdDirs = _jac.stride();
+	else
+		_jacobianAdDirs = 0;
+#else
+	_analyticJac = false;
+	_jacobianAdDirs = _jac.stride();
+#endif
+}
+
+void CompartmentNetworkModel::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
+{
+	// Section dependent parameters may have changed, so the Jacobian has to be reevaluated.
+	// The cached factorizations are kept if the reevaluated Jacobian turns out to be the same
+	// (checked in linearSolve()), but parameters may have changed between simulations.
+	_jacobianCurrent = false;
+	_constJacobian = (_jacDiscCache.capacity() > 0) && _binding[0]->hasConstantJacobian()
+		&& (!_dynReaction[0] || _dynReaction[0]->hasConstantJacobian());
+
+	if (!_constJacobian || (secIdx == 0))
+	{
+		_jacDiscCache.clear();
+		_jacDiscFactorized = &_jacDisc;
+	}
+
+	prepareADvectors(adJac);
+}
+
+void CompartmentNetworkModel::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
+{
+	_flowRateIn = in[0];
+	_flowRateOut = out[0];
+}
+
+void CompartmentNetworkModel::reportSolution(ISolutionRecorder& recorder, double const* const solution) const
+{
+	Exporter expr(_disc, *this, solution);
+	recorder.beginUnitOperation(_unitOpIdx, *this, expr);
+	recorder.endUnitOperation();
+}
+
+void CompartmentNetworkModel::reportSolutionStructure(ISolutionRecorder& recorder) const
+{
+	Exporter expr(_disc, *this, nullptr);
+	recorder.unitOperationStructure(_unitOpIdx, *this, expr);
+}
+
+
+unsigned int CompartmentNetworkModel::requiredADdirs() const CADET_NOEXCEPT
+{
+#ifndef CADET_CHECK_ANALYTIC_JACOBIAN
+	return _jacobianAdDirs;
+#else
+	// If CADET_CHECK_ANALYTIC_JACOBIAN is active, we always need the AD directions for the Jacobian
+	return _jac.stride();
+#endif
+}
+
+void CompartmentNetworkModel::prepareADvectors(const AdJacobianParams& adJac) const
+{
+	// Early out if AD is disabled
+	if (!adJac.adY)
+		return;
+
+	Indexer idxr(_disc);
+
+	// Get bandwidths
+	const unsigned int lowerBandwidth = _jac.lowerBandwidth();
+	const unsigned int upperBandwidth = _jac.upperBandwidth();
+
+	ad::prepareAdVectorSeedsForBandMatrix(adJac.adY + idxr.offsetC(), adJac.adDirOffset, _jac.rows(), lowerBandwidth, upperBandwidth, lowerBandwidth);
+}
+
+/**
+ * @brief Extracts the system Jacobian from band compressed AD seed vectors
+ * @param [in] adRes Residual vector of AD datatypes with band compressed seed vectors
+ * @param [in] adDirOffset Number of AD directions used for non-Jacobian purposes (e.g., parameter sensitivities)
+ */
+void CompartmentNetworkModel::extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset)
+{
+	Indexer idxr(_disc);
+	ad::extractBandedJacobianFromAd(adRes + idxr.offsetC(), adDirOffset, _jac.lowerBandwidth(), _jac);
+}
+
+#ifdef CADET_CHECK_ANALYTIC_JACOBIAN
+
+/**
+ * @brief Compares the analytical Jacobian with a Jacobian derived by AD
+ * @details The analytical Jacobian is assumed to be stored in the corresponding band matrices.
+ * @param [in] adRes Residual vector of AD datatypes with band compressed seed vectors
+ * @param [in] adDirOffset Number of AD directions used for non-Jacobian purposes (e.g., parameter sensitivities)
+ */
+void CompartmentNetworkModel::checkAnalyticJacobianAgainstAd(active const* const adRes, unsigned int adDirOffset) const
+{
+	Indexer idxr(_disc);
+
+	const double maxDiff = ad::compareBandedJacobianWithAd(adRes + idxr.offsetC(), adDirOffset, _jac.lowerBandwidth(), _jac);
+	LOG(Debug) << "AD dir offset: " << adDirOffset << " DiagDirCol: " << _jac.lowerBandwidth() << " MaxDiff: " << maxDiff;
+}
+
+#endif
+
+int CompartmentNetworkModel::residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerResidual);
+
+	// Evaluate residual do not compute Jacobian or parameter sensitivities
+	return residualImpl<double, double, double, false>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res, threadLocalMem);
+}
+
+int CompartmentNetworkModel::residualWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerResidual);
+
+	// Evaluate residual, use AD for Jacobian if required but do not evaluate parameter derivatives
+	return residual(simTime, simState, res, adJac, threadLocalMem, true, false);
+}
+
+int CompartmentNetworkModel::residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res,
+	const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem, bool updateJacobian, bool paramSensitivity)
+{
+	// The inlet flow rate only enters the inlet Jacobian, which is cheap to assemble
+	if (updateJacobian)
+		assembleInletJacobian();
+
+	if (updateJacobian && _jacobianCurrent && (static_cast<double>(_flowRateOut) == _jacFlowRateOut))
+	{
+		// Jacobian is constant within the section and has already been evaluated,
+		// only a factorization for the (possibly) new BDF factor is required
+		_factorizeJacobian = true;
+		updateJacobian = false;
+	}
+
+	if (updateJacobian)
+	{
+		_factorizeJacobian = true;
+
+		// Remember that the constant Jacobian of this section is evaluated now
+		_jacobianCurrent = _constJacobian;
+		_checkJacobianCache = _constJacobian;
+		_jacFlowRateOut = static_cast<double>(_flowRateOut);
+
+#ifndef CADET_CHECK_ANALYTIC_JACOBIAN
+		if (_analyticJac)
+		{
+			if (paramSensitivity)
+			{
+				const int retCode = residualImpl<double, active, active, true>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+
+				// Copy AD residuals to original residuals vector
+				if (res)
+					ad::copyFromAd(adJac.adRes, res, numDofs());
+
+				return retCode;
+			}
+			else
+				return residualImpl<double, double, double, true>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res, threadLocalMem);
+		}
+		else
+		{
+			// Compute Jacobian via AD
+
+			// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
+			// and initialize residuals with zero (also resetting directional values)
+			ad::copyToAd(simState.vecStateY, adJac.adY, numDofs());
+			// @todo Check if this is necessary
+			ad::resetAd(adJac.adRes, numDofs());
+
+			// Evaluate with AD enabled
+			int retCode = 0;
+			if (paramSensitivity)
+				retCode = residualImpl<active, active, active, false>(simTime.t, simTime.secIdx, adJac.adY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+			else
+				retCode = residualImpl<active, active, double, false>(simTime.t, simTime.secIdx, adJac.adY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+
+			// Copy AD residuals to original residuals vector
+			if (res)
+				ad::copyFromAd(adJac.adRes, res, numDofs());
+
+			// Extract Jacobian
+			extractJacobianFromAD(adJac.adRes, adJac.adDirOffset);
+
+			return retCode;
+		}
+#else
+		// Compute Jacobian via AD
+
+		// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
+		// and initialize residuals with zero (also resetting directional values)
+		ad::copyToAd(simState.vecStateY, adJac.adY, numDofs());
+		// @todo Check if this is necessary
+		ad::resetAd(adJac.adRes, numDofs());
+
+		// Evaluate with AD enabled
+		int retCode = 0;
+		if (paramSensitivity)
+			retCode = residualImpl<active, active, active, false>(simTime.t, simTime.secIdx, adJac.adY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+		else
+			retCode = residualImpl<active, active, double, false>(simTime.t, simTime.secIdx, adJac.adY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+
+		// Only do comparison if we have a residuals vector (which is not always the case)
+		if (res)
+		{
+			// Evaluate with analytical Jacobian which is stored in the band matrices
+			retCode = residualImpl<double, double, double, true>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res, threadLocalMem);
+
+			// Compare AD with anaytic Jacobian
+			checkAnalyticJacobianAgainstAd(adJac.adRes, adJac.adDirOffset);
+		}
+
+		// Extract Jacobian
+		extractJacobianFromAD(adJac.adRes, adJac.adDirOffset);
+
+		return retCode;
+#endif
+	}
+	else
+	{
+		if (paramSensitivity)
+		{
+			// initialize residuals with zero
+			// @todo Check if this is necessary
+			ad::resetAd(adJac.adRes, numDofs());
+
+			const int retCode = residualImpl<double, active, active, false>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, adJac.adRes, threadLocalMem);
+
+			// Copy AD residuals to original residuals vector
+			if (res)
+				ad::copyFromAd(adJac.adRes, res, numDofs());
+
+			return retCode;
+		}
+		else
+			return residualImpl<double, double, double, false>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res, threadLocalMem);
+	}
+}
+
+template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+int CompartmentNetworkModel::residualImpl(double t, unsigned int secIdx, StateType const* const y, double const* const yDot, ResidualType* const res, util::ThreadLocalStorage& threadLocalMem)
+{
+	Indexer idxr(_disc);
+
+	// Binding models only set their own rows, so clear the flow contributions of the last evaluation
+	if (wantJac)
+		_jac.setAll(0.0);
+
+	BENCH_START(_timerResidualPar);
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCompartment), [&](std::size_t cmp)
+#else
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+#endif
+	{
+		StateType const* const localY = y + idxr.offsetC() + idxr.strideCompartment() * cmp;
+		ResidualType* const localRes = res + idxr.offsetC() + idxr.strideCompartment() * cmp;
+		double const* const localYdot = yDot ? yDot + idxr.offsetC() + idxr.strideCompartment() * cmp : nullptr;
+
+		const parts::cell::CellParameters cellResParams
+			{
+				_disc.nComp,
+				_disc.nBound,
+				_disc.boundOffset,
+				_disc.strideBound,
+				_binding[0]->reactionQuasiStationarity(),
+				_porosity,
+				nullptr,
+				_binding[0],
+				(_dynReaction[0] && (_dynReaction[0]->numReactionsCombined() > 0)) ? _dynReaction[0] : nullptr
+			};
+
+		parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, true>(
+			t, secIdx, ColumnPosition{0.0, 0.0, 0.0}, localY, localYdot, localRes, _jac.row(cmp * idxr.strideCompartment()), cellResParams, threadLocalMem.get()
+		);
+
+	} CADET_PARFOR_END;
+
+	BENCH_STOP(_timerResidualPar);
+
+	// Add convective transport between compartments and through the unit's inlet and outlet
+	residualFlow<StateType, ResidualType, ParamType, wantJac>(y, res);
+
+	// Handle inlet DOFs, which are simply copied to res
+	for (unsigned int i = 0; i < _disc.nComp; ++i)
+	{
+		res[i] = y[i];
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Adds the flow terms to the residual of the mobile phase of all compartments
+ * @details Each flow term is divided by the liquid volume of the compartment it is added to.
+ *          The contribution of the inlet DOFs is added to the residual, but the corresponding
+ *          Jacobian entries are stored separately in _jacInlet (see assembleInletJacobian()).
+ * @param [in] y State vector
+ * @param [in,out] res Residual vector
+ */
+template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+void CompartmentNetworkModel::residualFlow(StateType const* const y, ResidualType* const res)
+{
+	Indexer idxr(_disc);
+	const ParamType porosity = static_cast<ParamType>(_porosity);
+
+	// Outflow of the unit
+	{
+		const int offset = idxr.offsetC() + idxr.strideCompartment() * _outletCompartment;
+		const ParamType factor = static_cast<ParamType>(_flowRateOut) / (porosity * static_cast<ParamType>(_volume[_outletCompartment]));
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+		{
+			res[offset + comp] += factor * y[offset + comp];
+
+			if (wantJac)
+				_jac.centered(offset - idxr.offsetC() + comp, 0) += static_cast<double>(factor);
+		}
+	}
+
+	// Inflow of the unit
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		if (static_cast<double>(_inletDistribution[cmp]) == 0.0)
+			continue;
+
+		const int offset = idxr.offsetC() + idxr.strideCompartment() * cmp;
+		const ParamType factor = static_cast<ParamType>(_inletDistribution[cmp]) * static_cast<ParamType>(_flowRateIn) / (porosity * static_cast<ParamType>(_volume[cmp]));
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			res[offset + comp] -= factor * y[comp];
+	}
+
+	// Internal flows
+	for (std::size_t i = 0; i < _flow.size(); ++i)
+	{
+		const unsigned int src = _flowSource[i];
+		const unsigned int tgt = _flowTarget[i];
+		const int offsetSrc = idxr.offsetC() + idxr.strideCompartment() * src;
+		const int offsetTgt = idxr.offsetC() + idxr.strideCompartment() * tgt;
+
+		const ParamType liquidFlow = static_cast<ParamType>(_flow[i]) / porosity;
+		const ParamType factorSrc = liquidFlow / static_cast<ParamType>(_volume[src]);
+		const ParamType factorTgt = liquidFlow / static_cast<ParamType>(_volume[tgt]);
+
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+		{
+			res[offsetSrc + comp] += factorSrc * y[offsetSrc + comp];
+			res[offsetTgt + comp] -= factorTgt * y[offsetSrc + comp];
+		}
+
+		if (wantJac)
+		{
+			const int diagSrc = offsetSrc - offsetTgt;
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			{
+				_jac.centered(offsetSrc - idxr.offsetC() + comp, 0) += static_cast<double>(factorSrc);
+				_jac.centered(offsetTgt - idxr.offsetC() + comp, diagSrc) -= static_cast<double>(factorTgt);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Assembles the matrix that connects the inlet DOFs to the compartments fed by the unit inlet
+ */
+void CompartmentNetworkModel::assembleInletJacobian()
+{
+	Indexer idxr(_disc);
+
+	_jacInlet.clear();
+	const double porosity = static_cast<double>(_porosity);
+	const double flowRateIn = static_cast<double>(_flowRateIn);
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		const double dist = static_cast<double>(_inletDistribution[cmp]);
+		if (dist == 0.0)
+			continue;
+
+		const double factor = -dist * flowRateIn / (porosity * static_cast<double>(_volume[cmp]));
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			_jacInlet.addElement(cmp * idxr.strideCompartment() + comp, comp, factor);
+	}
+}
+
+int CompartmentNetworkModel::residualSensFwdWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerResidualSens);
+
+	// Evaluate residual for all parameters using AD in vector mode and at the same time update the
+	// Jacobian (in one AD run, if analytic Jacobians are disabled)
+	return residual(simTime, simState, nullptr, adJac, threadLocalMem, true, true);
+}
+
+int CompartmentNetworkModel::residualSensFwdAdOnly(const SimulationTime& simTime, const ConstSimulationState& simState, active* const adRes, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerResidualSens);
+
+	// Evaluate residual for all parameters using AD in vector mode
+	return residualImpl<double, active, active, false>(simTime.t, simTime.secIdx, simState.vecStateY, simState.vecStateYdot, adRes, threadLocalMem);
+}
+
+int CompartmentNetworkModel::residualSensFwdCombine(const SimulationTime& simTime, const ConstSimulationState& simState,
+	const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes,
+	double* const tmp1, double* const tmp2, double* const tmp3)
+{
+	BENCH_SCOPE(_timerResidualSens);
+
+	// tmp1 stores result of (dF / dy) * s
+	// tmp2 stores result of (dF / dyDot) * sDot
+
+	for (std::size_t param = 0; param < yS.size(); ++param)
+	{
+		// Directional derivative (dF / dy) * s
+		multiplyWithJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, yS[param], 1.0, 0.0, tmp1);
+
+		// Directional derivative (dF / dyDot) * sDot
+		multiplyWithDerivativeJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, ySdot[param], tmp2);
+
+		double* const ptrResS = resS[param];
+
+		BENCH_START(_timerResidualSensPar);
+
+		// Complete sens residual is the sum:
+#ifdef CADET_PARALLELIZE
+		tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(numDofs()), [&](std::size_t i)
+#else
+		for (unsigned int i = 0; i < numDofs(); ++i)
+#endif
+		{
+			ptrResS[i] = tmp1[i] + tmp2[i] + adRes[i].getADValue(param);
+		} CADET_PARFOR_END;
+
+		BENCH_STOP(_timerResidualSensPar);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Multiplies the given vector with the system Jacobian (i.e., @f$ \frac{\partial F}{\partial y}\left(t, y, \dot{y}\right) @f$)
+ * @details Actually, the operation @f$ z = \alpha \frac{\partial F}{\partial y} x + \beta z @f$ is performed.
+ *
+ *          Note that residual() or one of its cousins has to be called with the requested point @f$ (t, y, \dot{y}) @f$ once
+ *          before calling multiplyWithJacobian() as this implementation ignores the given @f$ (t, y, \dot{y}) @f$.
+ * @param [in] simTime Current simulation time point
+ * @param [in] simState Simulation state vectors
+ * @param [in] yS Vector @f$ x @f$ that is transformed by the Jacobian @f$ \frac{\partial F}{\partial y} @f$
+ * @param [in] alpha Factor @f$ \alpha @f$ in front of @f$ \frac{\partial F}{\partial y} @f$
+ * @param [in] beta Factor @f$ \beta @f$ in front of @f$ z @f$
+ * @param [in,out] ret Vector @f$ z @f$ which stores the result of the operation
+ */
+void CompartmentNetworkModel::multiplyWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double alpha, double beta, double* ret)
+{
+	Indexer idxr(_disc);
+
+	// Handle identity matrix of inlet DOFs
+	for (unsigned int i = 0; i < _disc.nComp; ++i)
+	{
+		ret[i] = alpha * yS[i] + beta * ret[i];
+	}
+
+	// Main Jacobian
+	_jac.multiplyVector(yS + idxr.offsetC(), alpha, beta, ret + idxr.offsetC());
+
+	// Map inlet DOFs to the compartments fed by the inlet
+	_jacInlet.multiplyAdd(yS, ret + idxr.offsetC(), alpha);
+}
+
+/**
+ * @brief Multiplies the time derivative Jacobian @f$ \frac{\partial F}{\partial \dot{y}}\left(t, y, \dot{y}\right) @f$ with a given vector
+ * @details The operation @f$ z = \frac{\partial F}{\partial \dot{y}} x @f$ is performed.
+ *          The matrix-vector multiplication is performed matrix-free (i.e., no matrix is explicitly formed).
+ * @param [in] simTime Current simulation time point
+ * @param [in] simState Simulation state vectors
+ * @param [in] sDot Vector @f$ x @f$ that is transformed by the Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$
+ * @param [out] ret Vector @f$ z @f$ which stores the result of the operation
+ */
+void CompartmentNetworkModel::multiplyWithDerivativeJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* sDot, double* ret)
+{
+	Indexer idxr(_disc);
+	const double invBeta = (1.0 / static_cast<double>(_porosity) - 1.0);
+
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		const unsigned int localOffset = idxr.offsetC() + cmp * idxr.strideCompartment();
+		double const* const localSdot = sDot + localOffset;
+		double* const localRet = ret + localOffset;
+
+		parts::cell::multiplyWithDerivativeJacobianKernel<true>(localSdot, localRet, _disc.nComp, _disc.nBound, _disc.boundOffset, _disc.strideBound, _binding[0]->reactionQuasiStationarity(), 1.0, invBeta);
+	}
+
+	// Handle inlet DOFs (all algebraic)
+	std::fill_n(ret, _disc.nComp, 0.0);
+}
+
+void CompartmentNetworkModel::setExternalFunctions(IExternalFunction** extFuns, unsigned int size)
+{
+	if (_binding[0])
+		_binding[0]->setExternalFunctions(extFuns, size);
+}
+
+unsigned int CompartmentNetworkModel::localOutletComponentIndex(unsigned int port) const CADET_NOEXCEPT
+{
+	// Inlets are duplicated so need to be accounted for
+	return _disc.nComp + _outletCompartment * (_disc.nComp + _disc.strideBound);
+}
+
+unsigned int CompartmentNetworkModel::localInletComponentIndex(unsigned int port) const CADET_NOEXCEPT
+{
+	return 0;
+}
+
+unsigned int CompartmentNetworkModel::localOutletComponentStride(unsigned int port) const CADET_NOEXCEPT
+{
+	return 1;
+}
+
+unsigned int CompartmentNetworkModel::localInletComponentStride(unsigned int port) const CADET_NOEXCEPT
+{
+	return 1;
+}
+
+void CompartmentNetworkModel::expandErrorTol(double const* errorSpec, unsigned int errorSpecSize, double* expandOut)
+{
+	// @todo Write this function
+}
+
+/**
+ * @brief Computes the solution of the linear system involving the system Jacobian
+ * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b \f]
+ *          has to be solved. The right hand side \f$ b \f$ is given by @p rhs, the Jacobians are evaluated at the
+ *          point \f$(y, \dot{y})\f$ given by @p y and @p yDot. The residual @p res at this point, \f$ F(t, y, \dot{y}) \f$,
+ *          may help with this. Error weights (see IDAS guide) are given in @p weight. The solution is returned in @p rhs.
+ *
+ *          All compartments are covered by a single factorization of the banded network Jacobian.
+ *
+ * @param [in] t Current time point
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] outerTol Error tolerance for the solution of the linear system from outer Newton iteration
+ * @param [in,out] rhs On entry the right hand side of the linear equation system, on exit the solution
+ * @param [in] weight Vector with error weights
+ * @param [in] simState State of the simulation (state vector and its time derivatives) at which the Jacobian is evaluated
+ * @return @c 0 on success, @c -1 on non-recoverable error, and @c +1 on recoverable error
+ */
+int CompartmentNetworkModel::linearSolve(double t, double alpha, double outerTol, double* const rhs, double const* const weight,
+	const ConstSimulationState& simState)
+{
+	BENCH_SCOPE(_timerLinearSolve);
+
+	Indexer idxr(_disc);
+
+	bool success = true;
+
+	// Factorize Jacobian only if required
+	if (_factorizeJacobian)
+	{
+		_jacDiscFactorized = nullptr;
+		if (_constJacobian)
+		{
+			// Cached factorizations are only valid for the Jacobian they have been assembled from
+			if (_checkJacobianCache)
+			{
+				if ((_jacCacheRef.rows() != _jac.rows()) || (_jacCacheRef.lowerBandwidth() != _jac.lowerBandwidth())
+					|| !std::equal(_jac.data(), _jac.data() + _jac.rows() * _jac.stride(), _jacCacheRef.data()))
+				{
+					_jacDiscCache.clear();
+					_jacCacheRef = _jac;
+				}
+				_checkJacobianCache = false;
+			}
+
+			_jacDiscFactorized = _jacDiscCache.find(alpha);
+		}
+
+		if (!_jacDiscFactorized)
+		{
+			// Assemble
+			assembleDiscretizedJacobian(alpha, idxr);
+
+			// Factorize
+			success = _jacDisc.factorize();
+			if (cadet_unlikely(!success))
+			{
+				LOG(Error) << "Factorize() failed for compartment network";
+			}
+			else if (_constJacobian)
+				_jacDiscCache.insert(alpha, _jacDisc);
+
+			_jacDiscFactorized = &_jacDisc;
+		}
+
+		// Do not factorize again at next call without changed Jacobians
+		_factorizeJacobian = false;
+	}
+
+	// Handle inlet DOFs
+	_jacInlet.multiplySubtract(rhs, rhs + idxr.offsetC());
+
+	// Solve
+	const bool result = _jacDiscFactorized->solve(rhs + idxr.offsetC());
+	if (cadet_unlikely(!result))
+	{
+		LOG(Error) << "Solve() failed for compartment network";
+	}
+
+	return (success && result) ? 0 : 1;
+}
+
+/**
+ * @brief Assembles the Jacobian of the time-discretized equations
+ * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b \f]
+ *          has to be solved. The system Jacobian of the original equations,
+ *          \f[ \frac{\partial F}{\partial y}, \f]
+ *          is already computed (by AD or manually in residualImpl() with @c wantJac = true). This function is responsible
+ *          for adding
+ *          \f[ \alpha \frac{\partial F}{\partial \dot{y}} \f]
+ *          to the system Jacobian, which yields the Jacobian of the time-discretized equations
+ *          \f[ F\left(t, y_0, \sum_{k=0}^N \alpha_k y_k \right) = 0 \f]
+ *          when a BDF method is used. The time integrator needs to solve this equation for @f$ y_0 @f$, which requires
+ *          the solution of the linear system mentioned above (@f$ \alpha_0 = \alpha @f$ given in @p alpha).
+ *
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] idxr Indexer
+ */
+void CompartmentNetworkModel::assembleDiscretizedJacobian(double alpha, const Indexer& idxr)
+{
+	// Copy normal matrix over to factorizable matrix
+	_jacDisc.copyOver(_jac);
+
+	// Add time derivatives to compartments
+	const double invBeta = 1.0 / static_cast<double>(_porosity) - 1.0;
+	linalg::FactorizableBandMatrix::RowIterator jac = _jacDisc.row(0);
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		addTimeDerivativeToJacobianCompartment(jac, idxr, alpha, invBeta);
+	}
+}
+
+/**
+ * @brief Adds Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$ to compartment of system Jacobian
+ * @details Actually adds @f$ \alpha \frac{\partial F}{\partial \dot{y}} @f$, which is useful
+ *          for constructing the linear system in BDF time discretization.
+ * @param [in,out] jac On entry, RowIterator pointing to the beginning of a compartment;
+ *                     on exit, the iterator points to the end of the compartment
+ * @param [in] idxr Indexer
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] invBeta Inverse porosity term @f$\frac{1}{\beta}@f$
+ */
+void CompartmentNetworkModel::addTimeDerivativeToJacobianCompartment(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, double invBeta) const
+{
+	// Mobile phase
+	for (int comp = 0; comp < static_cast<int>(_disc.nComp); ++comp, ++jac)
+	{
+		// Add derivative with respect to dc / dt to Jacobian
+		jac[0] += alpha;
+
+		// Add derivative with respect to dq / dt to Jacobian
+		for (int i = 0; i < static_cast<int>(_disc.nBound[comp]); ++i)
+		{
+			// Index explanation:
+			//   -comp -> go back to beginning of liquid phase
+			//   + strideLiquid() skip to solid phase
+			//   + offsetBoundComp() jump to component (skips all bound states of previous components)
+			//   + i go to current bound state
+			jac[idxr.strideLiquid() - comp + idxr.offsetBoundComp(comp) + i] += alpha * invBeta;
+		}
+	}
+
+	// Solid phase
+	int const* const qsReaction = _binding[0]->reactionQuasiStationarity();
+	for (unsigned int bnd = 0; bnd < _disc.strideBound; ++bnd, ++jac)
+	{
+		// Add derivative with respect to dynamic states to Jacobian
+		if (qsReaction[bnd])
+			continue;
+
+		// Add derivative with respect to dq / dt to Jacobian
+		jac[0] += alpha;
+	}
+}
+
+void CompartmentNetworkModel::applyInitialCondition(const SimulationState& simState) const
+{
+	Indexer idxr(_disc);
+
+	// Check whether full state vector is available as initial condition
+	if (!_initState.empty())
+	{
+		std::fill(simState.vecStateY, simState.vecStateY + idxr.offsetC(), 0.0);
+		std::copy(_initState.data(), _initState.data() + numPureDofs(), simState.vecStateY + idxr.offsetC());
+
+		if (!_initStateDot.empty())
+		{
+			std::fill(simState.vecStateYdot, simState.vecStateYdot + idxr.offsetC(), 0.0);
+			std::copy(_initStateDot.data(), _initStateDot.data() + numPureDofs(), simState.vecStateYdot + idxr.offsetC());
+		}
+		else
+			std::fill(simState.vecStateYdot, simState.vecStateYdot + numDofs(), 0.0);
+
+		return;
+	}
+
+	double* const stateYbulk = simState.vecStateY + idxr.offsetC();
+
+	// Loop over compartments
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		const unsigned int localOffset = cmp * idxr.strideCompartment();
+
+		// Loop over components in compartment
+		for (unsigned comp = 0; comp < _disc.nComp; ++comp)
+			stateYbulk[localOffset + comp * idxr.strideComp()] = static_cast<double>(_initC[comp]);
+
+		// Initialize q
+		for (unsigned int bnd = 0; bnd < _disc.strideBound; ++bnd)
+			stateYbulk[localOffset + idxr.strideLiquid() + bnd] = static_cast<double>(_initQ[bnd]);
+	}
+}
+
+void CompartmentNetworkModel::readInitialCondition(IParameterProvider& paramProvider)
+{
+	_initState.clear();
+	_initStateDot.clear();
+
+	// Check if INIT_STATE is present
+	if (paramProvider.exists("INIT_STATE"))
+	{
+		const std::vector<double> initState = paramProvider.getDoubleArray("INIT_STATE");
+		if (initState.size() < numPureDofs())
+			throw InvalidParameterException("INIT_STATE does not contain enough values");
+
+		_initState = std::vector<double>(initState.begin(), initState.begin() + numPureDofs());
+
+		// Check if INIT_STATE contains the full state and its time derivative
+		if (initState.size() >= 2 * numPureDofs())
+			_initStateDot = std::vector<double>(initState.begin() + numPureDofs(), initState.begin() + 2 * numPureDofs());
+		return;
+	}
+
+	const std::vector<double> initC = paramProvider.getDoubleArray("INIT_C");
+	std::vector<double> initQ;
+
+	if (paramProvider.exists("INIT_Q"))
+		initQ = paramProvider.getDoubleArray("INIT_Q");
+
+	if (initC.size() < _disc.nComp)
+		throw InvalidParameterException("INIT_C does not contain enough values for all components");
+
+	if ((_disc.strideBound > 0) && !initQ.empty() && (initQ.size() < _disc.strideBound))
+		throw InvalidParameterException("INIT_Q does not contain enough values for all bound states");
+
+	ad::copyToAd(initC.data(), _initC.data(), _disc.nComp);
+	if (!initQ.empty())
+		ad::copyToAd(initQ.data(), _initQ.data(), _disc.strideBound);
+	else
+		ad::fillAd(_initQ.data(), _disc.strideBound, 0.0);
+}
+
+/**
+ * @brief Computes consistent initial values (state variables without their time derivatives)
+ * @details Given the DAE \f[ F(t, y, \dot{y}) = 0, \f] the initial values \f$ y_0 \f$ and \f$ \dot{y}_0 \f$ have
+ *          to be consistent. This functions updates the initial state \f$ y_0 \f$ and overwrites the time
+ *          derivative \f$ \dot{y}_0 \f$ such that they are consistent.
+ *
+ *          The process works in two steps:
+ *          <ol>
+ *              <li>Solve all algebraic equations in the model (e.g., quasi-stationary isotherms, reaction equilibria).</li>
+ *              <li>Compute the time derivatives of the state @f$ \dot{y} @f$ such that the residual is 0.
+ *                 However, because of the algebraic equations, we need additional conditions to fully determine
+ *                 @f$ \dot{y}@f$. By differentiating the algebraic equations with respect to time, we get the
+ *                 missing linear equations (recall that the state vector @f$ y @f$ is fixed).
+ *
+ *     The right hand side of the linear system is given by the negative residual without contribution
+ *     of @f$ \dot{y} @f$ for differential equations and 0 for algebraic equations
+ *     (@f$ -\frac{\partial F}{\partial t}@f$, to be more precise).</li>
+ *          </ol>
+ *
+ *     This function performs step 1. See consistentInitialTimeDerivative() for step 2.
+ *
+ * 	   This function is to be used with consistentInitialTimeDerivative(). Do not mix normal and lean
+ *     consistent initialization!
+ *
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in,out] vecStateY State vector with initial values that are to be updated for consistency
+ * @param [in,out] adJac Jacobian information for AD (AD vectors for residual and state, direction offset)
+ * @param [in] errorTol Error tolerance for algebraic equations
+ */
+void CompartmentNetworkModel::consistentInitialState(const SimulationTime& simTime, double* const vecStateY, const AdJacobianParams& adJac, double errorTol, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerConsistentInit);
+
+	Indexer idxr(_disc);
+
+	// Step 1: Solve algebraic equations
+	if (!_binding[0]->hasQuasiStationaryReactions())
+		return;
+
+	// Copy quasi-stationary binding mask to a local array that also includes the mobile phase
+	std::vector<int> qsMask(_disc.nComp + _disc.strideBound, false);
+	int const* const qsMaskSrc = _binding[0]->reactionQuasiStationarity();
+	std::copy_n(qsMaskSrc, _disc.strideBound, qsMask.data() + _disc.nComp);
+
+	// Activate mobile phase components that have at least one active bound state
+	unsigned int bndStartIdx = 0;
+	unsigned int numActiveComp = 0;
+	for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+	{
+		for (unsigned int bnd = 0; bnd < _disc.nBound[comp]; ++bnd)
+		{
+			if (qsMaskSrc[bndStartIdx + bnd])
+			{
+				++numActiveComp;
+				qsMask[comp] = true;
+				break;
+			}
+		}
+
+		bndStartIdx += _disc.nBound[comp];
+	}
+
+	const linalg::ConstMaskArray mask{qsMask.data(), static_cast<int>(_disc.nComp + _disc.strideBound)};
+	const int probSize = linalg::numMaskActive(mask);
+
+#ifdef CADET_PARALLELIZE
+	BENCH_SCOPE(_timerConsistentInitPar);
+	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCompartment), [&](std::size_t cmp)
+#else
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+#endif
+	{
+		LinearBufferAllocator tlmAlloc = threadLocalMem.get();
+
+		// Reuse memory of band matrix for dense matrix
+		linalg::DenseMatrixView fullJacobianMatrix(_jacDisc.data() + cmp * mask.len * mask.len, nullptr, mask.len, mask.len);
+
+		// Get workspace memory
+		BufferedArray<double> nonlinMemBuffer = tlmAlloc.array<double>(_nonlinearSolver->workspaceSize(probSize));
+		double* const nonlinMem = static_cast<double*>(nonlinMemBuffer);
+
+		BufferedArray<double> solutionBuffer = tlmAlloc.array<double>(probSize);
+		double* const solution = static_cast<double*>(solutionBuffer);
+
+		BufferedArray<double> fullResidualBuffer = tlmAlloc.array<double>(mask.len);
+		double* const fullResidual = static_cast<double*>(fullResidualBuffer);
+
+		BufferedArray<double> fullXBuffer = tlmAlloc.array<double>(mask.len);
+		double* const fullX = static_cast<double*>(fullXBuffer);
+
+		BufferedArray<double> jacobianMemBuffer = tlmAlloc.array<double>(probSize * probSize);
+		double* const jacobianMem = static_cast<double*>(jacobianMemBuffer);
+
+		BufferedArray<double> conservedQuantsBuffer = tlmAlloc.array<double>(numActiveComp);
+		double* const conservedQuants = static_cast<double*>(conservedQuantsBuffer);
+
+		linalg::DenseMatrixView jacobianMatrix(jacobianMem, _jacDisc.pivot() + cmp * mask.len, probSize, probSize);
+		const parts::cell::CellParameters cellResParams
+			{
+				_disc.nComp,
+				_disc.nBound,
+				_disc.boundOffset,
+				_disc.strideBound,
+				_binding[0]->reactionQuasiStationarity(),
+				_porosity,
+				nullptr,
+				_binding[0],
+				(_dynReaction[0] && (_dynReaction[0]->numReactionsCombined() > 0)) ? _dynReaction[0] : nullptr
+			};
+
+		const int localOffsetToCell = idxr.offsetC() + cmp * idxr.strideCompartment();
+		const int localOffsetInCell = idxr.strideLiquid();
+
+		// Get pointer to q variables in compartment
+		double* const qShell = vecStateY + localOffsetToCell + localOffsetInCell;
+		active* const localAdRes = adJac.adRes ? adJac.adRes + localOffsetToCell : nullptr;
+		active* const localAdY = adJac.adY ? adJac.adY + localOffsetToCell : nullptr;
+
+		const ColumnPosition colPos{0.0, 0.0, 0.0};
+
+		// Determine whether nonlinear solver is required
+		if (!_binding[0]->preConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - localOffsetInCell, tlmAlloc))
+			CADET_PAR_CONTINUE;
+
+		// Extract initial values from current state
+		linalg::selectVectorSubset(qShell - _disc.nComp, mask, solution);
+
+		// Save values of conserved moieties
+		const double epsQ = 1.0 - static_cast<double>(_porosity);
+		linalg::conservedMoietiesFromPartitionedMask(mask, _disc.nBound, _disc.nComp, qShell - _disc.nComp, conservedQuants, static_cast<double>(_porosity), epsQ);
+
+		// Replaces the rows of the mobile phase by the conservation relations
+		const auto addConservationRelations = [&](linalg::detail::DenseMatrixBase& mat)
+		{
+			mat.submatrixSetAll(0.0, 0, 0, numActiveComp, probSize);
+
+			unsigned int bndIdx = 0;
+			unsigned int rIdx = 0;
+			unsigned int bIdx = 0;
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			{
+				if (!mask.mask[comp])
+				{
+					bndIdx += _disc.nBound[comp];
+					continue;
+				}
+
+				mat.native(rIdx, rIdx) = static_cast<double>(_porosity);
+
+				for (unsigned int bnd = 0; bnd < _disc.nBound[comp]; ++bnd, ++bndIdx)
+				{
+					if (mask.mask[bndIdx])
+					{
+						mat.native(rIdx, bIdx + numActiveComp) = epsQ;
+						++bIdx;
+					}
+				}
+
+				++rIdx;
+			}
+		};
+
+		std::function<bool(double const* const, linalg::detail::DenseMatrixBase&)> jacFunc;
+		if (localAdY && localAdRes)
+		{
+			jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
+			{
+				// Copy over state vector to AD state vector (without changing directional values to keep seed vectors)
+				// and initialize residuals with zero (also resetting directional values)
+				ad::copyToAd(qShell - _disc.nComp, localAdY, mask.len);
+				// @todo Check if this is necessary
+				ad::resetAd(localAdRes, mask.len);
+
+				// Prepare input vector by overwriting masked items
+				linalg::applyVectorSubset(x, mask, localAdY);
+
+				// Call residual function
+				parts::cell::residualKernel<active, active, double, parts::cell::CellParameters, linalg::DenseBandedRowIterator, false, true>(
+					simTime.t, simTime.secIdx, colPos, localAdY, nullptr, localAdRes, fullJacobianMatrix.row(0), cellResParams, tlmAlloc
+				);
+
+				// Extract Jacobian from AD
+				ad::extractDenseJacobianFromBandedAd(
+					adJac.adRes + idxr.offsetC(), cmp * idxr.strideCompartment(), adJac.adDirOffset, _jac.lowerBandwidth(),
+					_jac.lowerBandwidth(), _jac.upperBandwidth(), fullJacobianMatrix
+				);
+
+				// Extract Jacobian from full Jacobian
+				mat.setAll(0.0);
+				linalg::copyMatrixSubset(fullJacobianMatrix, mask, mask, mat);
+
+				// Replace upper part with conservation relations
+				addConservationRelations(mat);
+
+				return true;
+			};
+		}
+		else
+		{
+			jacFunc = [&](double const* const x, linalg::detail::DenseMatrixBase& mat)
+			{
+				// Prepare input vector by overwriting masked items
+				std::copy_n(qShell - _disc.nComp, mask.len, fullX);
+				linalg::applyVectorSubset(x, mask, fullX);
+
+				// Call residual function
+				parts::cell::residualKernel<double, double, double, parts::cell::CellParameters, linalg::DenseBandedRowIterator, true, true>(
+					simTime.t, simTime.secIdx, colPos, fullX, nullptr, fullResidual, fullJacobianMatrix.row(0), cellResParams, tlmAlloc
+				);
+
+				// Extract Jacobian from full Jacobian
+				mat.setAll(0.0);
+				linalg::copyMatrixSubset(fullJacobianMatrix, mask, mask, mat);
+
+				// Replace upper part with conservation relations
+				addConservationRelations(mat);
+
+				return true;
+			};
+		}
+
+		// Apply nonlinear solver
+		_nonlinearSolver->solve(
+			[&](double const* const x, double* const r)
+			{
+				// Prepare input vector by overwriting masked items
+				std::copy_n(qShell - _disc.nComp, mask.len, fullX);
+				linalg::applyVectorSubset(x, mask, fullX);
+
+				// Call residual function
+				parts::cell::residualKernel<double, double, double, parts::cell::CellParameters, linalg::DenseBandedRowIterator, false, true>(
+					simTime.t, simTime.secIdx, colPos, fullX, nullptr, fullResidual, fullJacobianMatrix.row(0), cellResParams, tlmAlloc
+				);
+
+				// Extract values from residual
+				linalg::selectVectorSubset(fullResidual, mask, r);
+
+				// Calculate residual of conserved moieties
+				std::fill_n(r, numActiveComp, 0.0);
+				unsigned int bndIdx = _disc.nComp;
+				unsigned int rIdx = 0;
+				unsigned int bIdx = 0;
+				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				{
+					if (!mask.mask[comp])
+					{
+						bndIdx += _disc.nBound[comp];
+						continue;
+					}
+
+					r[rIdx] = static_cast<double>(_porosity) * x[rIdx] - conservedQuants[rIdx];
+
+					for (unsigned int bnd = 0; bnd < _disc.nBound[comp]; ++bnd, ++bndIdx)
+					{
+						if (mask.mask[bndIdx])
+						{
+							r[rIdx] += epsQ * x[bIdx + numActiveComp];
+							++bIdx;
+						}
+					}
+
+					++rIdx;
+				}
+
+				return true;
+			},
+			jacFunc, errorTol, solution, nonlinMem, jacobianMatrix, probSize);
+
+		// Apply solution
+		linalg::applyVectorSubset(solution, mask, qShell - idxr.strideLiquid());
+
+		// Refine / correct solution
+		_binding[0]->postConsistentInitialState(simTime.t, simTime.secIdx, colPos, qShell, qShell - idxr.strideLiquid(), tlmAlloc);
+	} CADET_PARFOR_END;
+}
+
+/**
+ * @brief Computes consistent initial time derivatives
+ * @details Given the DAE \f[ F(t, y, \dot{y}) = 0, \f] the initial values \f$ y_0 \f$ and \f$ \dot{y}_0 \f$ have
+ *          to be consistent. This functions updates the initial state \f$ y_0 \f$ and overwrites the time
+ *          derivative \f$ \dot{y}_0 \f$ such that they are consistent.
+ *
+ *     This function performs step 2. See consistentInitialState() for step 1.
+ *
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in] vecStateY Consistently initialized state vector
+ * @param [in,out] vecStateYdot On entry, residual without taking time derivatives into account. On exit, consistent state time derivatives.
+ */
+void CompartmentNetworkModel::consistentInitialTimeDerivative(const SimulationTime& simTime, double const* vecStateY, double* const vecStateYdot, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerConsistentInit);
+
+	Indexer idxr(_disc);
+
+	// Step 2: Compute the correct time derivative of the state vector
+
+	// Note that the residual has not been negated, yet. We will do that now.
+	for (unsigned int i = 0; i < numDofs(); ++i)
+		vecStateYdot[i] = -vecStateYdot[i];
+
+	_jacDisc.setAll(0.0);
+
+	const double invBeta = 1.0 / static_cast<double>(_porosity) - 1.0;
+	double* const dFluxDt = _tempState + idxr.offsetC();
+	LinearBufferAllocator tlmAlloc = threadLocalMem.get();
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		// Assemble
+		linalg::FactorizableBandMatrix::RowIterator jac = _jacDisc.row(idxr.strideCompartment() * cmp);
+
+		// Mobile and solid phase (advances jac accordingly)
+		addTimeDerivativeToJacobianCompartment(jac, idxr, 1.0, invBeta);
+
+		// Stationary phase
+		if (!_binding[0]->hasQuasiStationaryReactions())
+			continue;
+
+		// Get iterators to beginning of solid phase
+		linalg::BandMatrix::RowIterator jacSolidOrig = _jac.row(idxr.strideCompartment() * cmp + idxr.strideLiquid());
+		linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideBound();
+
+		int const* const mask = _binding[0]->reactionQuasiStationarity();
+		double* const qShellDot = vecStateYdot + idxr.offsetC() + cmp * idxr.strideCompartment() + idxr.strideLiquid();
+
+		// Obtain derivative of fluxes wrt. time
+		std::fill_n(dFluxDt, _disc.strideBound, 0.0);
+		if (_binding[0]->dependsOnTime())
+		{
+			_binding[0]->timeDerivativeQuasiStationaryFluxes(simTime.t, simTime.secIdx, ColumnPosition{0.0, 0.0, 0.0},
+				qShellDot - _disc.nComp, qShellDot, dFluxDt, tlmAlloc);
+		}
+
+		// Copy row from original Jacobian and set right hand side
+		for (unsigned int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
+		{
+			if (!mask[i])
+				continue;
+
+			jacSolid.copyRowFrom(jacSolidOrig);
+			qShellDot[i] = -dFluxDt[i];
+		}
+	}
+
+	// Precondition
+	double* const scaleFactors = _tempState + idxr.offsetC();
+	_jacDisc.rowScaleFactors(scaleFactors);
+	_jacDisc.scaleRows(scaleFactors);
+
+	// Factorize
+	const bool result = _jacDisc.factorize();
+	if (!result)
+	{
+		LOG(Error) << "Factorize() failed for compartment network";
+	}
+
+	const bool result2 = _jacDisc.solve(scaleFactors, vecStateYdot + idxr.offsetC());
+	if (!result2)
+	{
+		LOG(Error) << "Solve() failed for compartment network";
+	}
+}
+
+/**
+ * @brief Computes approximately / partially consistent initial values (state variables without their time derivatives)
+ * @details This function performs a relaxed consistent initialization: Only parts of the vectors are updated
+ *          and, hence, consistency is not guaranteed. The state vector is kept as it is (i.e., algebraic
+ *          equations are not solved).
+ *
+ *     This function performs step 1. See leanConsistentInitialTimeDerivative() for step 2.
+ *
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in,out] vecStateY State vector with initial values that are to be updated for consistency
+ * @param [in,out] adJac Jacobian information for AD (AD vectors for residual and state, direction offset)
+ * @param [in] errorTol Error tolerance for algebraic equations
+ */
+void CompartmentNetworkModel::leanConsistentInitialState(const SimulationTime& simTime, double* const vecStateY, const AdJacobianParams& adJac, double errorTol, util::ThreadLocalStorage& threadLocalMem)
+{
+}
+
+/**
+ * @brief Computes approximately / partially consistent initial time derivatives
+ * @details This function performs a relaxed consistent initialization: Only the time derivatives of the
+ *          mobile phase variables are updated such that the residual is 0 for them.
+ *
+ *     This function performs step 2. See leanConsistentInitialState() for step 1.
+ *
+ * @param [in] t Current time point
+ * @param [in] vecStateY (Lean) consistently initialized state vector
+ * @param [in,out] vecStateYdot On entry, inconsistent state time derivatives. On exit, partially consistent state time derivatives.
+ * @param [in] res On entry, residual without taking time derivatives into account. The data is overwritten during execution of the function.
+ */
+void CompartmentNetworkModel::leanConsistentInitialTimeDerivative(double t, double const* const vecStateY, double* const vecStateYdot, double* const res, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerConsistentInit);
+
+	Indexer idxr(_disc);
+
+	// Step 2: Compute the correct time derivative of the state vector (only mobile phase DOFs)
+
+	const double invBeta = (1.0 / static_cast<double>(_porosity) - 1.0);
+	for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+	{
+		// Offset to current compartment's c and q variables
+		const unsigned int localOffset = idxr.offsetC() + cmp * idxr.strideCompartment();
+		const unsigned int localOffsetQ = localOffset + idxr.strideLiquid();
+
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+		{
+			// dq_{i,j} / dt is assumed to be fixed, so bring it on the right hand side
+			for (unsigned int i = 0; i < _disc.nBound[comp]; ++i)
+			{
+				res[localOffset + comp] += invBeta * vecStateYdot[localOffsetQ + _disc.boundOffset[comp] + i];
+			}
+
+			vecStateYdot[localOffset + comp] = -res[localOffset + comp];
+		}
+	}
+}
+
+void CompartmentNetworkModel::initializeSensitivityStates(const std::vector<double*>& vecSensY) const
+{
+	Indexer idxr(_disc);
+	for (std::size_t param = 0; param < vecSensY.size(); ++param)
+	{
+		double* const stateYbulk = vecSensY[param] + idxr.offsetC();
+
+		// Loop over compartments
+		for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+		{
+			const unsigned int localOffset = cmp * idxr.strideCompartment();
+
+			// Loop over components in compartment
+			for (unsigned comp = 0; comp < _disc.nComp; ++comp)
+				stateYbulk[localOffset + comp * idxr.strideComp()] = _initC[comp].getADValue(param);
+
+			// Initialize q
+			for (unsigned int bnd = 0; bnd < _disc.strideBound; ++bnd)
+				stateYbulk[localOffset + idxr.strideLiquid() + bnd] = _initQ[bnd].getADValue(param);
+		}
+	}
+}
+
+/**
+ * @brief Computes consistent initial values and time derivatives of sensitivity subsystems
+ * @details Given the DAE \f[ F(t, y, \dot{y}) = 0, \f] and initial values \f$ y_0 \f$ and \f$ \dot{y}_0 \f$,
+ *          the sensitivity system for a parameter @f$ p @f$ reads
+ *          \f[ \frac{\partial F}{\partial y}(t, y, \dot{y}) s + \frac{\partial F}{\partial \dot{y}}(t, y, \dot{y}) \dot{s} + \frac{\partial F}{\partial p}(t, y, \dot{y}) = 0. \f]
+ *          The process follows closely the one of consistentInitialState() and consistentInitialTimeDerivative()
+ *          and, in fact, is a linearized version of it.
+ *
+ *     This function requires the parameter sensitivities to be computed beforehand and up-to-date Jacobians.
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in] simState Consistent state of the simulation (state vector and its time derivative)
+ * @param [in,out] vecSensY Sensitivity subsystem state vectors
+ * @param [in,out] vecSensYdot Time derivative state vectors of the sensitivity subsystems to be initialized
+ * @param [in] adRes Pointer to residual vector of AD datatypes with parameter sensitivities
+ */
+void CompartmentNetworkModel::consistentInitialSensitivity(const SimulationTime& simTime, const ConstSimulationState& simState,
+	std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active const* const adRes, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerConsistentInit);
+
+	Indexer idxr(_disc);
+
+	for (std::size_t param = 0; param < vecSensY.size(); ++param)
+	{
+		double* const sensY = vecSensY[param];
+		double* const sensYdot = vecSensYdot[param];
+
+		// Copy parameter derivative dF / dp from AD and negate it
+		for (unsigned int i = _disc.nComp; i < numDofs(); ++i)
+			sensYdot[i] = -adRes[i].getADValue(param);
+
+		// Step 1: Solve algebraic equations
+
+		if (_binding[0]->hasQuasiStationaryReactions())
+		{
+			int const* const qsMask = _binding[0]->reactionQuasiStationarity();
+			const linalg::ConstMaskArray mask{qsMask, static_cast<int>(_disc.strideBound)};
+			const int probSize = linalg::numMaskActive(mask);
+
+#ifdef CADET_PARALLELIZE
+			BENCH_SCOPE(_timerConsistentInitPar);
+			tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCompartment), [&](std::size_t cmp)
+#else
+			for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+#endif
+			{
+				const unsigned int jacRowOffset = idxr.strideCompartment() * cmp + static_cast<unsigned int>(idxr.strideLiquid());
+				const int localQOffset = idxr.offsetC() + cmp * idxr.strideCompartment() + idxr.strideLiquid();
+
+				// Reuse memory of band matrix for dense matrix
+				linalg::DenseMatrixView jacobianMatrix(_jacDisc.data() + cmp * _disc.strideBound * _disc.strideBound, _jacDisc.pivot() + cmp * _disc.strideBound, probSize, probSize);
+
+				// Get workspace memory
+				LinearBufferAllocator tlmAlloc = threadLocalMem.get();
+
+				BufferedArray<double> rhsBuffer = tlmAlloc.array<double>(probSize);
+				double* const rhs = static_cast<double*>(rhsBuffer);
+
+				BufferedArray<double> rhsUnmaskedBuffer = tlmAlloc.array<double>(_disc.strideBound);
+				double* const rhsUnmasked = static_cast<double*>(rhsUnmaskedBuffer);
+
+				double* const maskedMultiplier = _tempState + idxr.offsetC() + cmp * idxr.strideCompartment();
+
+				// Extract subproblem Jacobian from full Jacobian
+				jacobianMatrix.setAll(0.0);
+				linalg::copyMatrixSubset(_jac, mask, mask, jacRowOffset, 0, jacobianMatrix);
+
+				// Construct right hand side
+				linalg::selectVectorSubset(sensYdot + localQOffset, mask, rhs);
+
+				// Zero out masked elements
+				std::copy_n(sensY + localQOffset - idxr.strideLiquid(), idxr.strideCompartment(), maskedMultiplier);
+				linalg::fillVectorSubset(maskedMultiplier + _disc.nComp, mask, 0.0);
+
+				// Assemble right hand side
+				_jac.submatrixMultiplyVector(maskedMultiplier, jacRowOffset, -static_cast<int>(_disc.nComp), _disc.strideBound, idxr.strideCompartment(), rhsUnmasked);
+				linalg::vectorSubsetAdd(rhsUnmasked, mask, -1.0, 1.0, rhs);
+
+				// Precondition
+				double* const scaleFactors = _tempState + idxr.offsetC() + cmp * idxr.strideCompartment();
+				jacobianMatrix.rowScaleFactors(scaleFactors);
+				jacobianMatrix.scaleRows(scaleFactors);
+
+				// Solve
+				jacobianMatrix.factorize();
+				jacobianMatrix.solve(scaleFactors, rhs);
+
+				// Write back
+				linalg::applyVectorSubset(rhs, mask, sensY + localQOffset);
+			} CADET_PARFOR_END;
+		}
+
+		// Step 2: Compute the correct time derivative of the state vector
+
+		// Compute right hand side by adding -dF / dy * s = -J * s to -dF / dp which is already stored in sensYdot
+		multiplyWithJacobian(simTime, simState, sensY, -1.0, 1.0, sensYdot);
+
+		// Note that we have correctly negated the right hand side
+
+		_jacDisc.setAll(0.0);
+
+		const double invBeta = 1.0 / static_cast<double>(_porosity) - 1.0;
+		for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+		{
+			// Assemble
+			linalg::FactorizableBandMatrix::RowIterator jac = _jacDisc.row(idxr.strideCompartment() * cmp);
+
+			// Mobile and solid phase (advances jac accordingly)
+			addTimeDerivativeToJacobianCompartment(jac, idxr, 1.0, invBeta);
+
+			// Overwrite rows corresponding to algebraic equations with the Jacobian and set right hand side to 0
+			if (_binding[0]->hasQuasiStationaryReactions())
+			{
+				// Get iterators to beginning of solid phase
+				linalg::BandMatrix::RowIterator jacSolidOrig = _jac.row(idxr.strideCompartment() * cmp + idxr.strideLiquid());
+				linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideBound();
+
+				int const* const mask = _binding[0]->reactionQuasiStationarity();
+				double* const qShellDot = sensYdot + idxr.offsetC() + idxr.strideCompartment() * cmp + idxr.strideLiquid();
+
+				// Copy row from original Jacobian and set right hand side
+				for (unsigned int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
+				{
+					if (!mask[i])
+						continue;
+
+					jacSolid.copyRowFrom(jacSolidOrig);
+
+					// Right hand side is -\frac{\partial^2 res(t, y, \dot{y})}{\partial p \partial t}
+					// If the residual is not explicitly depending on time, this expression is 0
+					qShellDot[i] = 0.0;
+				}
+			}
+		}
+
+		// Precondition
+		double* const scaleFactors = _tempState + idxr.offsetC();
+		_jacDisc.rowScaleFactors(scaleFactors);
+		_jacDisc.scaleRows(scaleFactors);
+
+		// Factorize
+		const bool result = _jacDisc.factorize();
+		if (!result)
+		{
+			LOG(Error) << "Factorize() failed for compartment network";
+		}
+
+		const bool result2 = _jacDisc.solve(scaleFactors, sensYdot + idxr.offsetC());
+		if (!result2)
+		{
+			LOG(Error) << "Solve() failed for compartment network";
+		}
+	}
+}
+
+/**
+ * @brief Computes approximately / partially consistent initial values and time derivatives of sensitivity subsystems
+ * @details The process follows closely the one of leanConsistentInitialState() and leanConsistentInitialTimeDerivative()
+ *          and, in fact, is a linearized version of it.
+ *
+ *     This function requires the parameter sensitivities to be computed beforehand and up-to-date Jacobians.
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in] simState Consistent state of the simulation (state vector and its time derivative)
+ * @param [in,out] vecSensY Sensitivity subsystem state vectors
+ * @param [in,out] vecSensYdot Time derivative state vectors of the sensitivity subsystems to be initialized
+ * @param [in] adRes Pointer to residual vector of AD datatypes with parameter sensitivities
+ */
+void CompartmentNetworkModel::leanConsistentInitialSensitivity(const SimulationTime& simTime, const ConstSimulationState& simState,
+	std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active const* const adRes, util::ThreadLocalStorage& threadLocalMem)
+{
+	BENCH_SCOPE(_timerConsistentInit);
+
+	Indexer idxr(_disc);
+
+	for (std::size_t param = 0; param < vecSensY.size(); ++param)
+	{
+		double* const sensY = vecSensY[param];
+		double* const sensYdot = vecSensYdot[param];
+
+		// Copy parameter derivative from AD to tempState and negate it
+		for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+		{
+			const unsigned int localOffset = idxr.offsetC() + cmp * idxr.strideCompartment();
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			{
+				_tempState[localOffset + comp] = -adRes[localOffset + comp].getADValue(param);
+			}
+		}
+
+		// Step 2: Compute the correct time derivative of the state vector
+
+		// Compute right hand side by adding -dF / dy * s = -J * s to -dF / dp which is already stored in _tempState
+		multiplyWithJacobian(simTime, simState, sensY, -1.0, 1.0, _tempState);
+
+		const double invBeta = (1.0 / static_cast<double>(_porosity) - 1.0);
+		for (unsigned int cmp = 0; cmp < _disc.nCompartment; ++cmp)
+		{
+			// Offset to current compartment's c and q variables
+			const unsigned int localOffset = idxr.offsetC() + cmp * idxr.strideCompartment();
+			const unsigned int localOffsetQ = localOffset + idxr.strideLiquid();
+
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			{
+				// dq_{i,j} / dt is assumed to be fixed, so bring it on the right hand side
+				for (unsigned int i = 0; i < _disc.nBound[comp]; ++i)
+				{
+					_tempState[localOffset + comp] -= invBeta * sensYdot[localOffsetQ + _disc.boundOffset[comp] + i];
+				}
+
+				sensYdot[localOffset + comp] = _tempState[localOffset + comp];
+			}
+		}
+	}
+}
+
+
+int CompartmentNetworkModel::Exporter::writeMobilePhase(double* buffer) const
+{
+	const int stride = _idx.strideCompartment();
+	double const* ptr = _data + _idx.offsetC();
+	for (unsigned int i = 0; i < _disc.nCompartment; ++i)
+	{
+		std::copy_n(ptr, _disc.nComp, buffer);
+		buffer += _disc.nComp;
+		ptr += stride;
+	}
+	return _disc.nCompartment * _disc.nComp;
+}
+
+int CompartmentNetworkModel::Exporter::writeSolidPhase(double* buffer) const
+{
+	const int stride = _idx.strideCompartment();
+	double const* ptr = _data + _idx.offsetC() + _idx.strideLiquid();
+	for (unsigned int i = 0; i < _disc.nCompartment; ++i)
+	{
+		std::copy_n(ptr, _disc.strideBound, buffer);
+		buffer += _disc.strideBound;
+		ptr += stride;
+	}
+	return _disc.nCompartment * _disc.strideBound;
+}
+
+int CompartmentNetworkModel::Exporter::writeSolidPhase(unsigned int parType, double* buffer) const
+{
+	cadet_assert(parType == 0);
+	return writeSolidPhase(buffer);
+}
+
+int CompartmentNetworkModel::Exporter::writeInlet(unsigned int port, double* buffer) const
+{
+	cadet_assert(port == 0);
+	std::copy_n(_data, _disc.nComp, buffer);
+	return _disc.nComp;
+}
+
+int CompartmentNetworkModel::Exporter::writeInlet(double* buffer) const
+{
+	std::copy_n(_data, _disc.nComp, buffer);
+	return _disc.nComp;
+}
+
+int CompartmentNetworkModel::Exporter::writeOutlet(unsigned int port, double* buffer) const
+{
+	cadet_assert(port == 0);
+	std::copy_n(&_idx.c(_data, _model._outletCompartment, 0), _disc.nComp, buffer);
+	return _disc.nComp;
+}
+
+int CompartmentNetworkModel::Exporter::writeOutlet(double* buffer) const
+{
+	std::copy_n(&_idx.c(_data, _model._outletCompartment, 0), _disc.nComp, buffer);
+	return _disc.nComp;
+}
+
+
+void registerCompartmentNetworkModel(std::unordered_map<std::string, std::function<IUnitOperation*(UnitOpIdx)>>& models)
+{
+	models[CompartmentNetworkModel::identifier()] = [](UnitOpIdx uoId) { return new CompartmentNetworkModel(uoId); };
+}
+
+}  // namespace model
+
+}  // namespace cadet
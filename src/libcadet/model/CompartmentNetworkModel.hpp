@@ -0,0 +1,362 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a network of ideally mixed compartments with constant volume in a single unit operation.
+ */
+
+#ifndef LIBCADET_COMPARTMENTNETWORKMODEL_HPP_
+#define LIBCADET_COMPARTMENTNETWORKMODEL_HPP_
+
+#include "UnitOperationBase.hpp"
+#include "cadet/SolutionExporter.hpp"
+#include "AutoDiff.hpp"
+#include "linalg/SparseMatrix.hpp"
+#include "linalg/BandMatrix.hpp"
+#include "linalg/FactorizationCache.hpp"
+#include "Memory.hpp"
+#include "model/ModelUtils.hpp"
+
+#include <vector>
+
+#include "Benchmark.hpp"
+
+namespace cadet
+{
+
+namespace model
+{
+
+/**
+ * @brief Network of continuous stirred tank compartments with constant volume
+ * @details The compartments are coupled by an internal flow matrix @f$ Q @f$, where @f$ Q_{kl} @f$ denotes the
+ *          volumetric flow rate from compartment @f$ k @f$ to compartment @f$ l @f$. The unit inlet is
+ *          distributed among the compartments by fractions @f$ w_k @f$ and the unit outlet is connected
+ *          to a single compartment @f$ k_{\text{out}} @f$.
+ *
+ * @f[\begin{align}
+	\varepsilon V_k \left( \frac{\mathrm{d} c_{k,i}}{\mathrm{d} t} + \frac{1 - \varepsilon}{\varepsilon} \sum_{m} \frac{\mathrm{d} q_{k,i,m}}{\mathrm{d} t} \right) &= w_k F_{\text{in}} c_{\text{in},i} + \sum_{l} Q_{lk} c_{l,i} - \left( \sum_l Q_{kl} + \delta_{k,k_{\text{out}}} F_{\text{out}} \right) c_{k,i} + \varepsilon V_k f_{\text{react},i}\left( c_k, q_k \right) \\
+	a \frac{\mathrm{d} q_{k,i,m}}{\mathrm{d} t} &= f_{\text{iso}}(c_k, q_k)
+\end{align} @f]
+ *          The volumes are assumed to be constant, that is, the user has to make sure that the flow rates
+ *          entering and leaving each compartment are balanced.
+ *
+ *          All compartments share the same binding and reaction model, which are evaluated by the same
+ *          cell kernel as in the lumped rate model without pores. The state of each compartment is stored
+ *          contiguously (mobile phase followed by solid phase), so the Jacobian of the whole network is a
+ *          single band matrix. Its bandwidth is determined by the largest difference of compartment
+ *          indices connected by the flow matrix.
+ */
+class CompartmentNetworkModel : public UnitOperationBase
+{
+public:
+
+	CompartmentNetworkModel(UnitOpIdx unitOpIdx);
+	virtual ~CompartmentNetworkModel() CADET_NOEXCEPT;
+
+	virtual unsigned int numDofs() const CADET_NOEXCEPT;
+	virtual unsigned int numPureDofs() const CADET_NOEXCEPT;
+	virtual bool usesAD() const CADET_NOEXCEPT;
+	virtual unsigned int requiredADdirs() const CADET_NOEXCEPT;
+
+	virtual UnitOpIdx unitOperationId() const CADET_NOEXCEPT { return _unitOpIdx; }
+	virtual unsigned int numComponents() const CADET_NOEXCEPT { return _disc.nComp; }
+	virtual void setFlowRates(active const* in, active const* out) CADET_NOEXCEPT;
+	virtual unsigned int numInletPorts() const CADET_NOEXCEPT { return 1; }
+	virtual unsigned int numOutletPorts() const CADET_NOEXCEPT { return 1; }
+	virtual bool canAccumulate() const CADET_NOEXCEPT { return false; }
+
+	static const char* identifier() { return "COMPARTMENT_NETWORK"; }
+	virtual const char* unitOperationName() const CADET_NOEXCEPT { return identifier(); }
+
+	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
+	virtual bool configure(IParameterProvider& paramProvider);
+	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+
+	virtual void useAnalyticJacobian(const bool analyticJac);
+
+	virtual void reportSolution(ISolutionRecorder& recorder, double const* const solution) const;
+	virtual void reportSolutionStructure(ISolutionRecorder& recorder) const;
+
+	virtual int residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual int residualWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem);
+	virtual int residualSensFwdAdOnly(const SimulationTime& simTime, const ConstSimulationState& simState, active* const adRes, util::ThreadLocalStorage& threadLocalMem);
+	virtual int residualSensFwdWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual int residualSensFwdCombine(const SimulationTime& simTime, const ConstSimulationState& simState,
+		const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes,
+		double* const tmp1, double* const tmp2, double* const tmp3);
+
+	virtual int linearSolve(double t, double alpha, double tol, double* const rhs, double const* const weight,
+		const ConstSimulationState& simState);
+
+	virtual void prepareADvectors(const AdJacobianParams& adJac) const;
+
+	virtual void applyInitialCondition(const SimulationState& simState) const;
+	virtual void readInitialCondition(IParameterProvider& paramProvider);
+
+	virtual void consistentInitialState(const SimulationTime& simTime, double* const vecStateY, const AdJacobianParams& adJac, double errorTol, util::ThreadLocalStorage& threadLocalMem);
+	virtual void consistentInitialTimeDerivative(const SimulationTime& simTime, double const* vecStateY, double* const vecStateYdot, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual void initializeSensitivityStates(const std::vector<double*>& vecSensY) const;
+	virtual void consistentInitialSensitivity(const SimulationTime& simTime, const ConstSimulationState& simState,
+		std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active const* const adRes, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual void leanConsistentInitialState(const SimulationTime& simTime, double* const vecStateY, const AdJacobianParams& adJac, double errorTol, util::ThreadLocalStorage& threadLocalMem);
+	virtual void leanConsistentInitialTimeDerivative(double t, double const* const vecStateY, double* const vecStateYdot, double* const res, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual void leanConsistentInitialSensitivity(const SimulationTime& simTime, const ConstSimulationState& simState,
+		std::vector<double*>& vecSensY, std::vector<double*>& vecSensYdot, active const* const adRes, util::ThreadLocalStorage& threadLocalMem);
+
+	virtual bool hasInlet() const CADET_NOEXCEPT { return true; }
+	virtual bool hasOutlet() const CADET_NOEXCEPT { return true; }
+
+	virtual unsigned int localOutletComponentIndex(unsigned int port) const CADET_NOEXCEPT;
+	virtual unsigned int localOutletComponentStride(unsigned int port) const CADET_NOEXCEPT;
+	virtual unsigned int localInletComponentIndex(unsigned int port) const CADET_NOEXCEPT;
+	virtual unsigned int localInletComponentStride(unsigned int port) const CADET_NOEXCEPT;
+
+	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size);
+	virtual void setSectionTimes(double const* secTimes, bool const* secContinuity, unsigned int nSections) { }
+
+	virtual void expandErrorTol(double const* errorSpec, unsigned int errorSpecSize, double* expandOut);
+
+	virtual void multiplyWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double alpha, double beta, double* ret);
+	virtual void multiplyWithDerivativeJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* sDot, double* ret);
+
+	inline void multiplyWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double* ret)
+	{
+		multiplyWithJacobian(simTime, simState, yS, 1.0, 0.0, ret);
+	}
+
+	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
+
+#ifdef CADET_BENCHMARK_MODE
+	virtual std::vector<double> benchmarkTimings() const
+	{
+		return std::vector<double>({
+			static_cast<double>(numDofs()),
+			_timerResidual.totalElapsedTime(),
+			_timerResidualPar.totalElapsedTime(),
+			_timerResidualSens.totalElapsedTime(),
+			_timerResidualSensPar.totalElapsedTime(),
+			_timerConsistentInit.totalElapsedTime(),
+			_timerConsistentInitPar.totalElapsedTime(),
+			_timerLinearSolve.totalElapsedTime()
+		});
+	}
+
+	virtual char const* const* benchmarkDescriptions() const
+	{
+		static const char* const desc[] = {
+			"DOFs",
+			"Residual",
+			"ResidualPar",
+			"ResidualSens",
+			"ResidualSensPar",
+			"ConsistentInit",
+			"ConsistentInitPar",
+			"LinearSolve"
+		};
+		return desc;
+	}
+#endif
+
+protected:
+
+	class Indexer;
+
+	int residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem, bool updateJacobian, bool paramSensitivity);
+
+	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+	int residualImpl(double t, unsigned int secIdx, StateType const* const y, double const* const yDot, ResidualType* const res, util::ThreadLocalStorage& threadLocalMem);
+
+	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+	void residualFlow(StateType const* const y, ResidualType* const res);
+
+	void assembleInletJacobian();
+	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
+
+	void assembleDiscretizedJacobian(double alpha, const Indexer& idxr);
+	void addTimeDerivativeToJacobianCompartment(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, double invBeta) const;
+
+#ifdef CADET_CHECK_ANALYTIC_JACOBIAN
+	void checkAnalyticJacobianAgainstAd(active const* const adRes, unsigned int adDirOffset) const;
+#endif
+
+	struct Discretization
+	{
+		unsigned int nComp; //!< Number of components
+		unsigned int nCompartment; //!< Number of compartments
+		unsigned int* nBound; //!< Array with number of bound states for each component
+		unsigned int* boundOffset; //!< Array with offset to the first bound state of each component in the solid phase
+		unsigned int strideBound; //!< Total number of bound states
+	};
+
+	Discretization _disc; //!< Discretization info
+
+	std::vector<unsigned int> _flowSource; //!< Source compartment of each nonzero entry of the flow matrix
+	std::vector<unsigned int> _flowTarget; //!< Target compartment of each nonzero entry of the flow matrix
+	std::vector<active> _flow; //!< Nonzero entries of the flow matrix, i.e., internal volumetric flow rates
+	std::vector<active> _volume; //!< Volume of each compartment
+	std::vector<active> _inletDistribution; //!< Fraction of the inlet flow entering each compartment
+	unsigned int _outletCompartment; //!< Index of the compartment connected to the outlet
+	active _porosity; //!< Porosity \f$ \varepsilon \f$ (ratio of liquid volume to compartment volume)
+	active _flowRateIn; //!< Volumetric flow rate of the unit inlet
+	active _flowRateOut; //!< Volumetric flow rate of the unit outlet
+
+	linalg::BandMatrix _jac; //!< Jacobian
+	linalg::FactorizableBandMatrix _jacDisc; //!< Jacobian with time derivatives from BDF method
+	linalg::FactorizableBandMatrix const* _jacDiscFactorized; //!< Factorized Jacobian with time derivatives used by linearSolve()
+
+	linalg::FactorizationCache<linalg::FactorizableBandMatrix> _jacDiscCache; //!< Factorizations of _jacDisc for different BDF factors if the Jacobian is constant
+	linalg::BandMatrix _jacCacheRef; //!< Jacobian from which the factorizations in _jacDiscCache have been assembled
+	bool _constJacobian; //!< Determines whether the Jacobian is constant within the current section
+	bool _jacobianCurrent; //!< Determines whether _jac holds the constant Jacobian of the current section
+	bool _checkJacobianCache; //!< Determines whether _jac has been reevaluated and needs to be checked against _jacCacheRef
+	double _jacFlowRateOut; //!< Outlet flow rate at which _jac has been evaluated
+
+	linalg::DoubleSparseMatrix _jacInlet; //!< Jacobian inlet DOF block matrix connects inlet DOFs to the compartments fed by the inlet
+
+	bool _analyticJac; //!< Determines whether AD or analytic Jacobians are used
+	unsigned int _jacobianAdDirs; //!< Number of AD seed vectors required for Jacobian computation
+
+	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
+	double* _tempState; //!< Temporary storage with the size of the state vector or larger if binding models require it
+
+	std::vector<active> _initC; //!< Liquid phase initial conditions
+	std::vector<active> _initQ; //!< Solid phase initial conditions
+	std::vector<double> _initState; //!< Initial conditions for state vector if given
+	std::vector<double> _initStateDot; //!< Initial conditions for time derivative
+
+	BENCH_TIMER(_timerResidual)
+	BENCH_TIMER(_timerResidualPar)
+	BENCH_TIMER(_timerResidualSens)
+	BENCH_TIMER(_timerResidualSensPar)
+	BENCH_TIMER(_timerConsistentInit)
+	BENCH_TIMER(_timerConsistentInitPar)
+	BENCH_TIMER(_timerLinearSolve)
+
+	class Indexer
+	{
+	public:
+		Indexer(const Discretization& disc) : _disc(disc) { }
+
+		// Strides
+		inline int strideCompartment() const CADET_NOEXCEPT { return static_cast<int>(_disc.nComp + _disc.strideBound); }
+		inline int strideComp() const CADET_NOEXCEPT { return 1; }
+
+		inline int strideLiquid() const CADET_NOEXCEPT { return static_cast<int>(_disc.nComp); }
+		inline int strideBound() const CADET_NOEXCEPT { return static_cast<int>(_disc.strideBound); }
+
+		// Offsets
+		inline int offsetC() const CADET_NOEXCEPT { return _disc.nComp; }
+		inline int offsetBoundComp(unsigned int comp) const CADET_NOEXCEPT { return _disc.boundOffset[comp]; }
+
+		// Return pointer to first element of state variable in state vector
+		template <typename real_t> inline real_t* c(real_t* const data) const { return data + offsetC(); }
+		template <typename real_t> inline real_t const* c(real_t const* const data) const { return data + offsetC(); }
+
+		template <typename real_t> inline real_t* q(real_t* const data) const { return data + offsetC() + strideLiquid(); }
+		template <typename real_t> inline real_t const* q(real_t const* const data) const { return data + offsetC() + strideLiquid(); }
+
+		// Return specific variable in state vector
+		template <typename real_t> inline real_t& c(real_t* const data, unsigned int compartment, unsigned int comp) const { return data[offsetC() + comp + compartment * strideCompartment()]; }
+		template <typename real_t> inline const real_t& c(real_t const* const data, unsigned int compartment, unsigned int comp) const { return data[offsetC() + comp + compartment * strideCompartment()]; }
+
+	protected:
+		const Discretization& _disc;
+	};
+
+	class Exporter : public ISolutionExporter
+	{
+	public:
+
+		Exporter(const Discretization& disc, const CompartmentNetworkModel& model, double const* data) : _disc(disc), _idx(disc), _model(model), _data(data) { }
+		Exporter(const Discretization&& disc, const CompartmentNetworkModel& model, double const* data) = delete;
+
+		virtual bool hasParticleFlux() const CADET_NOEXCEPT { return false; }
+		virtual bool hasParticleMobilePhase() const CADET_NOEXCEPT { return false; }
+		virtual bool hasSolidPhase() const CADET_NOEXCEPT { return _disc.strideBound > 0; }
+		virtual bool hasVolume() const CADET_NOEXCEPT { return false; }
+		virtual bool isParticleLumped() const CADET_NOEXCEPT { return false; }
+		virtual bool hasPrimaryExtent() const CADET_NOEXCEPT { return true; }
+
+		virtual unsigned int numComponents() const CADET_NOEXCEPT { return _disc.nComp; }
+		virtual unsigned int numPrimaryCoordinates() const CADET_NOEXCEPT { return _disc.nCompartment; }
+		virtual unsigned int numSecondaryCoordinates() const CADET_NOEXCEPT { return 0; }
+		virtual unsigned int numInletPorts() const CADET_NOEXCEPT { return 1; }
+		virtual unsigned int numOutletPorts() const CADET_NOEXCEPT { return 1; }
+		virtual unsigned int numParticleTypes() const CADET_NOEXCEPT { return 1; }
+		virtual unsigned int numParticleShells(unsigned int parType) const CADET_NOEXCEPT { return 0; }
+		virtual unsigned int numBoundStates(unsigned int parType) const CADET_NOEXCEPT { return _disc.strideBound; }
+		virtual unsigned int numMobilePhaseDofs() const CADET_NOEXCEPT { return _disc.nComp * _disc.nCompartment; }
+		virtual unsigned int numParticleMobilePhaseDofs(unsigned int parType) const CADET_NOEXCEPT { return 0; }
+		virtual unsigned int numParticleMobilePhaseDofs() const CADET_NOEXCEPT { return 0; }
+		virtual unsigned int numSolidPhaseDofs(unsigned int parType) const CADET_NOEXCEPT { return _disc.strideBound * _disc.nCompartment; }
+		virtual unsigned int numSolidPhaseDofs() const CADET_NOEXCEPT { return _disc.strideBound * _disc.nCompartment; }
+		virtual unsigned int numParticleFluxDofs() const CADET_NOEXCEPT { return 0u; }
+		virtual unsigned int numVolumeDofs() const CADET_NOEXCEPT { return 0; }
+
+		virtual int writeMobilePhase(double* buffer) const;
+		virtual int writeSolidPhase(double* buffer) const;
+		virtual int writeParticleMobilePhase(double* buffer) const { return 0; }
+		virtual int writeSolidPhase(unsigned int parType, double* buffer) const;
+		virtual int writeParticleMobilePhase(unsigned int parType, double* buffer) const { return 0; }
+		virtual int writeParticleFlux(double* buffer) const { return 0; }
+		virtual int writeParticleFlux(unsigned int parType, double* buffer) const { return 0; }
+		virtual int writeVolume(double* buffer) const { return 0; }
+		virtual int writeInlet(unsigned int port, double* buffer) const;
+		virtual int writeInlet(double* buffer) const;
+		virtual int writeOutlet(unsigned int port, double* buffer) const;
+		virtual int writeOutlet(double* buffer) const;
+
+		virtual double const* concentration() const { return _idx.c(_data); }
+		virtual double const* flux() const { return nullptr; }
+		virtual double const* particleMobilePhase(unsigned int parType) const { return nullptr; }
+		virtual double const* solidPhase(unsigned int parType) const { return _idx.q(_data); }
+		virtual double const* volume() const { return nullptr; }
+		virtual double const* inlet(unsigned int port, unsigned int& stride) const
+		{
+			stride = _idx.strideComp();
+			return _data;
+		}
+		virtual double const* outlet(unsigned int port, unsigned int& stride) const
+		{
+			stride = _idx.strideComp();
+			return &_idx.c(_data, _model._outletCompartment, 0);
+		}
+
+		virtual int writePrimaryCoordinates(double* coords) const
+		{
+			// Compartments are identified by their index
+			for (unsigned int i = 0; i < _disc.nCompartment; ++i)
+				coords[i] = static_cast<double>(i);
+			return _disc.nCompartment;
+		}
+		virtual int writeSecondaryCoordinates(double* coords) const { return 0; }
+		virtual int writeParticleCoordinates(unsigned int parType, double* coords) const { return 0; }
+
+	protected:
+		const Discretization& _disc;
+		const Indexer _idx;
+		const CompartmentNetworkModel& _model;
+		double const* const _data;
+	};
+};
+
+} // namespace model
+} // namespace cadet
+
+#endif  // LIBCADET_COMPARTMENTNETWORKMODEL_HPP_
@@ -113,6 +113,21 @@ namespace model
 					LOG(Warning) << "Index " << _extFunIndex[i] << " exceeds number of passed external functions (" << size << "), external dependence is ignored";
 				}
 			}
+
+			// Parameters sharing an external function reuse the evaluation of the first parameter
+			_extFunSource.resize(_extFun.size());
+			for (std::size_t i = 0; i < _extFun.size(); ++i)
+			{
+				_extFunSource[i] = static_cast<int>(i);
+				for (std::size_t j = 0; j < i; ++j)
+				{
+					if (_extFun[i] && (_extFun[j] == _extFun[i]))
+					{
+						_extFunSource[i] = static_cast<int>(j);
+						break;
+					}
+				}
+			}
 		}
 
 		/**
@@ -133,8 +148,9 @@ namespace model
 
 		std::vector<IExternalFunction*> _extFun; //!< Pointer to the external function
 		std::vector<int> _extFunIndex; //!< Index to the external function
+		std::vector<int> _extFunSource; //!< Index of the first parameter that uses the same external function
 
-		ExternalParamHandlerBase() : _extFun(), _extFunIndex() { }
+		ExternalParamHandlerBase() : _extFun(), _extFunIndex(), _extFunSource() { }
 		
 		/**
 		 * @brief Configures the external data source of this externally dependent parameter set
@@ -179,10 +195,12 @@ namespace model
 			for (unsigned int i = 0; i < nParams; ++i)
 			{
 				IExternalFunction* const fun = _extFun[i];
-				if (fun)
-					buffer[i] = fun->externalProfile(t, colPos.axial, colPos.radial, colPos.particle, secIdx);
-				else
+				if (!fun)
 					buffer[i] = 0.0;
+				else if (_extFunSource[i] < static_cast<int>(i))
+					buffer[i] = buffer[_extFunSource[i]];
+				else
+					buffer[i] = fun->externalProfile(t, colPos.axial, colPos.radial, colPos.particle, secIdx);
 			}
 		}
 
@@ -200,10 +218,12 @@ namespace model
 			for (unsigned int i = 0; i < nParams; ++i)
 			{
 				IExternalFunction* const fun = _extFun[i];
-				if (fun)
-					buffer[i] = fun->timeDerivative(t, colPos.axial, colPos.radial, colPos.particle, secIdx);
-				else
+				if (!fun)
 					buffer[i] = 0.0;
+				else if (_extFunSource[i] < static_cast<int>(i))
+					buffer[i] = buffer[_extFunSource[i]];
+				else
+					buffer[i] = fun->timeDerivative(t, colPos.axial, colPos.radial, colPos.particle, secIdx);
 			}
 		}
 	};
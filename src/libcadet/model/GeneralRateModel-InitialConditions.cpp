@@ -355,7 +355,7 @@ void GeneralRateModel::consistentInitialState(const SimulationTime& simTime, dou
 			linalg::DenseMatrixView fullJacobianMatrix(_jacPdisc[type * _disc.nCol + pblk].data(), nullptr, mask.len, mask.len);
 
 			// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-			const double z = (0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol);
+			const double z = _convDispOp.relativeCoordinate(pblk);
 
 			// Get workspace memory
 			BufferedArray<double> nonlinMemBuffer = tlmAlloc.array<double>(_nonlinearSolver->workspaceSize(probSize));
@@ -670,7 +670,7 @@ void GeneralRateModel::consistentInitialTimeDerivative(const SimulationTime& sim
 		const unsigned int par = pblk % _disc.nCol;
 
 		// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-		const double z = (0.5 + static_cast<double>(par)) / static_cast<double>(_disc.nCol);
+		const double z = _convDispOp.relativeCoordinate(par);
 
 		// Assemble
 		linalg::FactorizableBandMatrix& fbm = _jacPdisc[pblk];
@@ -819,7 +819,7 @@ void GeneralRateModel::leanConsistentInitialState(const SimulationTime& simTime,
 				LinearBufferAllocator tlmAlloc = threadLocalMem.get();
 
 				// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-				const double z = (0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol);
+				const double z = _convDispOp.relativeCoordinate(pblk);
 
 				const int localOffsetToParticle = idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{static_cast<unsigned int>(pblk)});
 				for(std::size_t shell = 0; shell < static_cast<std::size_t>(_disc.nParCell[type]); ++shell)
@@ -156,15 +156,36 @@ int GeneralRateModel::linearSolve(double t, double alpha, double outerTol, doubl
 				// Assemble
 				assembleDiscretizedJacobianParticleBlock(type, par, alpha, idxr);
 
-				// Factorize
-				const bool result = _jacPdisc[pblk].factorize();
-				if (cadet_unlikely(!result))
+				if (_batchedParticleSolver)
+				{
+					// Move block to batch, which is factorized below as a whole
+					_jacPdiscBatched[type].copyBlock(par, _jacPdisc[pblk]);
+				}
+				else
 				{
+					// Factorize
+					const bool result = _jacPdisc[pblk].factorize();
+					if (cadet_unlikely(!result))
 					{
-						LOG(Error) << "Factorize() failed for par block " << pblk;
+						{
+							LOG(Error) << "Factorize() failed for par block " << pblk;
+						}
 					}
 				}
 			} CADET_PARFOR_END;
+
+			// Factorize all particle blocks of a type at once
+			if (_batchedParticleSolver)
+			{
+				for (unsigned int type = 0; type < _disc.nParType; ++type)
+				{
+					const bool result = _jacPdiscBatched[type].factorize();
+					if (cadet_unlikely(!result))
+					{
+						LOG(Error) << "Factorize() failed for batched par blocks of type " << type;
+					}
+				}
+			}
 		} CADET_PARNODE_END;
 
 #ifndef CADET_PARALLELIZE
@@ -204,20 +225,25 @@ int GeneralRateModel::linearSolve(double t, double alpha, double outerTol, doubl
 	node_t E(g, [&](msg_t)
 #endif
 	{
+		if (_batchedParticleSolver)
+			solveParticleBlocksBatched(rhs, idxr);
+		else
+		{
 #ifdef CADET_PARALLELIZE
-		tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol * _disc.nParType), [&](std::size_t pblk)
+			tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nCol * _disc.nParType), [&](std::size_t pblk)
 #else
-		for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType; ++pblk)
+			for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType; ++pblk)
 #endif
-		{
-			const unsigned int type = pblk / _disc.nCol;
-			const unsigned int par = pblk % _disc.nCol;
-			const bool result = _jacPdisc[pblk].solve(rhs + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par}));
-			if (cadet_unlikely(!result))
 			{
-				LOG(Error) << "Solve() failed for par block " << pblk;
-			}
-		} CADET_PARFOR_END;
+				const unsigned int type = pblk / _disc.nCol;
+				const unsigned int par = pblk % _disc.nCol;
+				const bool result = _jacPdisc[pblk].solve(rhs + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par}));
+				if (cadet_unlikely(!result))
+				{
+					LOG(Error) << "Solve() failed for par block " << pblk;
+				}
+			} CADET_PARFOR_END;
+		}
 	} CADET_PARNODE_END;
 
 	// Solve last row of L with backwards substitution: y_f = b_f - \sum_{i=0}^{N_z} J_{f,i} y_i
@@ -309,17 +335,34 @@ int GeneralRateModel::linearSolve(double t, double alpha, double outerTol, doubl
 
 			// Compute tempState_i = J_{i,f} * y_f
 			_jacPF[pblk].multiplyAdd(rhs + idxr.offsetJf(), localPar);
-			// Apply J_i^{-1} to tempState_i
-			const bool result = _jacPdisc[pblk].solve(localPar);
-			if (cadet_unlikely(!result))
+
+			// Batched particle blocks are solved together below
+			if (!_batchedParticleSolver)
 			{
-				LOG(Error) << "Solve() failed for par block " << pblk;
+				// Apply J_i^{-1} to tempState_i
+				const bool result = _jacPdisc[pblk].solve(localPar);
+				if (cadet_unlikely(!result))
+				{
+					LOG(Error) << "Solve() failed for par block " << pblk;
+				}
+
+				// Compute rhs_i = y_i - J_i^{-1} * J_{i,f} * y_f = y_i - tempState_i
+				for (int i = 0; i < idxr.strideParBlock(type); ++i)
+					rhsPar[i] -= localPar[i];
 			}
+		} CADET_PARFOR_END;
+
+		if (_batchedParticleSolver)
+		{
+			// Apply J_i^{-1} to all tempState_i
+			solveParticleBlocksBatched(_tempState, idxr);
 
-			// Compute rhs_i = y_i - J_i^{-1} * J_{i,f} * y_f = y_i - tempState_i
-			for (int i = 0; i < idxr.strideParBlock(type); ++i)
+			// Compute rhs_i = y_i - tempState_i for all particle blocks
+			double* const localPar = _tempState + idxr.offsetCp();
+			double* const rhsPar = rhs + idxr.offsetCp();
+			for (int i = 0; i < idxr.offsetJf() - idxr.offsetCp(); ++i)
 				rhsPar[i] -= localPar[i];
-		} CADET_PARFOR_END;
+		}
 	} CADET_PARNODE_END;
 
 #ifdef CADET_PARALLELIZE
@@ -425,13 +468,22 @@ int GeneralRateModel::schurComplementMatrixVector(double const* x, double* z) co
 
 			// Apply J_{i,f}
 			_jacPF[pblk].multiplyAdd(x, tmp);
-			// Apply J_{i}^{-1}
-			const bool result = _jacPdisc[pblk].solve(tmp);
-			if (cadet_unlikely(!result))
+
+			// Batched particle blocks are solved together below
+			if (!_batchedParticleSolver)
 			{
-				LOG(Error) << "Solve() failed for par block " << pblk;
+				// Apply J_{i}^{-1}
+				const bool result = _jacPdisc[pblk].solve(tmp);
+				if (cadet_unlikely(!result))
+				{
+					LOG(Error) << "Solve() failed for par block " << pblk;
+				}
 			}
 		} CADET_PARFOR_END;
+
+		// Apply J_{i}^{-1} to all particle blocks at once
+		if (_batchedParticleSolver)
+			solveParticleBlocksBatched(_tempState, idxr);
 	} CADET_PARNODE_END;
 
 #ifdef CADET_PARALLELIZE
@@ -466,6 +518,30 @@ int GeneralRateModel::schurComplementMatrixVector(double const* x, double* z) co
 	return 0;
 }
 
+/**
+ * @brief Solves the linear systems with all particle Jacobian blocks @f$ J_i @f$ using the batched factorization
+ * @details Applies @f$ J_i^{-1} @f$ in-place to the particle part of the given vector for all particle
+ *          blocks. The blocks of a particle type are solved simultaneously using the interleaved
+ *          factorizations in _jacPdiscBatched.
+ * @param [in,out] vec Vector (of full state vector size) whose particle blocks are overwritten by the solutions
+ * @param [in] idxr Indexer
+ */
+void GeneralRateModel::solveParticleBlocksBatched(double* const vec, const Indexer& idxr) const
+{
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(std::size_t(0), static_cast<std::size_t>(_disc.nParType), [&](std::size_t type)
+#else
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+#endif
+	{
+		const bool result = _jacPdiscBatched[type].solve(vec + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)}), idxr.strideParBlock(type));
+		if (cadet_unlikely(!result))
+		{
+			LOG(Error) << "Solve() failed for batched par blocks of type " << type;
+		}
+	} CADET_PARFOR_END;
+}
+
 /**
  * @brief Assembles a particle Jacobian block @f$ J_i @f$ (@f$ i > 0 @f$) of the time-discretized equations
  * @details The system \f[ \left( \frac{\partial F}{\partial y} + \alpha \frac{\partial F}{\partial \dot{y}} \right) x = b \f]
@@ -31,6 +31,7 @@
 
 #include "Stencil.hpp"
 #include "Weno.hpp"
+#include "SpectralElement.hpp"
 #include "AdUtils.hpp"
 #include "SensParamUtil.hpp"
 
@@ -66,7 +67,7 @@ int schurComplementMultiplierGRM(void* userData, double const* x, double* z)
 
 GeneralRateModel::GeneralRateModel(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
 	_hasSurfaceDiffusion(0, false), _dynReactionBulk(nullptr),
-	_jacP(nullptr), _jacPdisc(nullptr), _jacPF(nullptr), _jacFP(nullptr), _jacInlet(), _hasParDepSurfDiffusion(false),
+	_jacP(nullptr), _jacPdisc(nullptr), _jacPdiscBatched(nullptr), _batchedParticleSolver(false), _jacPF(nullptr), _jacFP(nullptr), _jacInlet(), _hasParDepSurfDiffusion(false),
 	_analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr),
 	_initC(0), _initCp(0), _initQ(0), _initState(0), _initStateDot(0)
 {
@@ -81,6 +82,7 @@ GeneralRateModel::~GeneralRateModel() CADET_NOEXCEPT
 
 	delete[] _jacP;
 	delete[] _jacPdisc;
+	delete[] _jacPdiscBatched;
 
 	delete _dynReactionBulk;
 
@@ -164,7 +166,7 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 	if (nBound.size() < _disc.nComp)
 		throw InvalidParameterException("Field NBOUND contains too few elements (NCOMP = " + std::to_string(_disc.nComp) + " required)");
 
-	_disc.nCol = paramProvider.getInt("NCOL");
+	_disc.nCol = parts::ConvectionDispersionOperatorBase::readNumAxialPoints(paramProvider);
 
 	const std::vector<int> nParCell = paramProvider.getIntArray("NPAR");
 
@@ -269,6 +271,8 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 			_parDiscType[i] = ParticleDiscretizationMode::Equivolume;
 		else if (pdt[i] == "USER_DEFINED_PAR")
 			_parDiscType[i] = ParticleDiscretizationMode::UserDefined;
+		else if (pdt[i] == "COLLOCATION_PAR")
+			_parDiscType[i] = ParticleDiscretizationMode::Collocation;
 	}
 
 	// Read particle geometry and default to "SPHERICAL"
@@ -299,6 +303,23 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 	}
 	paramProvider.pushScope("discretization");
 
+	// Precompute collocation operators, which only depend on number of nodes and particle geometry
+	_parCollocNodes.resize(nTotalParCells, 0.0);
+	_parCollocMass.resize(nTotalParCells, 0.0);
+	_parCollocOpOffset.resize(_disc.nParType + 1, 0);
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		const unsigned int opSize = (_parDiscType[i] == ParticleDiscretizationMode::Collocation) ? _disc.nParCell[i] * _disc.nParCell[i] : 0;
+		_parCollocOpOffset[i + 1] = _parCollocOpOffset[i] + opSize;
+	}
+	_parCollocOp.resize(_parCollocOpOffset[_disc.nParType], 0.0);
+
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		if (_parDiscType[i] == ParticleDiscretizationMode::Collocation)
+			assembleCollocationOperator(i);
+	}
+
 	if (paramProvider.exists("PAR_DISC_VECTOR"))
 	{
 		_parDiscVector = paramProvider.getDoubleArray("PAR_DISC_VECTOR");
@@ -314,6 +335,17 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 	const bool analyticJac = false;
 #endif
 
+	// Determine whether diagonal blocks are factorized in single precision with iterative refinement
+	const bool mixedPrecision = paramProvider.exists("MIXED_PRECISION") && paramProvider.getBool("MIXED_PRECISION");
+	const int refinementSteps = paramProvider.exists("MIXED_PRECISION_REFINEMENT_STEPS") ? paramProvider.getInt("MIXED_PRECISION_REFINEMENT_STEPS") : 2;
+	if (refinementSteps < 0)
+		throw InvalidParameterException("Field MIXED_PRECISION_REFINEMENT_STEPS has to be non-negative");
+
+	// Determine whether all particle blocks of a type are factorized together with interleaved storage
+	_batchedParticleSolver = paramProvider.exists("BATCHED_PARTICLE_SOLVER") && paramProvider.getBool("BATCHED_PARTICLE_SOLVER");
+	if (_batchedParticleSolver && mixedPrecision)
+		throw InvalidParameterException("Fields BATCHED_PARTICLE_SOLVER and MIXED_PRECISION cannot be enabled at the same time");
+
 	// Read bulk-particle interface discretization order
 	// Default to second order
 	_colParBoundaryOrder = 2;
@@ -401,6 +433,12 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 		_parDepSurfDiffusion = std::vector<IParameterDependence*>(_disc.nParType, nullptr);
 	}
 
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		if ((_parDiscType[i] == ParticleDiscretizationMode::Collocation) && _parDepSurfDiffusion[i])
+			throw InvalidParameterException("Particle type " + std::to_string(i) + " uses COLLOCATION_PAR, which does not support PAR_SURFDIFFUSION_DEP");
+	}
+
 	if (optimizeParticleJacobianBandwidth)
 	{
 		// Check whether surface diffusion is present
@@ -545,6 +583,7 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 
 	_jacP = new linalg::BandMatrix[_disc.nCol * _disc.nParType];
 	_jacPdisc = new linalg::FactorizableBandMatrix[_disc.nCol * _disc.nParType];
+	_jacPdiscBatched = _batchedParticleSolver ? new linalg::BatchedBandMatrix[_disc.nParType] : nullptr;
 	for (unsigned int j = 0; j < _disc.nParType; ++j)
 	{
 		linalg::BandMatrix* const ptrJac = _jacP + _disc.nCol * j;
@@ -555,7 +594,13 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 		unsigned int lowerBandwidth = cellSize;
 		unsigned int upperBandwidth = cellSize;
 
-		if (_hasSurfaceDiffusion[j])
+		if (_parDiscType[j] == ParticleDiscretizationMode::Collocation)
+		{
+			// Collocation couples all nodes -> dense block
+			lowerBandwidth = _disc.nParCell[j] * cellSize - 1;
+			upperBandwidth = lowerBandwidth;
+		}
+		else if (_hasSurfaceDiffusion[j])
 		{
 			unsigned int const* const nBound = _disc.nBound + _disc.nComp * j;
 			for (unsigned int i = 0; i < _disc.nComp; ++i)
@@ -600,7 +645,11 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 		{
 			ptrJac[i].resize(_disc.nParCell[j] * cellSize, lowerBandwidth, upperBandwidth);
 			ptrJacDisc[i].resize(_disc.nParCell[j] * cellSize, lowerBandwidth, upperBandwidth);
+			ptrJacDisc[i].setMixedPrecision(mixedPrecision, refinementSteps);
 		}
+
+		if (_batchedParticleSolver)
+			_jacPdiscBatched[j].resize(_disc.nCol, _disc.nParCell[j] * cellSize, lowerBandwidth, upperBandwidth);
 	}
 
 	_jacPF = new linalg::DoubleSparseMatrix[_disc.nCol * _disc.nParType];
@@ -611,7 +660,7 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 		const int type = i / _disc.nCol;
 
 		int nonZeroFP = _disc.nComp;
-		if (_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1))
+		if (_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation))
 		{
 			// Contribution of surface diffusion gradient
 			nonZeroFP += 2 * _disc.strideBound[type];
@@ -628,7 +677,8 @@ bool GeneralRateModel::configureModelDiscretization(IParameterProvider& paramPro
 	_jacCF.resize(_disc.nComp * _disc.nCol * _disc.nParType);
 	_jacFC.resize(_disc.nComp * _disc.nCol * _disc.nParType);
 
-	_discParFlux.resize(sizeof(active) * _disc.nComp);
+	_discParFlux.resize(sizeof(active) * numFluxCoefficients());
+	_fluxCoeffCache.resize(numFluxCoefficients());
 
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
@@ -692,6 +742,12 @@ bool GeneralRateModel::configure(IParameterProvider& paramProvider)
 	if (_disc.nParType != _parCoreRadius.size())
 		throw InvalidParameterException("Number of elements in field PAR_CORERADIUS does not match number of particle types");
 
+	for (unsigned int i = 0; i < _disc.nParType; ++i)
+	{
+		if ((_parDiscType[i] == ParticleDiscretizationMode::Collocation) && (_parCoreRadius[i] != 0.0))
+			throw InvalidParameterException("Particle type " + std::to_string(i) + " uses COLLOCATION_PAR, which requires PAR_CORERADIUS = 0");
+	}
+
 	// Check that particle volume fractions sum to 1.0
 	for (unsigned int i = 0; i < _disc.nCol; ++i)
 	{
@@ -857,6 +913,8 @@ bool GeneralRateModel::configure(IParameterProvider& paramProvider)
 		}
 	}
 
+	_fluxCoeffCache.invalidate();
+
 	return transportSuccess && parSurfDiffDepConfSuccess && bindingConfSuccess && dynReactionConfSuccess;
 }
 
@@ -934,8 +992,118 @@ void GeneralRateModel::useAnalyticJacobian(const bool analyticJac)
 #endif
 }
 
+/**
+ * @brief Computes the coefficients of the flux equations
+ * @details The coefficients only depend on parameters and on the section. They are stored in
+ *          a flat array with the following layout:
+ *            - @f$ J_{0,f} @f$ factor for each particle type and column cell (including volume fraction),
+ *            - @f$ J_{p,f} @f$ factor for each particle type and component (including pore accessibility),
+ *            - discretized film diffusion coefficient @f$ k_f @f$ for each particle type and component,
+ *            - surface diffusion flux factor for each particle type and component.
+ *          The surface diffusion factors are only set for particle types with surface diffusion and
+ *          quasi-stationary binding.
+ * @param [in] secIdx Index of the current section
+ * @param [out] coeff Array with numFluxCoefficients() elements
+ */
+template <typename ParamType>
+void GeneralRateModel::computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const
+{
+	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
+
+	ParamType* const jacCF = coeff;
+	ParamType* const jacPF = jacCF + _disc.nParType * _disc.nCol;
+	ParamType* const kf = jacPF + _disc.nParType * _disc.nComp;
+	ParamType* const kfSurf = kf + _disc.nParType * _disc.nComp;
+
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
+
+		// Ordering of diffusion:
+		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
+		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
+		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
+		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
+		active const* const poreAccFactor = _poreAccessFactor.data() + type * _disc.nComp;
+
+		const ParamType surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<ParamType>(_parRadius[type]);
+		const ParamType outerAreaPerVolume = static_cast<ParamType>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
+		const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
+
+		const ParamType jacCF_val = invBetaC * surfaceToVolumeRatio;
+		const ParamType jacPF_val = -outerAreaPerVolume / epsP;
+
+		for (unsigned int colCell = 0; colCell < _disc.nCol; ++colCell)
+			jacCF[type * _disc.nCol + colCell] = jacCF_val * static_cast<ParamType>(_parTypeVolFrac[type + colCell * _disc.nParType]);
+
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			jacPF[type * _disc.nComp + comp] = jacPF_val / static_cast<ParamType>(poreAccFactor[comp]);
+
+		// Discretized film diffusion kf for finite volumes
+		ParamType* const kfType = kf + type * _disc.nComp;
+		if (cadet_likely((_colParBoundaryOrder == 2) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation)))
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfType[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<ParamType>(poreAccFactor[comp]) / static_cast<ParamType>(parDiff[comp]) + 1.0 / static_cast<ParamType>(filmDiff[comp]));
+		}
+		else
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfType[comp] = static_cast<ParamType>(filmDiff[comp]);
+		}
+
+		ParamType* const kfSurfType = kfSurf + type * _disc.nComp;
+		if (cadet_unlikely(_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation)))
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfSurfType[comp] = (1.0 - epsP) / (1.0 + epsP * static_cast<ParamType>(poreAccFactor[comp]) * static_cast<ParamType>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<ParamType>(filmDiff[comp])));
+		}
+		else
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfSurfType[comp] = 0.0;
+		}
+	}
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section
+ * @details Values are taken from the cache, which is refreshed if necessary.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+double const* GeneralRateModel::fluxCoefficients<double>(unsigned int secIdx)
+{
+	if (!_fluxCoeffCache.isValid(secIdx))
+	{
+		computeFluxCoefficients(secIdx, _fluxCoeffCache.data());
+		_fluxCoeffCache.validate(secIdx);
+	}
+	return _fluxCoeffCache.data();
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section including parameter sensitivities
+ * @details The coefficients are evaluated with AD into a buffer of _discParFlux, which has to be
+ *          released by the caller.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+active const* GeneralRateModel::fluxCoefficients<active>(unsigned int secIdx)
+{
+	active* const coeff = _discParFlux.create<active>(numFluxCoefficients());
+	computeFluxCoefficients(secIdx, coeff);
+	return coeff;
+}
+
 void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// Recompute cached flux coefficients since parameters may have been changed via parameter handles
+	_fluxCoeffCache.invalidate();
+	fluxCoefficients<double>(secIdx);
+
 	// Setup flux Jacobian blocks at the beginning of the simulation or in case of
 	// section dependent film or particle diffusion coefficients
 	if ((secIdx == 0) || isSectionDependent(_filmDiffusionMode) || isSectionDependent(_parDiffusionMode) || isSectionDependent(_parSurfDiffusionMode))
@@ -949,7 +1117,7 @@ void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned i
 
 	// Setup the matrix connecting inlet DOFs to first column cells
 	_jacInlet.clear();
-	const double h = static_cast<double>(_convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+	const double jacInlet = _convDispOp.inletJacobian();
 	const double u = static_cast<double>(_convDispOp.currentVelocity());
 
 	if (u >= 0.0)
@@ -958,7 +1126,7 @@ void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned i
 
 		// Place entries for inlet DOF to first column cell conversion
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(comp * idxr.strideColComp(), comp, -u / h);
+			_jacInlet.addElement(comp * idxr.strideColComp(), comp, jacInlet);
 	}
 	else
 	{
@@ -967,10 +1135,33 @@ void GeneralRateModel::notifyDiscontinuousSectionTransition(double t, unsigned i
 		// Place entries for inlet DOF to last column cell conversion
 		const unsigned int offset = (_disc.nCol - 1) * idxr.strideColCell();
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, u / h);
+			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, jacInlet);
 	}
 }
 
+bool GeneralRateModel::adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState)
+{
+	if (!_convDispOp.adaptAxialGrid(simState.vecStateY))
+		return false;
+
+	// Remap all axially distributed quantities to the new grid
+	Indexer idxr(_disc);
+	for (double* const vec : {simState.vecStateY, simState.vecStateYdot})
+	{
+		if (!vec)
+			continue;
+
+		_convDispOp.remapAxialField(vec + idxr.offsetC(), _disc.nComp, idxr.strideColCell());
+		for (unsigned int type = 0; type < _disc.nParType; ++type)
+		{
+			_convDispOp.remapAxialField(vec + idxr.offsetCp(ParticleTypeIndex{type}), idxr.strideParBlock(type), idxr.strideParBlock(type));
+			_convDispOp.remapAxialField(vec + idxr.offsetJf(ParticleTypeIndex{type}), _disc.nComp, idxr.strideFluxCell());
+		}
+	}
+
+	return true;
+}
+
 void GeneralRateModel::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
 	_convDispOp.setFlowRates(in[0], out[0], _colPorosity);
@@ -1251,7 +1442,7 @@ int GeneralRateModel::residualBulk(double t, unsigned int secIdx, StateType cons
 
 	for (unsigned int col = 0; col < _disc.nCol; ++col, y += idxr.strideColCell(), res += idxr.strideColCell())
 	{
-		const ColumnPosition colPos{(0.5 + static_cast<double>(col)) / static_cast<double>(_disc.nCol), 0.0, 0.0};
+		const ColumnPosition colPos{_convDispOp.relativeCoordinate(col), 0.0, 0.0};
 		_dynReactionBulk->residualLiquidAdd(t, secIdx, colPos, y, res, -1.0, tlmAlloc);
 
 		if (wantJac)
@@ -1285,7 +1476,7 @@ int GeneralRateModel::residualParticle(double t, unsigned int parType, unsigned
 	active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[parType];
 
 	// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-	const double z = (0.5 + static_cast<double>(colCell)) / static_cast<double>(_disc.nCol);
+	const double z = _convDispOp.relativeCoordinate(colCell);
 
 	// Reset Jacobian
 	if (wantJac)
@@ -1317,6 +1508,17 @@ int GeneralRateModel::residualParticle(double t, unsigned int parType, unsigned
 
 		// We still need to handle transport and quasi-stationary reactions
 
+		if (_parDiscType[parType] == ParticleDiscretizationMode::Collocation)
+		{
+			residualParticleCollocation<StateType, ResidualType, ParamType, wantJac>(parType, par, parDiff, parSurfDiff, qsReaction, y, res, jac);
+
+			res += idxr.strideParShell(parType);
+			y += idxr.strideParShell(parType);
+			jac += idxr.strideParShell(parType);
+			yDot += idxr.strideParShell(parType);
+			continue;
+		}
+
 		// Geometry
 		const ParamType outerAreaPerVolume = static_cast<ParamType>(outerSurfPerVol[par]);
 		const ParamType innerAreaPerVolume = static_cast<ParamType>(innerSurfPerVol[par]);
@@ -1828,13 +2030,101 @@ int GeneralRateModel::residualParticle(double t, unsigned int parType, unsigned
 	return 0;
 }
 
+/**
+ * @brief Adds the radial transport terms of a collocation node to the particle residual
+ * @details Molecular diffusion and surface diffusion of all bound states enter the mobile phase equations,
+ *          surface diffusion of dynamic bound states also enters the solid phase equations. The particle
+ *          surface boundary condition is handled in residualFlux().
+ * @param [in] parType Particle type
+ * @param [in] node Index of the collocation node (0 is the particle surface)
+ * @param [in] parDiff Particle diffusion coefficients of the current section and particle type
+ * @param [in] parSurfDiff Particle surface diffusion coefficients of the current section and particle type
+ * @param [in] qsReaction Quasi-stationarity flags of the bound states
+ * @param [in] y Pointer to the first mobile phase state of the node
+ * @param [out] res Pointer to the first mobile phase residual of the node
+ * @param [in,out] jac Row iterator of the first mobile phase equation of the node
+ */
+template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+void GeneralRateModel::residualParticleCollocation(unsigned int parType, unsigned int node, active const* parDiff, active const* parSurfDiff, int const* qsReaction,
+	StateType const* y, ResidualType* res, linalg::BandMatrix::RowIterator jac)
+{
+	Indexer idxr(_disc);
+
+	const unsigned int nNodes = _disc.nParCell[parType];
+	const int strideShell = idxr.strideParShell(parType);
+	double const* const opRow = _parCollocOp.data() + _parCollocOpOffset[parType] + node * nNodes;
+
+	// Operator is assembled on the unit particle
+	const ParamType invRadiusSq = 1.0 / (static_cast<ParamType>(_parRadius[parType]) * static_cast<ParamType>(_parRadius[parType]));
+
+	// Mobile phase
+	for (unsigned int comp = 0; comp < _disc.nComp; ++comp, ++res, ++y, ++jac)
+	{
+		const unsigned int nBound = _disc.nBound[_disc.nComp * parType + comp];
+		const ParamType invBetaP = (1.0 - static_cast<ParamType>(_parPorosity[parType])) / (static_cast<ParamType>(_poreAccessFactor[_disc.nComp * parType + comp]) * static_cast<ParamType>(_parPorosity[parType]));
+		const ParamType dp = static_cast<ParamType>(parDiff[comp]) * invRadiusSq;
+
+		for (unsigned int j = 0; j < nNodes; ++j)
+		{
+			const int offset = (static_cast<int>(j) - static_cast<int>(node)) * strideShell;
+			*res += dp * opRow[j] * y[offset];
+
+			if (wantJac)
+				jac[offset] += static_cast<double>(dp) * opRow[j];
+		}
+
+		if (cadet_unlikely(_hasSurfaceDiffusion[parType]))
+		{
+			for (unsigned int i = 0; i < nBound; ++i)
+			{
+				// Index explanation:
+				//   - comp go back to beginning of liquid phase
+				//   + strideParLiquid skip over liquid phase to solid phase
+				//   + offsetBoundComp jump to component comp (skips all bound states of previous components)
+				//   + i go to current bound state
+				const int bndIdx = idxr.offsetBoundComp(ParticleTypeIndex{parType}, ComponentIndex{comp}) + i;
+				const int curIdx = idxr.strideParLiquid() - comp + bndIdx;
+				const ParamType ds = invBetaP * static_cast<ParamType>(parSurfDiff[bndIdx]) * invRadiusSq;
+
+				for (unsigned int j = 0; j < nNodes; ++j)
+				{
+					const int offset = (static_cast<int>(j) - static_cast<int>(node)) * strideShell + curIdx;
+					*res += ds * opRow[j] * y[offset];
+
+					if (wantJac)
+						jac[offset] += static_cast<double>(ds) * opRow[j];
+				}
+			}
+		}
+	}
+
+	// Solid phase
+	if (cadet_unlikely(_hasSurfaceDiffusion[parType] && _binding[parType]->hasDynamicReactions()))
+	{
+		for (unsigned int bnd = 0; bnd < _disc.strideBound[parType]; ++bnd, ++res, ++y, ++jac)
+		{
+			// Skip quasi-stationary bound states
+			if (qsReaction[bnd])
+				continue;
+
+			const ParamType ds = static_cast<ParamType>(parSurfDiff[bnd]) * invRadiusSq;
+			for (unsigned int j = 0; j < nNodes; ++j)
+			{
+				const int offset = (static_cast<int>(j) - static_cast<int>(node)) * strideShell;
+				*res += ds * opRow[j] * y[offset];
+
+				if (wantJac)
+					jac[offset] += static_cast<double>(ds) * opRow[j];
+			}
+		}
+	}
+}
+
 template <typename StateType, typename ResidualType, typename ParamType>
 int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType const* yBase, double const* yDotBase, ResidualType* resBase)
 {
 	Indexer idxr(_disc);
 
-	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
-
 	// Get offsets
 	ResidualType* const resCol = resBase + idxr.offsetC();
 	ResidualType* const resFlux = resBase + idxr.offsetJf();
@@ -1846,8 +2136,10 @@ int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType cons
 	for (unsigned int i = 0; i < _disc.nComp * _disc.nCol * _disc.nParType; ++i)
 		resFlux[i] = yFlux[i];
 
-	// Discretized film diffusion kf for finite volumes
-	ParamType* const kf_FV = _discParFlux.create<ParamType>(_disc.nComp);
+	ParamType const* const jacCF = fluxCoefficients<ParamType>(secIdx);
+	ParamType const* const jacPF = jacCF + _disc.nParType * _disc.nCol;
+	ParamType const* const kf = jacPF + _disc.nParType * _disc.nComp;
+	ParamType const* const kfSurf = kf + _disc.nParType * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
@@ -1857,39 +2149,13 @@ int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType cons
 		StateType const* const yParType = yBase + idxr.offsetCp(ParticleTypeIndex{type});
 		StateType const* const yFluxType = yBase + idxr.offsetJf(ParticleTypeIndex{type});
 
-		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
-
-		// Ordering of diffusion:
-		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
-		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-
-		const ParamType surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<ParamType>(_parRadius[type]);
-		const ParamType outerAreaPerVolume = static_cast<ParamType>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
-
-		const ParamType jacCF_val = invBetaC * surfaceToVolumeRatio;
-		const ParamType jacPF_val = -outerAreaPerVolume / epsP;
-
-		// Discretized film diffusion kf for finite volumes
-		if (cadet_likely(_colParBoundaryOrder == 2))
-		{
-			const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) / static_cast<ParamType>(parDiff[comp]) + 1.0 / static_cast<ParamType>(filmDiff[comp]));
-		}
-		else
-		{
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = static_cast<ParamType>(filmDiff[comp]);
-		}
+		ParamType const* const jacCFtype = jacCF + type * _disc.nCol;
+		ParamType const* const jacPFtype = jacPF + type * _disc.nComp;
+		ParamType const* const kf_FV = kf + type * _disc.nComp;
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
 		for (unsigned int i = 0; i < _disc.nCol * _disc.nComp; ++i)
-		{
-			const unsigned int colCell = i / _disc.nComp;
-			resCol[i] += jacCF_val * static_cast<ParamType>(_parTypeVolFrac[type + colCell * _disc.nParType]) * yFluxType[i];
-		}
+			resCol[i] += jacCFtype[i / _disc.nComp] * yFluxType[i];
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
 		for (unsigned int bnd = 0; bnd < _disc.nCol; ++bnd)
@@ -1907,7 +2173,7 @@ int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType cons
 			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 			{
 				const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPF_val / static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) * yFluxType[eq];
+				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPFtype[comp] * yFluxType[eq];
 			}
 		}
 
@@ -1921,22 +2187,19 @@ int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType cons
 			}
 		}
 
-		if (cadet_unlikely(_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1)))
+		if (cadet_unlikely(_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation)))
 		{
 			int const* const qsReaction = _binding[type]->reactionQuasiStationarity();
+			ParamType const* const kfSurfType = kfSurf + type * _disc.nComp;
 
 			// Ordering of particle surface diffusion:
 			// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 			active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[type];
 			active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
-			const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = (1.0 - static_cast<ParamType>(_parPorosity[type])) / (1.0 + epsP * static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) * static_cast<ParamType>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<ParamType>(filmDiff[comp])));
 
 			for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 			{
-				const ColumnPosition colPos{(0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
+				const ColumnPosition colPos{_convDispOp.relativeCoordinate(pblk), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
 				const ParamType dr = static_cast<ParamType>(parCenterRadius[0]) - static_cast<ParamType>(parCenterRadius[1]);
 
 				for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
@@ -1963,13 +2226,14 @@ int GeneralRateModel::residualFlux(double t, unsigned int secIdx, StateType cons
 						) : static_cast<ParamType>(parSurfDiff[idxBnd]);
 
 						const ResidualType gradQ = (yParType[curIdx] - yParType[curIdx + idxr.strideParShell(type)]) / dr;
-						resFluxType[eq] -= kf_FV[comp] * localSurfDiff * gradQ;
+						resFluxType[eq] -= kfSurfType[comp] * localSurfDiff * gradQ;
 					}
 				}
 			}
 		}
 	}
 
+	// Releases the AD buffer of fluxCoefficients(), does nothing for cached coefficients
 	_discParFlux.destroy<ParamType>();
 	return 0;
 }
@@ -2013,48 +2277,21 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 
 	Indexer idxr(_disc);
 
-	const double invBetaC = 1.0 / static_cast<double>(_colPorosity) - 1.0;
-
-	// Discretized film diffusion kf for finite volumes
-	double* const kf_FV = _discParFlux.create<double>(_disc.nComp);
+	double const* const jacCF = fluxCoefficients<double>(secIdx);
+	double const* const jacPF = jacCF + _disc.nParType * _disc.nCol;
+	double const* const kf = jacPF + _disc.nParType * _disc.nComp;
+	double const* const kfSurf = kf + _disc.nParType * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
 		const unsigned int typeOffset = type * _disc.nCol * _disc.nComp;
-		const double epsP = static_cast<double>(_parPorosity[type]);
-
-		// Ordering of diffusion:
-		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
-		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-
-		const double surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<double>(_parRadius[type]);
-		const double outerAreaPerVolume = static_cast<double>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
-
-		const double jacCF_val = invBetaC * surfaceToVolumeRatio;
-		const double jacPF_val = -outerAreaPerVolume / epsP;
-
-		// Discretized film diffusion kf for finite volumes
-		if (cadet_likely(_colParBoundaryOrder == 2))
-		{
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) / static_cast<double>(parDiff[comp]) + 1.0 / static_cast<double>(filmDiff[comp]));
-		}
-		else
-		{
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = static_cast<double>(filmDiff[comp]);
-		}
+		double const* const kf_FV = kf + type * _disc.nComp;
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
 		for (unsigned int eq = 0; eq < _disc.nCol * _disc.nComp; ++eq)
 		{
-			const unsigned int colCell = eq / _disc.nComp;
-
 			// Main diagonal corresponds to j_{f,i} (flux) state variable
-			_jacCF.addElement(eq, eq + typeOffset, jacCF_val * static_cast<double>(_parTypeVolFrac[type + colCell * _disc.nParType]));
+			_jacCF.addElement(eq, eq + typeOffset, jacCF[type * _disc.nCol + eq / _disc.nComp]);
 		}
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
@@ -2075,7 +2312,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 			{
 				const unsigned int eq = typeOffset + pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-				jacPFtype[pblk].addElement(comp, eq, jacPF_val / static_cast<double>(_poreAccessFactor[comp]));
+				jacPFtype[pblk].addElement(comp, eq, jacPF[type * _disc.nComp + comp]);
 			}
 		}
 
@@ -2090,7 +2327,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 			}
 		}
 
-		if (cadet_unlikely(_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1)))
+		if (cadet_unlikely(_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation)))
 		{
 			int const* const qsReaction = _binding[type]->reactionQuasiStationarity();
 
@@ -2098,14 +2335,11 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 			// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 			active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[type];
 			active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = (1.0 - static_cast<double>(_parPorosity[type])) / (1.0 + epsP * static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) * static_cast<double>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<double>(filmDiff[comp])));
+			double const* const kfSurfType = kfSurf + type * _disc.nComp;
 
 			for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 			{
-				const ColumnPosition colPos{(0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
+				const ColumnPosition colPos{_convDispOp.relativeCoordinate(pblk), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
 				const double dr = static_cast<double>(parCenterRadius[0]) - static_cast<double>(parCenterRadius[1]);
 
 				double const* const yCell = vecStateY + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{pblk});
@@ -2133,7 +2367,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 								idxBnd
 							);
 
-							const double v = kf_FV[comp] * localSurfDiff / dr;
+							const double v = kfSurfType[comp] * localSurfDiff / dr;
 							const int curIdx = idxr.strideParLiquid() + idxBnd;
 
 							jacFPtype[pblk].addElement(eq, curIdx, -v);
@@ -2146,7 +2380,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 								yCell,
 								yCell + idxr.strideParLiquid(),
 								idxBnd,
-								-kf_FV[comp] * gradQ,
+								-kfSurfType[comp] * gradQ,
 								0,
 								eq,
 								jacFPtype[pblk]
@@ -2154,7 +2388,7 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 						}
 						else
 						{
-							const double v = kf_FV[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
+							const double v = kfSurfType[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
 							const int curIdx = idxr.strideParLiquid() + idxBnd;
 
 							jacFPtype[pblk].addElement(eq, curIdx, -v);
@@ -2165,8 +2399,6 @@ void GeneralRateModel::assembleOffdiagJac(double t, unsigned int secIdx, double
 			}
 		}
 	}
-
-	_discParFlux.destroy<double>();
 }
 
 /**
@@ -2184,34 +2416,13 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 
 	Indexer idxr(_disc);
 
-//	const double invBetaC = 1.0 / static_cast<double>(_colPorosity) - 1.0;
-
-	// Discretized film diffusion kf for finite volumes
-	double* const kf_FV = _discParFlux.create<double>(_disc.nComp);
+	double const* const kf = fluxCoefficients<double>(secIdx) + _disc.nParType * (_disc.nCol + _disc.nComp);
+	double const* const kfSurf = kf + _disc.nParType * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
 		const unsigned int typeOffset = type * _disc.nCol * _disc.nComp;
-		const double epsP = static_cast<double>(_parPorosity[type]);
-
-		// Ordering of diffusion:
-		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
-		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-
-		// Discretized film diffusion kf for finite volumes
-		if (cadet_likely(_colParBoundaryOrder == 2))
-		{
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) / static_cast<double>(parDiff[comp]) + 1.0 / static_cast<double>(filmDiff[comp]));
-		}
-		else
-		{
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = static_cast<double>(filmDiff[comp]);
-		}
+		double const* const kf_FV = kf + type * _disc.nComp;
 
 		// J_{f,p} block, adds outer bead shell state c_{p,i} to flux equation
 		linalg::DoubleSparseMatrix* const jacFPtype = _jacFP + type * _disc.nCol;
@@ -2224,7 +2435,7 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 			}
 		}
 
-		if (_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1))
+		if (_hasSurfaceDiffusion[type] && _binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1) && (_parDiscType[type] != ParticleDiscretizationMode::Collocation))
 		{
 			int const* const qsReaction = _binding[type]->reactionQuasiStationarity();
 
@@ -2232,14 +2443,11 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 			// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 			active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[type];
 			active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = (1.0 - static_cast<double>(_parPorosity[type])) / (1.0 + epsP * static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) * static_cast<double>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<double>(filmDiff[comp])));
+			double const* const kfSurfType = kfSurf + type * _disc.nComp;
 
 			for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 			{
-				const ColumnPosition colPos{(0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
+				const ColumnPosition colPos{_convDispOp.relativeCoordinate(pblk), 0.0, static_cast<double>(parCenterRadius[0]) / static_cast<double>(_parRadius[type])};
 				const double dr = static_cast<double>(parCenterRadius[0]) - static_cast<double>(parCenterRadius[1]);
 
 				double const* const yCell = vecStateY + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{pblk});
@@ -2267,7 +2475,7 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 								idxBnd
 							);
 
-							const double v = kf_FV[comp] * localSurfDiff / dr;
+							const double v = kfSurfType[comp] * localSurfDiff / dr;
 							const int curIdx = idxr.strideParLiquid() + idxBnd;
 
 							jacFPtype[pblk].addElement(eq, curIdx, -v);
@@ -2280,7 +2488,7 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 								yCell,
 								yCell + idxr.strideParLiquid(),
 								idxBnd,
-								-kf_FV[comp] * gradQ,
+								-kfSurfType[comp] * gradQ,
 								0,
 								eq,
 								jacFPtype[pblk]
@@ -2288,7 +2496,7 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 						}
 						else
 						{
-							const double v = kf_FV[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
+							const double v = kfSurfType[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
 							const int curIdx = idxr.strideParLiquid() + idxBnd;
 
 							jacFPtype[pblk].addElement(eq, curIdx, -v);
@@ -2300,7 +2508,6 @@ void GeneralRateModel::assembleOffdiagJacFluxParticle(double t, unsigned int sec
 		}
 	}
 
-	_discParFlux.destroy<double>();
 }
 
 int GeneralRateModel::residualSensFwdWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem)
@@ -2736,6 +2943,77 @@ void GeneralRateModel::setUserdefinedRadialDisc(unsigned int parType)
 	}
 }
 
+/**
+ * @brief Assembles the collocation diffusion operator of a particle type on the unit particle
+ * @details The radial diffusion operator @f$ r^{1-a} \partial_r \left( r^{a-1} \partial_r c \right) @f$ is
+ *          symmetric in @f$ r @f$, where @f$ a @f$ denotes the surface to volume ratio factor of the
+ *          particle geometry. Its polynomial solutions are expanded in @f$ u = (r / r_p)^2 @f$ and
+ *          collocated on the Gauss-Radau nodes of the weight @f$ u^{(a-2)/2} @f$, which include
+ *          the particle surface @f$ u = 1 @f$. The weak form with Radau quadrature yields a diagonal
+ *          (lumped) mass matrix @f$ m_i @f$ and the symmetric stiffness matrix
+ *          @f$ K_{ij} = 2 \sum_k w_k u_k \ell_i'(u_k) \ell_j'(u_k) @f$. The operator
+ *          @f$ K_{ij} / m_i @f$ is stored such that node 0 is the particle surface.
+ */
+void GeneralRateModel::assembleCollocationOperator(unsigned int parType)
+{
+	const unsigned int n = _disc.nParCell[parType];
+	const double beta = 0.5 * (_parGeomSurfToVol[parType] - 2.0);
+
+	std::vector<double> ascNodes;
+	std::vector<double> ascWeights;
+	spectral::radauNodesAndWeights(n, beta, ascNodes, ascWeights);
+
+	// Reverse order such that the surface node comes first
+	std::vector<double> nodes(ascNodes.rbegin(), ascNodes.rend());
+	std::vector<double> weights(ascWeights.rbegin(), ascWeights.rend());
+
+	std::vector<double> D;
+	spectral::derivativeMatrix(nodes, D);
+
+	double* const nodesType = _parCollocNodes.data() + _disc.nParCellsBeforeType[parType];
+	double* const massType = _parCollocMass.data() + _disc.nParCellsBeforeType[parType];
+	double* const op = _parCollocOp.data() + _parCollocOpOffset[parType];
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		nodesType[i] = nodes[i];
+		massType[i] = 0.5 * weights[i];
+	}
+
+	for (unsigned int i = 0; i < n; ++i)
+	{
+		for (unsigned int j = 0; j < n; ++j)
+		{
+			double k = 0.0;
+			for (unsigned int q = 0; q < n; ++q)
+				k += weights[q] * nodes[q] * D[q * n + i] * D[q * n + j];
+
+			op[i * n + j] = 2.0 * k / massType[i];
+		}
+	}
+}
+
+/**
+ * @brief Computes radial positions and the surface coupling of collocation nodes in the beads
+ * @details The outer surface area per volume of the surface node stems from the boundary term of the
+ *          weak form, @f$ 1 / (m_0 r_p) @f$, such that the film flux enters the surface node like
+ *          it enters the outer shell of finite volume discretizations.
+ */
+void GeneralRateModel::setCollocationRadialDisc(unsigned int parType)
+{
+	const unsigned int offset = _disc.nParCellsBeforeType[parType];
+	const active radius = _parRadius[parType];
+
+	for (unsigned int node = 0; node < _disc.nParCell[parType]; ++node)
+	{
+		_parCenterRadius[offset + node] = radius * std::sqrt(_parCollocNodes[offset + node]);
+		_parCellSize[offset + node] = radius * _parGeomSurfToVol[parType] * _parCollocMass[offset + node];
+		_parOuterSurfAreaPerVolume[offset + node] = 0.0;
+		_parInnerSurfAreaPerVolume[offset + node] = 0.0;
+	}
+
+	_parOuterSurfAreaPerVolume[offset] = 1.0 / (_parCollocMass[offset] * radius);
+}
+
 void GeneralRateModel::updateRadialDisc()
 {
 	for (unsigned int i = 0; i < _disc.nParType; ++i)
@@ -2746,11 +3024,15 @@ void GeneralRateModel::updateRadialDisc()
 			setEquivolumeRadialDisc(i);
 		else if (_parDiscType[i] == ParticleDiscretizationMode::UserDefined)
 			setUserdefinedRadialDisc(i);
+		else if (_parDiscType[i] == ParticleDiscretizationMode::Collocation)
+			setCollocationRadialDisc(i);
 	}
 }
 
 bool GeneralRateModel::setParameter(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		if (multiplexCompTypeSecParameterValue(pId, hashString("PORE_ACCESSIBILITY"), _poreAccessFactorMode, _poreAccessFactor, _disc.nParType, _disc.nComp, value, nullptr))
@@ -2826,8 +3108,56 @@ bool GeneralRateModel::setParameter(const ParameterId& pId, bool value)
 	return UnitOperationBase::setParameter(pId, value);
 }
 
+bool GeneralRateModel::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	// Changes to the particle radii require an update of the radial discretization and
+	// multiplexed initial conditions are not stored in a single place, so use setParameter()
+	if ((pId.name == hashString("PAR_RADIUS")) || (pId.name == hashString("PAR_CORERADIUS"))
+		|| (pId.name == hashString("INIT_CP")) || (pId.name == hashString("INIT_Q")))
+		return false;
+
+	if (pId.unitOperation == _unitOpIdx)
+	{
+		if (multiplexCompTypeSecParameterPointers(pId, hashString("PORE_ACCESSIBILITY"), _poreAccessFactorMode, _poreAccessFactor, _disc.nParType, _disc.nComp, ptrs))
+			return true;
+		if (multiplexCompTypeSecParameterPointers(pId, hashString("FILM_DIFFUSION"), _filmDiffusionMode, _filmDiffusion, _disc.nParType, _disc.nComp, ptrs))
+			return true;
+		if (multiplexCompTypeSecParameterPointers(pId, hashString("PAR_DIFFUSION"), _parDiffusionMode, _parDiffusion, _disc.nParType, _disc.nComp, ptrs))
+			return true;
+		if (multiplexBndCompTypeSecParameterPointers(pId, hashString("PAR_SURFDIFFUSION"), _parSurfDiffusionMode, _parSurfDiffusion, _disc.nParType, _disc.nComp, _disc.strideBound, _disc.nBound, _disc.boundOffset, ptrs))
+			return true;
+
+		// Intercept changes to PAR_TYPE_VOLFRAC when not specified per axial cell (but once globally)
+		if (_axiallyConstantParTypeVolFrac && (pId.name == hashString("PAR_TYPE_VOLFRAC")))
+		{
+			if ((pId.section != SectionIndep) || (pId.component != CompIndep) || (pId.boundState != BoundStateIndep) || (pId.reaction != ReactionIndep))
+				return false;
+			if (pId.particleType >= _disc.nParType)
+				return false;
+
+			for (unsigned int i = 0; i < _disc.nCol; ++i)
+				ptrs.push_back(&_parTypeVolFrac[i * _disc.nParType + pId.particleType]);
+
+			return true;
+		}
+
+		if (multiplexTypeParameterPointers(pId, hashString("PAR_POROSITY"), _singleParPorosity, _parPorosity, ptrs))
+			return true;
+
+		if (model::getParameterPointers(pId, _parDepSurfDiffusion, _singleParDepSurfDiffusion, ptrs))
+			return true;
+
+		if (_convDispOp.getParameterPointers(pId, ptrs))
+			return true;
+	}
+
+	return UnitOperationBase::getParameterPointers(pId, ptrs);
+}
+
 void GeneralRateModel::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		if (multiplexCompTypeSecParameterValue(pId, hashString("PORE_ACCESSIBILITY"), _poreAccessFactorMode, _poreAccessFactor, _disc.nParType, _disc.nComp, value, &_sensParams))
@@ -22,9 +22,11 @@
 #include "cadet/StrongTypes.hpp"
 #include "cadet/SolutionExporter.hpp"
 #include "model/parts/ConvectionDispersionOperator.hpp"
+#include "model/parts/SectionConstantCache.hpp"
 #include "AutoDiff.hpp"
 #include "linalg/SparseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
+#include "linalg/BatchedBandMatrix.hpp"
 #include "linalg/Gmres.hpp"
 #include "Memory.hpp"
 #include "model/ModelUtils.hpp"
@@ -98,6 +100,7 @@ public:
 	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
 	virtual bool configure(IParameterProvider& paramProvider);
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState);
 
 	virtual void useAnalyticJacobian(const bool analyticJac);
 
@@ -160,6 +163,7 @@ public:
 	virtual bool setParameter(const ParameterId& pId, int value);
 	virtual bool setParameter(const ParameterId& pId, bool value);
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual std::unordered_map<ParameterId, double> getAllParameterValues() const;
@@ -226,19 +230,31 @@ protected:
 	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
 	int residualParticle(double t, unsigned int parType, unsigned int colCell, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, util::ThreadLocalStorage& threadLocalMem);
 
+	template <typename StateType, typename ResidualType, typename ParamType, bool wantJac>
+	void residualParticleCollocation(unsigned int parType, unsigned int node, active const* parDiff, active const* parSurfDiff, int const* qsReaction, StateType const* y, ResidualType* res, linalg::BandMatrix::RowIterator jac);
+
 	template <typename StateType, typename ResidualType, typename ParamType>
 	int residualFlux(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
 
+	template <typename ParamType>
+	void computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const;
+	template <typename ParamType>
+	ParamType const* fluxCoefficients(unsigned int secIdx);
+	inline unsigned int numFluxCoefficients() const CADET_NOEXCEPT { return _disc.nParType * (_disc.nCol + 3 * _disc.nComp); }
+
 	void assembleOffdiagJac(double t, unsigned int secIdx, double const* vecStateY);
 	void assembleOffdiagJacFluxParticle(double t, unsigned int secIdx, double const* vecStateY);
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
 	int schurComplementMatrixVector(double const* x, double* z) const;
 	void assembleDiscretizedJacobianParticleBlock(unsigned int parType, unsigned int pblk, double alpha, const Indexer& idxr);
+	void solveParticleBlocksBatched(double* const vec, const Indexer& idxr) const;
 	
 	void setEquidistantRadialDisc(unsigned int parType);
 	void setEquivolumeRadialDisc(unsigned int parType);
 	void setUserdefinedRadialDisc(unsigned int parType);
+	void setCollocationRadialDisc(unsigned int parType);
+	void assembleCollocationOperator(unsigned int parType);
 	void updateRadialDisc();
 
 	void addTimeDerivativeToJacobianParticleShell(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, unsigned int parType);
@@ -286,7 +302,12 @@ protected:
 		/**
 		 * Shell edges specified by user
 		 */
-		UserDefined
+		UserDefined,
+
+		/**
+		 * Orthogonal collocation on Gauss-Radau nodes in @f$ (r / r_p)^2 @f$
+		 */
+		Collocation
 	};
 
 	Discretization _disc; //!< Discretization info
@@ -298,6 +319,8 @@ protected:
 
 	linalg::BandMatrix* _jacP; //!< Particle jacobian diagonal blocks (all of them)
 	linalg::FactorizableBandMatrix* _jacPdisc; //!< Particle jacobian diagonal blocks (all of them) with time derivatives from BDF method
+	linalg::BatchedBandMatrix* _jacPdiscBatched; //!< Factorized particle jacobian diagonal blocks of each particle type stored interleaved (only used if _batchedParticleSolver is set)
+	bool _batchedParticleSolver; //!< Determines whether the particle blocks of a type are factorized and solved together in a BatchedBandMatrix
 
 	linalg::DoubleSparseMatrix _jacCF; //!< Jacobian block connecting interstitial states and fluxes (interstitial transport equation)
 	linalg::DoubleSparseMatrix _jacFC; //!< Jacobian block connecting fluxes and interstitial states (flux equation)
@@ -339,8 +362,13 @@ protected:
 	std::vector<active> _parCenterRadius; //!< Particle cell-centered position for each particle cell
 	std::vector<active> _parOuterSurfAreaPerVolume; //!< Particle shell outer sphere surface to volume ratio
 	std::vector<active> _parInnerSurfAreaPerVolume; //!< Particle shell inner sphere surface to volume ratio
+	std::vector<double> _parCollocNodes; //!< Collocation nodes in @f$ (r / r_p)^2 @f$ (outermost first), indexed like _parCenterRadius
+	std::vector<double> _parCollocMass; //!< Lumped mass (quadrature weight) of each collocation node
+	std::vector<double> _parCollocOp; //!< Row-major collocation diffusion operators on the unit particle, consecutive for each particle type
+	std::vector<unsigned int> _parCollocOpOffset; //!< Offset of each particle type in _parCollocOp
 
-	ArrayPool _discParFlux; //!< Storage for discretized @f$ k_f @f$ value
+	ArrayPool _discParFlux; //!< Storage for flux coefficients evaluated with AD
+	parts::SectionConstantCache _fluxCoeffCache; //!< Flux coefficients of the current section, see computeFluxCoefficients()
 
 	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
 	double* _tempState; //!< Temporary storage with the size of the state vector or larger if binding models require it
@@ -476,9 +504,9 @@ protected:
 
 		virtual int writePrimaryCoordinates(double* coords) const
 		{
-			const double h = static_cast<double>(_model._convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+			const double L = static_cast<double>(_model._convDispOp.columnLength());
 			for (unsigned int i = 0; i < _disc.nCol; ++i)
-				coords[i] = (i + 0.5) * h;
+				coords[i] = _model._convDispOp.relativeCoordinate(i) * L;
 			return _disc.nCol;
 		}
 		virtual int writeSecondaryCoordinates(double* coords) const { return 0; }
@@ -619,7 +619,8 @@ bool GeneralRateModel2D::configureModelDiscretization(IParameterProvider& paramP
 	_jacCF.resize(_disc.nComp * _disc.nCol * _disc.nRad * _disc.nParType);
 	_jacFC.resize(_disc.nComp * _disc.nCol * _disc.nRad * _disc.nParType);
 
-	_discParFlux.resize(sizeof(active) * _disc.nComp);
+	_discParFlux.resize(sizeof(active) * numFluxCoefficients());
+	_fluxCoeffCache.resize(numFluxCoefficients());
 
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
@@ -964,6 +965,8 @@ bool GeneralRateModel2D::configure(IParameterProvider& paramProvider)
 		}
 	}
 
+	_fluxCoeffCache.invalidate();
+
 	return transportSuccess && bindingConfSuccess && dynReactionConfSuccess;
 }
 
@@ -1042,8 +1045,123 @@ void GeneralRateModel2D::useAnalyticJacobian(const bool analyticJac)
 #endif
 }
 
+/**
+ * @brief Computes the coefficients of the flux equations
+ * @details The coefficients only depend on parameters and on the section. They are stored in
+ *          a flat array with the following layout:
+ *            - @f$ J_{0,f} @f$ factor for each particle type and column cell (axial cell, radial cell)
+ *              including column porosity and volume fraction,
+ *            - @f$ J_{p,f} @f$ factor for each particle type and component (including pore accessibility),
+ *            - discretized film diffusion coefficient @f$ k_f @f$ for each particle type and component,
+ *            - surface diffusion flux factor for each particle type and component.
+ *          The surface diffusion factors are only set for particle types with quasi-stationary binding.
+ * @param [in] secIdx Index of the current section
+ * @param [out] coeff Array with numFluxCoefficients() elements
+ */
+template <typename ParamType>
+void GeneralRateModel2D::computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const
+{
+	const unsigned int nCells = _disc.nCol * _disc.nRad;
+	ParamType* const jacCF = coeff;
+	ParamType* const jacPF = jacCF + _disc.nParType * nCells;
+	ParamType* const kf = jacPF + _disc.nParType * _disc.nComp;
+	ParamType* const kfSurf = kf + _disc.nParType * _disc.nComp;
+
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
+
+		// Ordering of diffusion:
+		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
+		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
+		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
+		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
+		active const* const poreAccFactor = _poreAccessFactor.data() + type * _disc.nComp;
+
+		const ParamType surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<ParamType>(_parRadius[type]);
+		const ParamType outerAreaPerVolume = static_cast<ParamType>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
+		const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
+
+		const ParamType jacPF_val = -outerAreaPerVolume / epsP;
+
+		ParamType* const jacCFtype = jacCF + type * nCells;
+		for (unsigned int col = 0; col < _disc.nCol; ++col)
+		{
+			for (unsigned int rad = 0; rad < _disc.nRad; ++rad)
+			{
+				const ParamType invBetaC = 1.0 / static_cast<ParamType>(_convDispOp.columnPorosity(rad)) - 1.0;
+				jacCFtype[col * _disc.nRad + rad] = invBetaC * surfaceToVolumeRatio * static_cast<ParamType>(_parTypeVolFrac[type + col * _disc.nParType * _disc.nRad + rad * _disc.nParType]);
+			}
+		}
+
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			jacPF[type * _disc.nComp + comp] = jacPF_val / static_cast<ParamType>(poreAccFactor[comp]);
+
+		// Discretized film diffusion kf for finite volumes
+		ParamType* const kfType = kf + type * _disc.nComp;
+		if (cadet_likely(_colParBoundaryOrder == 2))
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfType[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<ParamType>(poreAccFactor[comp]) / static_cast<ParamType>(parDiff[comp]) + 1.0 / static_cast<ParamType>(filmDiff[comp]));
+		}
+		else
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfType[comp] = static_cast<ParamType>(filmDiff[comp]);
+		}
+
+		ParamType* const kfSurfType = kfSurf + type * _disc.nComp;
+		if (cadet_unlikely(_binding[type]->hasQuasiStationaryReactions() && (_disc.nParCell[type] > 1)))
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfSurfType[comp] = (1.0 - epsP) / (1.0 + epsP * static_cast<ParamType>(poreAccFactor[comp]) * static_cast<ParamType>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<ParamType>(filmDiff[comp])));
+		}
+		else
+		{
+			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+				kfSurfType[comp] = 0.0;
+		}
+	}
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section
+ * @details Values are taken from the cache, which is refreshed if necessary.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+double const* GeneralRateModel2D::fluxCoefficients<double>(unsigned int secIdx)
+{
+	if (!_fluxCoeffCache.isValid(secIdx))
+	{
+		computeFluxCoefficients(secIdx, _fluxCoeffCache.data());
+		_fluxCoeffCache.validate(secIdx);
+	}
+	return _fluxCoeffCache.data();
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section including parameter sensitivities
+ * @details The coefficients are evaluated with AD into a buffer of _discParFlux, which has to be
+ *          released by the caller.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+active const* GeneralRateModel2D::fluxCoefficients<active>(unsigned int secIdx)
+{
+	active* const coeff = _discParFlux.create<active>(numFluxCoefficients());
+	computeFluxCoefficients(secIdx, coeff);
+	return coeff;
+}
+
 void GeneralRateModel2D::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// Recompute cached flux coefficients since parameters may have been changed via parameter handles
+	_fluxCoeffCache.invalidate();
+	fluxCoefficients<double>(secIdx);
+
 	// Setup flux Jacobian blocks at the beginning of the simulation or in case of
 	// section dependent film or particle diffusion coefficients
 	if ((secIdx == 0) || isSectionDependent(_filmDiffusionMode) || isSectionDependent(_parDiffusionMode))
@@ -1597,8 +1715,10 @@ int GeneralRateModel2D::residualFlux(double t, unsigned int secIdx, StateType co
 	for (unsigned int i = 0; i < _disc.nComp * _disc.nCol * _disc.nRad * _disc.nParType; ++i)
 		resFlux[i] = yFlux[i];
 
-	// Discretized film diffusion kf for finite volumes
-	ParamType* const kf_FV = _discParFlux.create<ParamType>(_disc.nComp);
+	ParamType const* const jacCF = fluxCoefficients<ParamType>(secIdx);
+	ParamType const* const jacPF = jacCF + _disc.nParType * _disc.nCol * _disc.nRad;
+	ParamType const* const kf = jacPF + _disc.nParType * _disc.nComp;
+	ParamType const* const kfSurf = kf + _disc.nParType * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
@@ -1608,46 +1728,13 @@ int GeneralRateModel2D::residualFlux(double t, unsigned int secIdx, StateType co
 		StateType const* const yParType = yBase + idxr.offsetCp(ParticleTypeIndex{type});
 		StateType const* const yFluxType = yBase + idxr.offsetJf(ParticleTypeIndex{type});
 
-		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
-
-		// Ordering of diffusion:
-		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
-		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-
-		const ParamType surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<ParamType>(_parRadius[type]);
-		const ParamType outerAreaPerVolume = static_cast<ParamType>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
-
-		const ParamType jacPF_val = -outerAreaPerVolume / epsP;
-
-		// Discretized film diffusion kf for finite volumes
-		if (cadet_likely(_colParBoundaryOrder == 2))
-		{
-			const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) / static_cast<ParamType>(parDiff[comp]) + 1.0 / static_cast<ParamType>(filmDiff[comp]));
-		}
-		else
-		{
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = static_cast<ParamType>(filmDiff[comp]);
-		}
+		ParamType const* const jacCFtype = jacCF + type * _disc.nCol * _disc.nRad;
+		ParamType const* const jacPFtype = jacPF + type * _disc.nComp;
+		ParamType const* const kf_FV = kf + type * _disc.nComp;
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
-		unsigned int idx = 0;
-		for (unsigned int i = 0; i < _disc.nCol; ++i)
-		{
-			for (unsigned int j = 0; j < _disc.nRad; ++j)
-			{
-				const ParamType invBetaC = 1.0 / static_cast<ParamType>(_convDispOp.columnPorosity(j)) - 1.0;
-				const ParamType jacCF_val = invBetaC * surfaceToVolumeRatio;
-				for (unsigned int k = 0; k < _disc.nComp; ++k, ++idx)
-				{
-					resCol[idx] += jacCF_val * static_cast<ParamType>(_parTypeVolFrac[type + i * _disc.nParType * _disc.nRad + j * _disc.nParType]) * yFluxType[idx];
-				}
-			}
-		}
+		for (unsigned int i = 0; i < _disc.nCol * _disc.nRad * _disc.nComp; ++i)
+			resCol[i] += jacCFtype[i / _disc.nComp] * yFluxType[i];
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
 		for (unsigned int bnd = 0; bnd < _disc.nCol * _disc.nRad; ++bnd)
@@ -1665,7 +1752,7 @@ int GeneralRateModel2D::residualFlux(double t, unsigned int secIdx, StateType co
 			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 			{
 				const unsigned int eq = pblk * idxr.strideColRadialCell() + comp * idxr.strideColComp();
-				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPF_val / static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) * yFluxType[eq];
+				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPFtype[comp] * yFluxType[eq];
 			}
 		}
 
@@ -1687,10 +1774,7 @@ int GeneralRateModel2D::residualFlux(double t, unsigned int secIdx, StateType co
 			// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 			active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[type];
 			active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
-			const ParamType absOuterShellHalfRadius = 0.5 * static_cast<ParamType>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = (1.0 - static_cast<ParamType>(_parPorosity[type])) / (1.0 + epsP * static_cast<ParamType>(_poreAccessFactor[type * _disc.nComp + comp]) * static_cast<ParamType>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<ParamType>(filmDiff[comp])));
+			ParamType const* const kfSurfType = kfSurf + type * _disc.nComp;
 
 			for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nRad; ++pblk)
 			{
@@ -1711,13 +1795,14 @@ int GeneralRateModel2D::residualFlux(double t, unsigned int secIdx, StateType co
 
 						const int curIdx = pblk * idxr.strideParBlock(type) + idxr.strideParLiquid() + idxBnd;
 						const ResidualType gradQ = (yParType[curIdx] - yParType[curIdx + idxr.strideParShell(type)]) / dr;
-						resFluxType[eq] -= kf_FV[comp] * static_cast<ParamType>(parSurfDiff[idxBnd]) * gradQ;
+						resFluxType[eq] -= kfSurfType[comp] * static_cast<ParamType>(parSurfDiff[idxBnd]) * gradQ;
 					}
 				}
 			}
 		}
 	}
 
+	// Releases the AD buffer of fluxCoefficients(), does nothing for cached coefficients
 	_discParFlux.destroy<ParamType>();
 	return 0;
 }
@@ -1744,53 +1829,22 @@ void GeneralRateModel2D::assembleOffdiagJac(double t, unsigned int secIdx)
 
 	Indexer idxr(_disc);
 
-	// Discretized film diffusion kf for finite volumes
-	double* const kf_FV = _discParFlux.create<double>(_disc.nComp);
+	const unsigned int nCells = _disc.nCol * _disc.nRad;
+	double const* const jacCF = fluxCoefficients<double>(secIdx);
+	double const* const jacPF = jacCF + _disc.nParType * nCells;
+	double const* const kf = jacPF + _disc.nParType * _disc.nComp;
+	double const* const kfSurf = kf + _disc.nParType * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
 		const unsigned int typeOffset = type * _disc.nCol * _disc.nComp * _disc.nRad;
-		const double epsP = static_cast<double>(_parPorosity[type]);
-
-		// Ordering of diffusion:
-		// sec0type0comp0, sec0type0comp1, sec0type0comp2, sec0type1comp0, sec0type1comp1, sec0type1comp2,
-		// sec1type0comp0, sec1type0comp1, sec1type0comp2, sec1type1comp0, sec1type1comp1, sec1type1comp2, ...
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const parDiff = getSectionDependentSlice(_parDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-
-		const double surfaceToVolumeRatio = _parGeomSurfToVol[type] / static_cast<double>(_parRadius[type]);
-		const double outerAreaPerVolume = static_cast<double>(_parOuterSurfAreaPerVolume[_disc.nParCellsBeforeType[type]]);
-
-		const double jacPF_val = -outerAreaPerVolume / epsP;
-
-		// Discretized film diffusion kf for finite volumes
-		if (cadet_likely(_colParBoundaryOrder == 2))
-		{
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = 1.0 / (absOuterShellHalfRadius / epsP / static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) / static_cast<double>(parDiff[comp]) + 1.0 / static_cast<double>(filmDiff[comp]));
-		}
-		else
-		{
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = static_cast<double>(filmDiff[comp]);
-		}
+		double const* const kf_FV = kf + type * _disc.nComp;
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
-		unsigned int idx = 0;
-		for (unsigned int col = 0; col < _disc.nCol; ++col)
+		for (unsigned int idx = 0; idx < nCells * _disc.nComp; ++idx)
 		{
-			for (unsigned int rad = 0; rad < _disc.nRad; ++rad)
-			{
-				const double invBetaC = 1.0 / static_cast<double>(_convDispOp.columnPorosity(rad)) - 1.0;
-				const double jacCF_val = invBetaC * surfaceToVolumeRatio;
-
-				for (unsigned int comp = 0; comp < _disc.nComp; ++comp, ++idx)
-				{
-					// Main diagonal corresponds to j_{f,i} (flux) state variable
-					_jacCF.addElement(idx, idx + typeOffset, jacCF_val * static_cast<double>(_parTypeVolFrac[type + col * _disc.nRad * _disc.nParType + rad * _disc.nParType]));
-				}
-			}
+			// Main diagonal corresponds to j_{f,i} (flux) state variable
+			_jacCF.addElement(idx, idx + typeOffset, jacCF[type * nCells + idx / _disc.nComp]);
 		}
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
@@ -1811,7 +1865,7 @@ void GeneralRateModel2D::assembleOffdiagJac(double t, unsigned int secIdx)
 			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 			{
 				const unsigned int eq = typeOffset + pblk * idxr.strideColRadialCell() + comp * idxr.strideColComp();
-				jacPFtype[pblk].addElement(comp, eq, jacPF_val / static_cast<double>(_poreAccessFactor[comp]));
+				jacPFtype[pblk].addElement(comp, eq, jacPF[type * _disc.nComp + comp]);
 			}
 		}
 
@@ -1834,10 +1888,7 @@ void GeneralRateModel2D::assembleOffdiagJac(double t, unsigned int secIdx)
 			// bnd0comp0, bnd0comp1, bnd0comp2, bnd1comp0, bnd1comp1, bnd1comp2
 			active const* const parSurfDiff = getSectionDependentSlice(_parSurfDiffusion, _disc.strideBound[_disc.nParType], secIdx) + _disc.nBoundBeforeType[type];
 			active const* const parCenterRadius = _parCenterRadius.data() + _disc.nParCellsBeforeType[type];
-			const double absOuterShellHalfRadius = 0.5 * static_cast<double>(_parCellSize[_disc.nParCellsBeforeType[type]]);
-
-			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-				kf_FV[comp] = (1.0 - static_cast<double>(_parPorosity[type])) / (1.0 + epsP * static_cast<double>(_poreAccessFactor[type * _disc.nComp + comp]) * static_cast<double>(parDiff[comp]) / (absOuterShellHalfRadius * static_cast<double>(filmDiff[comp])));
+			double const* const kfSurfType = kfSurf + type * _disc.nComp;
 
 			for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nRad; ++pblk)
 			{
@@ -1856,7 +1907,7 @@ void GeneralRateModel2D::assembleOffdiagJac(double t, unsigned int secIdx)
 						if (!qsReaction[idxBnd])
 							continue;
 
-						const double v = kf_FV[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
+						const double v = kfSurfType[comp] * static_cast<double>(parSurfDiff[idxBnd]) / dr;
 						const int curIdx = idxr.strideParLiquid() + idxBnd;
 
 						jacFPtype[pblk].addElement(eq, curIdx, -v);
@@ -1866,8 +1917,6 @@ void GeneralRateModel2D::assembleOffdiagJac(double t, unsigned int secIdx)
 			}
 		}
 	}
-
-	_discParFlux.destroy<double>();
 }
 
 int GeneralRateModel2D::residualSensFwdWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem)
@@ -2318,6 +2367,8 @@ void GeneralRateModel2D::updateRadialDisc()
 
 bool GeneralRateModel2D::setParameter(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		if (multiplexParameterValue(pId, hashString("PAR_TYPE_VOLFRAC"), _parTypeVolFracMode, _parTypeVolFrac, _disc.nCol, _disc.nRad, _disc.nParType, value, nullptr))
@@ -2356,8 +2407,28 @@ bool GeneralRateModel2D::setParameter(const ParameterId& pId, double value)
 	return result;
 }
 
+bool GeneralRateModel2D::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	if ((pId.unitOperation != _unitOpIdx) && (pId.unitOperation != UnitOpIndep))
+		return false;
+
+	// Unit operation parameters are multiplexed over radial zones or affect the radial
+	// discretization and velocity field, so only binding and reaction parameters are exposed
+	if (_parameters.find(pId) != _parameters.end())
+		return false;
+
+	if (model::getParameterPointers(pId, _binding, _singleBinding, ptrs))
+		return true;
+	if (model::getParameterPointers(pId, _dynReaction, _singleDynReaction, ptrs))
+		return true;
+
+	return false;
+}
+
 void GeneralRateModel2D::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		if (multiplexParameterValue(pId, hashString("PAR_TYPE_VOLFRAC"), _parTypeVolFracMode, _parTypeVolFrac, _disc.nCol, _disc.nRad, _disc.nParType, value, &_sensParams))
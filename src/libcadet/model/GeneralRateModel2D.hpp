@@ -22,6 +22,7 @@
 #include "cadet/StrongTypes.hpp"
 #include "cadet/SolutionExporter.hpp"
 #include "model/parts/TwoDimensionalConvectionDispersionOperator.hpp"
+#include "model/parts/SectionConstantCache.hpp"
 #include "AutoDiff.hpp"
 #include "linalg/SparseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
@@ -149,6 +150,7 @@ public:
 
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
@@ -214,6 +216,12 @@ protected:
 	template <typename StateType, typename ResidualType, typename ParamType>
 	int residualFlux(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
 
+	template <typename ParamType>
+	void computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const;
+	template <typename ParamType>
+	ParamType const* fluxCoefficients(unsigned int secIdx);
+	inline unsigned int numFluxCoefficients() const CADET_NOEXCEPT { return _disc.nParType * (_disc.nCol * _disc.nRad + 3 * _disc.nComp); }
+
 	void assembleOffdiagJac(double t, unsigned int secIdx);
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
@@ -316,7 +324,8 @@ protected:
 	std::vector<active> _parOuterSurfAreaPerVolume; //!< Particle shell outer sphere surface to volume ratio
 	std::vector<active> _parInnerSurfAreaPerVolume; //!< Particle shell inner sphere surface to volume ratio
 
-	ArrayPool _discParFlux; //!< Storage for discretized @f$ k_f @f$ value
+	ArrayPool _discParFlux; //!< Storage for flux coefficients evaluated with AD
+	parts::SectionConstantCache _fluxCoeffCache; //!< Flux coefficients of the current section, see computeFluxCoefficients()
 
 	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
 	double* _tempState; //!< Temporary storage with the size of the state vector or larger if binding models require it
@@ -158,6 +158,12 @@ bool InletModel::setParameter(const ParameterId& pId, double value)
 	return false;
 }
 
+bool InletModel::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	// Inlet profile parameters are owned by the inlet profile and have to be set via setParameter()
+	return false;
+}
+
 bool InletModel::setParameter(const ParameterId& pId, bool value)
 {
 	return false;
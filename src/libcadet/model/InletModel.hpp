@@ -69,6 +69,7 @@ public:
 	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
 	virtual bool configure(IParameterProvider& paramProvider);
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState) { return false; }
 	
 	virtual std::unordered_map<ParameterId, double> getAllParameterValues() const;
 	virtual bool hasParameter(const ParameterId& pId) const;
@@ -78,6 +79,8 @@ public:
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setParameter(const ParameterId& pId, bool value);
 
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
+
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
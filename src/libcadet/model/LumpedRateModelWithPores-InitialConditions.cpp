@@ -350,7 +350,7 @@ void LumpedRateModelWithPores::consistentInitialState(const SimulationTime& simT
 			linalg::DenseMatrixView fullJacobianMatrix(_jacPdisc[type].data() + pblk * mask.len * mask.len, nullptr, mask.len, mask.len);
 
 			// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-			const double z = (0.5 + static_cast<double>(pblk)) / static_cast<double>(_disc.nCol);
+			const double z = _convDispOp.relativeCoordinate(pblk);
 
 			// Get workspace memory
 			BufferedArray<double> nonlinMemBuffer = tlmAlloc.array<double>(_nonlinearSolver->workspaceSize(probSize));
@@ -675,7 +675,7 @@ void LumpedRateModelWithPores::consistentInitialTimeDerivative(const SimulationT
 		for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 		{
 			// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-			const double z = 1.0 / static_cast<double>(_disc.nCol) * (0.5 + pblk);
+			const double z = _convDispOp.relativeCoordinate(pblk);
 
 			// Assemble
 			linalg::FactorizableBandMatrix::RowIterator jac = _jacPdisc[type].row(idxr.strideParBlock(type) * pblk);
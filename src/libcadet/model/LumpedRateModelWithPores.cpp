@@ -119,7 +119,7 @@ bool LumpedRateModelWithPores::configureModelDiscretization(IParameterProvider&
 
 	paramProvider.pushScope("discretization");
 
-	_disc.nCol = paramProvider.getInt("NCOL");
+	_disc.nCol = parts::ConvectionDispersionOperatorBase::readNumAxialPoints(paramProvider);
 
 	if (!newNBoundInterface && paramProvider.exists("NBOUND")) // done here and in this order for backwards compatibility
 		nBound = paramProvider.getIntArray("NBOUND");
@@ -212,6 +212,12 @@ bool LumpedRateModelWithPores::configureModelDiscretization(IParameterProvider&
 	const bool analyticJac = false;
 #endif
 
+	// Determine whether diagonal blocks are factorized in single precision with iterative refinement
+	const bool mixedPrecision = paramProvider.exists("MIXED_PRECISION") && paramProvider.getBool("MIXED_PRECISION");
+	const int refinementSteps = paramProvider.exists("MIXED_PRECISION_REFINEMENT_STEPS") ? paramProvider.getInt("MIXED_PRECISION_REFINEMENT_STEPS") : 2;
+	if (refinementSteps < 0)
+		throw InvalidParameterException("Field MIXED_PRECISION_REFINEMENT_STEPS has to be non-negative");
+
 	// Initialize and configure GMRES for solving the Schur-complement
 	_gmres.initialize(_disc.nCol * _disc.nComp * _disc.nParType, paramProvider.getInt("MAX_KRYLOV"), linalg::toOrthogonalization(paramProvider.getInt("GS_TYPE")), paramProvider.getInt("MAX_RESTARTS"));
 	_gmres.matrixVectorMultiplier(&schurComplementMultiplierLRMPores, this);
@@ -265,6 +271,7 @@ bool LumpedRateModelWithPores::configureModelDiscretization(IParameterProvider&
 	for (unsigned int i = 0; i < _disc.nParType; ++i)
 	{
 		_jacPdisc[i].resize(_disc.nCol * (_disc.nComp + _disc.strideBound[i]), _disc.nComp + _disc.strideBound[i] - 1, _disc.nComp + _disc.strideBound[i] - 1);
+		_jacPdisc[i].setMixedPrecision(mixedPrecision, refinementSteps);
 		_jacP[i].resize(_disc.nCol * (_disc.nComp + _disc.strideBound[i]), _disc.nComp + _disc.strideBound[i] - 1, _disc.nComp + _disc.strideBound[i] - 1);
 	}
 
@@ -279,6 +286,9 @@ bool LumpedRateModelWithPores::configureModelDiscretization(IParameterProvider&
 	_jacCF.resize(_disc.nComp * _disc.nCol * _disc.nParType);
 	_jacFC.resize(_disc.nComp * _disc.nCol * _disc.nParType);
 
+	_discParFlux.resize(sizeof(active) * numFluxCoefficients());
+	_fluxCoeffCache.resize(numFluxCoefficients());
+
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
 
@@ -564,6 +574,8 @@ bool LumpedRateModelWithPores::configure(IParameterProvider& paramProvider)
 		}
 	}
 
+	_fluxCoeffCache.invalidate();
+
 	return transportSuccess && bindingConfSuccess && dynReactionConfSuccess;
 }
 
@@ -641,8 +653,86 @@ void LumpedRateModelWithPores::useAnalyticJacobian(const bool analyticJac)
 #endif
 }
 
+/**
+ * @brief Computes the coefficients of the flux equations
+ * @details The coefficients only depend on parameters and on the section. They are stored in
+ *          a flat array with the following layout:
+ *            - @f$ J_{0,f} @f$ factor for each particle type, column cell, and component (including
+ *              film diffusion and volume fraction),
+ *            - @f$ J_{p,f} @f$ factor for each particle type and component (including film diffusion
+ *              and pore accessibility).
+ * @param [in] secIdx Index of the current section
+ * @param [out] coeff Array with numFluxCoefficients() elements
+ */
+template <typename ParamType>
+void LumpedRateModelWithPores::computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const
+{
+	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
+
+	ParamType* const jacCF = coeff;
+	ParamType* const jacPF = jacCF + _disc.nParType * _disc.nCol * _disc.nComp;
+
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
+	{
+		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
+		const ParamType radius = static_cast<ParamType>(_parRadius[type]);
+		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
+		active const* const poreAccFactor = _poreAccessFactor.data() + type * _disc.nComp;
+
+		const ParamType jacCF_val = invBetaC * _parGeomSurfToVol[type] / radius;
+		const ParamType jacPF_val = -_parGeomSurfToVol[type] / (epsP * radius);
+
+		ParamType* const jacCFtype = jacCF + type * _disc.nCol * _disc.nComp;
+		for (unsigned int i = 0; i < _disc.nCol * _disc.nComp; ++i)
+		{
+			const unsigned int colCell = i / _disc.nComp;
+			const unsigned int comp = i % _disc.nComp;
+			jacCFtype[i] = jacCF_val * static_cast<ParamType>(filmDiff[comp]) * static_cast<ParamType>(_parTypeVolFrac[type + _disc.nParType * colCell]);
+		}
+
+		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
+			jacPF[type * _disc.nComp + comp] = jacPF_val / static_cast<ParamType>(poreAccFactor[comp]) * static_cast<ParamType>(filmDiff[comp]);
+	}
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section
+ * @details Values are taken from the cache, which is refreshed if necessary.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+double const* LumpedRateModelWithPores::fluxCoefficients<double>(unsigned int secIdx)
+{
+	if (!_fluxCoeffCache.isValid(secIdx))
+	{
+		computeFluxCoefficients(secIdx, _fluxCoeffCache.data());
+		_fluxCoeffCache.validate(secIdx);
+	}
+	return _fluxCoeffCache.data();
+}
+
+/**
+ * @brief Returns the coefficients of the flux equations in the given section including parameter sensitivities
+ * @details The coefficients are evaluated with AD into a buffer of _discParFlux, which has to be
+ *          released by the caller.
+ * @param [in] secIdx Index of the current section
+ * @return Flux coefficients, see computeFluxCoefficients() for the layout
+ */
+template <>
+active const* LumpedRateModelWithPores::fluxCoefficients<active>(unsigned int secIdx)
+{
+	active* const coeff = _discParFlux.create<active>(numFluxCoefficients());
+	computeFluxCoefficients(secIdx, coeff);
+	return coeff;
+}
+
 void LumpedRateModelWithPores::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac)
 {
+	// Recompute cached flux coefficients since parameters may have been changed via parameter handles
+	_fluxCoeffCache.invalidate();
+	fluxCoefficients<double>(secIdx);
+
 	// Setup flux Jacobian blocks at the beginning of the simulation or in case of
 	// section dependent film or particle diffusion coefficients
 	if ((secIdx == 0) || isSectionDependent(_filmDiffusionMode))
@@ -656,7 +746,7 @@ void LumpedRateModelWithPores::notifyDiscontinuousSectionTransition(double t, un
 
 	// Setup the matrix connecting inlet DOFs to first column cells
 	_jacInlet.clear();
-	const double h = static_cast<double>(_convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+	const double jacInlet = _convDispOp.inletJacobian();
 	const double u = static_cast<double>(_convDispOp.currentVelocity());
 
 	if (u >= 0.0)
@@ -665,7 +755,7 @@ void LumpedRateModelWithPores::notifyDiscontinuousSectionTransition(double t, un
 
 		// Place entries for inlet DOF to first column cell conversion
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(comp * idxr.strideColComp(), comp, -u / h);
+			_jacInlet.addElement(comp * idxr.strideColComp(), comp, jacInlet);
 	}
 	else
 	{
@@ -674,10 +764,31 @@ void LumpedRateModelWithPores::notifyDiscontinuousSectionTransition(double t, un
 		// Place entries for inlet DOF to last column cell conversion
 		const unsigned int offset = (_disc.nCol - 1) * idxr.strideColCell();
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, u / h);
+			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, jacInlet);
 	}
 }
 
+bool LumpedRateModelWithPores::adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState)
+{
+	if (!_convDispOp.adaptAxialGrid(simState.vecStateY))
+		return false;
+
+	// Remap all axially distributed quantities to the new grid
+	Indexer idxr(_disc);
+	for (double* const vec : {simState.vecStateY, simState.vecStateYdot})
+	{
+		if (!vec)
+			continue;
+
+		_convDispOp.remapAxialField(vec + idxr.offsetC(), _disc.nComp, idxr.strideColCell());
+		_convDispOp.remapAxialField(vec + idxr.offsetJf(), idxr.strideFluxCell(), idxr.strideFluxCell());
+		for (unsigned int type = 0; type < _disc.nParType; ++type)
+			_convDispOp.remapAxialField(vec + idxr.offsetCp(ParticleTypeIndex{type}), idxr.strideParBlock(type), idxr.strideParBlock(type));
+	}
+
+	return true;
+}
+
 void LumpedRateModelWithPores::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
 	_convDispOp.setFlowRates(in[0], out[0], _colPorosity);
@@ -952,7 +1063,7 @@ int LumpedRateModelWithPores::residualBulk(double t, unsigned int secIdx, StateT
 
 	for (unsigned int col = 0; col < _disc.nCol; ++col, y += idxr.strideColCell(), res += idxr.strideColCell())
 	{
-		const ColumnPosition colPos{(0.5 + static_cast<double>(col)) / static_cast<double>(_disc.nCol), 0.0, 0.0};
+		const ColumnPosition colPos{_convDispOp.relativeCoordinate(col), 0.0, 0.0};
 		_dynReactionBulk->residualLiquidAdd(t, secIdx, colPos, y, res, -1.0, tlmAlloc);
 
 		if (wantJac)
@@ -979,7 +1090,7 @@ int LumpedRateModelWithPores::residualParticle(double t, unsigned int parType, u
 	const ParamType radius = static_cast<ParamType>(_parRadius[parType]);
 
 	// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-	const double z = (0.5 + colCell) / static_cast<double>(_disc.nCol);
+	const double z = _convDispOp.relativeCoordinate(colCell);
 
 	const parts::cell::CellParameters cellResParams
 		{
@@ -1008,8 +1119,6 @@ int LumpedRateModelWithPores::residualFlux(double t, unsigned int secIdx, StateT
 {
 	Indexer idxr(_disc);
 
-	const ParamType invBetaC = 1.0 / static_cast<ParamType>(_colPorosity) - 1.0;
-
 	// Get offsets
 	ResidualType* const resCol = resBase + idxr.offsetC();
 	ResidualType* const resFlux = resBase + idxr.offsetJf();
@@ -1021,6 +1130,9 @@ int LumpedRateModelWithPores::residualFlux(double t, unsigned int secIdx, StateT
 	for (unsigned int i = 0; i < _disc.nComp * _disc.nCol * _disc.nParType; ++i)
 		resFlux[i] = yFlux[i];
 
+	ParamType const* const jacCF = fluxCoefficients<ParamType>(secIdx);
+	ParamType const* const jacPF = jacCF + _disc.nParType * _disc.nCol * _disc.nComp;
+
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
 		ResidualType* const resParType = resBase + idxr.offsetCp(ParticleTypeIndex{type});
@@ -1029,21 +1141,12 @@ int LumpedRateModelWithPores::residualFlux(double t, unsigned int secIdx, StateT
 		StateType const* const yParType = yBase + idxr.offsetCp(ParticleTypeIndex{type});
 		StateType const* const yFluxType = yBase + idxr.offsetJf(ParticleTypeIndex{type});
 
-		const ParamType epsP = static_cast<ParamType>(_parPorosity[type]);
-		const ParamType radius = static_cast<ParamType>(_parRadius[type]);
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const poreAccFactor = _poreAccessFactor.data() + type * _disc.nComp;
-
-		const ParamType jacCF_val = invBetaC * _parGeomSurfToVol[type] / radius;
-		const ParamType jacPF_val = -_parGeomSurfToVol[type] / (epsP * radius);
+		ParamType const* const jacCFtype = jacCF + type * _disc.nCol * _disc.nComp;
+		ParamType const* const jacPFtype = jacPF + type * _disc.nComp;
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
 		for (unsigned int i = 0; i < _disc.nCol * _disc.nComp; ++i)
-		{
-			const unsigned int colCell = i / _disc.nComp;
-			const unsigned int comp = i % _disc.nComp;
-			resCol[i] += jacCF_val * static_cast<ParamType>(filmDiff[comp]) * static_cast<ParamType>(_parTypeVolFrac[type + _disc.nParType * colCell]) * yFluxType[i];
-		}
+			resCol[i] += jacCFtype[i] * yFluxType[i];
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
 		for (unsigned int bnd = 0; bnd < _disc.nCol; ++bnd)
@@ -1061,7 +1164,7 @@ int LumpedRateModelWithPores::residualFlux(double t, unsigned int secIdx, StateT
 			for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
 			{
 				const unsigned int eq = pblk * idxr.strideColCell() + comp * idxr.strideColComp();
-				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPF_val / static_cast<ParamType>(poreAccFactor[comp]) * static_cast<ParamType>(filmDiff[comp]) * yFluxType[eq];
+				resParType[pblk * idxr.strideParBlock(type) + comp] += jacPFtype[comp] * yFluxType[eq];
 			}
 		}
 
@@ -1076,6 +1179,8 @@ int LumpedRateModelWithPores::residualFlux(double t, unsigned int secIdx, StateT
 		}
 	}
 
+	// Releases the AD buffer of fluxCoefficients(), does nothing for cached coefficients
+	_discParFlux.destroy<ParamType>();
 	return 0;
 }
 
@@ -1099,30 +1204,20 @@ void LumpedRateModelWithPores::assembleOffdiagJac(double t, unsigned int secIdx)
 
 	Indexer idxr(_disc);
 
-	const double invBetaC = 1.0 / static_cast<double>(_colPorosity) - 1.0;
+	double const* const jacCF = fluxCoefficients<double>(secIdx);
+	double const* const jacPF = jacCF + _disc.nParType * _disc.nCol * _disc.nComp;
 
 	for (unsigned int type = 0; type < _disc.nParType; ++type)
 	{
 		const unsigned int typeOffset = type * _disc.nCol * _disc.nComp;
 
-		const double epsP = static_cast<double>(_parPorosity[type]);
-		const double radius = static_cast<double>(_parRadius[type]);
-		const double jacCF_val = invBetaC * _parGeomSurfToVol[type] / radius;
-		const double jacPF_val = -_parGeomSurfToVol[type] / (radius * epsP);
-
-		active const* const filmDiff = getSectionDependentSlice(_filmDiffusion, _disc.nComp * _disc.nParType, secIdx) + type * _disc.nComp;
-		active const* const poreAccFactor = _poreAccessFactor.data() + type * _disc.nComp;
-
 		// Note that the J_f block, which is the identity matrix, is treated in the linear solver
 
 		// J_{0,f} block, adds flux to column void / bulk volume equations
 		for (unsigned int eq = 0; eq < _disc.nCol * _disc.nComp; ++eq)
 		{
-			const unsigned int colCell = eq / _disc.nComp;
-			const unsigned int comp = eq % _disc.nComp;
-
 			// Main diagonal corresponds to j_{f,i} (flux) state variable
-			_jacCF.addElement(eq, eq + typeOffset, jacCF_val * static_cast<double>(filmDiff[comp]) * static_cast<double>(_parTypeVolFrac[type + _disc.nParType * colCell]));
+			_jacCF.addElement(eq, eq + typeOffset, jacCF[eq + typeOffset]);
 		}
 
 		// J_{f,0} block, adds bulk volume state c_i to flux equation
@@ -1138,7 +1233,7 @@ void LumpedRateModelWithPores::assembleOffdiagJac(double t, unsigned int secIdx)
 			{
 				const unsigned int eq = typeOffset + pblk * idxr.strideColCell() + comp * idxr.strideColComp();
 				const unsigned int col = pblk * idxr.strideParBlock(type) + comp;
-				_jacPF[type].addElement(col, eq, jacPF_val / static_cast<double>(poreAccFactor[comp]) * static_cast<double>(filmDiff[comp]));
+				_jacPF[type].addElement(col, eq, jacPF[type * _disc.nComp + comp]);
 			}
 		}
 
@@ -1395,6 +1490,8 @@ void LumpedRateModelWithPores::expandErrorTol(double const* errorSpec, unsigned
 
 bool LumpedRateModelWithPores::setParameter(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		// Intercept changes to PAR_TYPE_VOLFRAC when not specified per axial cell (but once globally)
@@ -1434,8 +1531,49 @@ bool LumpedRateModelWithPores::setParameter(const ParameterId& pId, double value
 	return UnitOperationBase::setParameter(pId, value);
 }
 
+bool LumpedRateModelWithPores::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	// Multiplexed initial conditions are not stored in a single place, so use setParameter()
+	if ((pId.name == hashString("INIT_CP")) || (pId.name == hashString("INIT_Q")))
+		return false;
+
+	if (pId.unitOperation == _unitOpIdx)
+	{
+		// Intercept changes to PAR_TYPE_VOLFRAC when not specified per axial cell (but once globally)
+		if (_axiallyConstantParTypeVolFrac && (pId.name == hashString("PAR_TYPE_VOLFRAC")))
+		{
+			if ((pId.section != SectionIndep) || (pId.component != CompIndep) || (pId.boundState != BoundStateIndep) || (pId.reaction != ReactionIndep))
+				return false;
+			if (pId.particleType >= _disc.nParType)
+				return false;
+
+			for (unsigned int i = 0; i < _disc.nCol; ++i)
+				ptrs.push_back(&_parTypeVolFrac[i * _disc.nParType + pId.particleType]);
+
+			return true;
+		}
+
+		if (multiplexTypeParameterPointers(pId, hashString("PAR_RADIUS"), _singleParRadius, _parRadius, ptrs))
+			return true;
+		if (multiplexTypeParameterPointers(pId, hashString("PAR_POROSITY"), _singleParPorosity, _parPorosity, ptrs))
+			return true;
+
+		if (multiplexCompTypeSecParameterPointers(pId, hashString("FILM_DIFFUSION"), _filmDiffusionMode, _filmDiffusion, _disc.nParType, _disc.nComp, ptrs))
+			return true;
+		if (multiplexCompTypeSecParameterPointers(pId, hashString("PORE_ACCESSIBILITY"), _poreAccessFactorMode, _poreAccessFactor, _disc.nParType, _disc.nComp, ptrs))
+			return true;
+
+		if (_convDispOp.getParameterPointers(pId, ptrs))
+			return true;
+	}
+
+	return UnitOperationBase::getParameterPointers(pId, ptrs);
+}
+
 void LumpedRateModelWithPores::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
+	_fluxCoeffCache.invalidate();
+
 	if (pId.unitOperation == _unitOpIdx)
 	{
 		// Intercept changes to PAR_TYPE_VOLFRAC when not specified per axial cell (but once globally)
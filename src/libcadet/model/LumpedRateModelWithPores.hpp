@@ -22,6 +22,7 @@
 #include "cadet/StrongTypes.hpp"
 #include "cadet/SolutionExporter.hpp"
 #include "model/parts/ConvectionDispersionOperator.hpp"
+#include "model/parts/SectionConstantCache.hpp"
 #include "AutoDiff.hpp"
 #include "linalg/SparseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
@@ -87,6 +88,7 @@ public:
 	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
 	virtual bool configure(IParameterProvider& paramProvider);
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState);
 
 	virtual void useAnalyticJacobian(const bool analyticJac);
 
@@ -147,6 +149,7 @@ public:
 
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
@@ -210,6 +213,12 @@ protected:
 	template <typename StateType, typename ResidualType, typename ParamType>
 	int residualFlux(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res);
 
+	template <typename ParamType>
+	void computeFluxCoefficients(unsigned int secIdx, ParamType* coeff) const;
+	template <typename ParamType>
+	ParamType const* fluxCoefficients(unsigned int secIdx);
+	inline unsigned int numFluxCoefficients() const CADET_NOEXCEPT { return _disc.nParType * _disc.nComp * (_disc.nCol + 1); }
+
 	void assembleOffdiagJac(double t, unsigned int secIdx);
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
@@ -279,6 +288,9 @@ protected:
 	linalg::Gmres _gmres; //!< GMRES algorithm for the Schur-complement in linearSolve()
 	double _schurSafety; //!< Safety factor for Schur-complement solution
 
+	ArrayPool _discParFlux; //!< Storage for flux coefficients evaluated with AD
+	parts::SectionConstantCache _fluxCoeffCache; //!< Flux coefficients of the current section, see computeFluxCoefficients()
+
 	std::vector<active> _initC; //!< Liquid bulk phase initial conditions
 	std::vector<active> _initCp; //!< Liquid particle phase initial conditions
 	std::vector<active> _initQ; //!< Solid phase initial conditions
@@ -400,9 +412,9 @@ protected:
 
 		virtual int writePrimaryCoordinates(double* coords) const
 		{
-			const double h = static_cast<double>(_model._convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+			const double L = static_cast<double>(_model._convDispOp.columnLength());
 			for (unsigned int i = 0; i < _disc.nCol; ++i)
-				coords[i] = (i + 0.5) * h;
+				coords[i] = _model._convDispOp.relativeCoordinate(i) * L;
 			return _disc.nCol;
 		}
 		virtual int writeSecondaryCoordinates(double* coords) const { return 0; }
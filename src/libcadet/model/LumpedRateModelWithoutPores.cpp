@@ -91,6 +91,7 @@ namespace model
 {
 
 LumpedRateModelWithoutPores::LumpedRateModelWithoutPores(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
+	_jacDiscFactorized(&_jacDisc), _constJacobian(false), _jacobianCurrent(false), _checkJacobianCache(false), _jacVelocity(0.0),
 	_jacInlet(), _analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr), _initC(0),
 	_initQ(0), _initState(0), _initStateDot(0)
 {
@@ -156,7 +157,7 @@ bool LumpedRateModelWithoutPores::configureModelDiscretization(IParameterProvide
 	_disc.nBound = new unsigned int[_disc.nComp];
 	std::copy_n(nBound.begin(), _disc.nComp, _disc.nBound);
 
-	_disc.nCol = paramProvider.getInt("NCOL");
+	_disc.nCol = parts::ConvectionDispersionOperatorBase::readNumAxialPoints(paramProvider);
 
 	// Precompute offsets and total number of bound states (DOFs in solid phase)
 	_disc.boundOffset = new unsigned int[_disc.nComp];
@@ -175,6 +176,20 @@ bool LumpedRateModelWithoutPores::configureModelDiscretization(IParameterProvide
 	const bool analyticJac = false;
 #endif
 
+	// Determine whether diagonal blocks are factorized in single precision with iterative refinement
+	const bool mixedPrecision = paramProvider.exists("MIXED_PRECISION") && paramProvider.getBool("MIXED_PRECISION");
+	const int refinementSteps = paramProvider.exists("MIXED_PRECISION_REFINEMENT_STEPS") ? paramProvider.getInt("MIXED_PRECISION_REFINEMENT_STEPS") : 2;
+	if (refinementSteps < 0)
+		throw InvalidParameterException("Field MIXED_PRECISION_REFINEMENT_STEPS has to be non-negative");
+
+	// Number of factorizations that are kept if the Jacobian is constant within a section
+	const int cacheSize = paramProvider.exists("FACTORIZATION_CACHE_SIZE") ? paramProvider.getInt("FACTORIZATION_CACHE_SIZE") : 4;
+	if (cacheSize < 0)
+		throw InvalidParameterException("Field FACTORIZATION_CACHE_SIZE has to be non-negative");
+
+	_jacDiscCache.clear();
+	_jacDiscCache.setCapacity(cacheSize);
+
 	// Allocate space for initial conditions
 	_initC.resize(_disc.nComp);
 	_initQ.resize(_disc.strideBound);
@@ -201,6 +216,7 @@ bool LumpedRateModelWithoutPores::configureModelDiscretization(IParameterProvide
 
 	_jacDisc.resize(_disc.nCol * strideCell, mb, mb);
 	_jacDisc.repartition(lb, ub);
+	_jacDisc.setMixedPrecision(mixedPrecision, refinementSteps);
 
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
@@ -355,13 +371,26 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 {
 	Indexer idxr(_disc);
 
+	// Section dependent parameters may have changed, so the Jacobian has to be reevaluated.
+	// The cached factorizations are kept if the reevaluated Jacobian turns out to be the same
+	// (checked in linearSolve()), but parameters may have changed between simulations.
+	_jacobianCurrent = false;
+	_constJacobian = (_jacDiscCache.capacity() > 0) && _convDispOp.hasConstantJacobian() && _binding[0]->hasConstantJacobian()
+		&& (!_dynReaction[0] || _dynReaction[0]->hasConstantJacobian());
+
+	if (!_constJacobian || (secIdx == 0))
+	{
+		_jacDiscCache.clear();
+		_jacDiscFactorized = &_jacDisc;
+	}
+
 	// ConvectionDispersionOperator tells us whether flow direction has changed
 	if (!_convDispOp.notifyDiscontinuousSectionTransition(t, secIdx) && (secIdx != 0))
 		return;
 
 	// Setup the matrix connecting inlet DOFs to first column cells
 	_jacInlet.clear();
-	const double h = static_cast<double>(_convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+	const double jacInlet = _convDispOp.inletJacobian();
 	const double u = static_cast<double>(_convDispOp.currentVelocity());
 
 	const unsigned int lb = _convDispOp.jacobianLowerBandwidth();
@@ -372,7 +401,7 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 
 		// Place entries for inlet DOF to first column cell conversion
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(comp * idxr.strideColComp(), comp, -u / h);
+			_jacInlet.addElement(comp * idxr.strideColComp(), comp, jacInlet);
 
 		// Repartition Jacobians
 		_jac.repartition(lb, ub);
@@ -385,7 +414,7 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 		// Place entries for inlet DOF to last column cell conversion
 		const unsigned int offset = (_disc.nCol - 1) * idxr.strideColCell();
 		for (unsigned int comp = 0; comp < _disc.nComp; ++comp)
-			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, u / h);
+			_jacInlet.addElement(offset + comp * idxr.strideColComp(), comp, jacInlet);
 
 		// Repartition Jacobians
 		_jac.repartition(ub, lb);
@@ -395,6 +424,20 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 	prepareADvectors(adJac);
 }
 
+bool LumpedRateModelWithoutPores::adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState)
+{
+	if (!_convDispOp.adaptAxialGrid(simState.vecStateY))
+		return false;
+
+	// Remap bulk and bound phase of all cells to the new grid
+	Indexer idxr(_disc);
+	_convDispOp.remapAxialField(simState.vecStateY + idxr.offsetC(), idxr.strideColCell(), idxr.strideColCell());
+	if (simState.vecStateYdot)
+		_convDispOp.remapAxialField(simState.vecStateYdot + idxr.offsetC(), idxr.strideColCell(), idxr.strideColCell());
+
+	return true;
+}
+
 void LumpedRateModelWithoutPores::setFlowRates(active const* in, active const* out) CADET_NOEXCEPT
 {
 	_convDispOp.setFlowRates(in[0], out[0], _totalPorosity);
@@ -487,10 +530,23 @@ int LumpedRateModelWithoutPores::residualWithJacobian(const SimulationTime& simT
 int LumpedRateModelWithoutPores::residual(const SimulationTime& simTime, const ConstSimulationState& simState, double* const res,
 	const AdJacobianParams& adJac, util::ThreadLocalStorage& threadLocalMem, bool updateJacobian, bool paramSensitivity)
 {
+	if (updateJacobian && _jacobianCurrent && (static_cast<double>(_convDispOp.currentVelocity()) == _jacVelocity))
+	{
+		// Jacobian is constant within the section and has already been evaluated,
+		// only a factorization for the (possibly) new BDF factor is required
+		_factorizeJacobian = true;
+		updateJacobian = false;
+	}
+
 	if (updateJacobian)
 	{
 		_factorizeJacobian = true;
 
+		// Remember that the constant Jacobian of this section is evaluated now
+		_jacobianCurrent = _constJacobian;
+		_checkJacobianCache = _constJacobian;
+		_jacVelocity = static_cast<double>(_convDispOp.currentVelocity());
+
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
 		if (_analyticJac)
 		{
@@ -617,7 +673,7 @@ int LumpedRateModelWithoutPores::residualImpl(double t, unsigned int secIdx, Sta
 			};
 
 		// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-		const double z = 1.0 / static_cast<double>(_disc.nCol) * (0.5 + col);
+		const double z = _convDispOp.relativeCoordinate(col);
 
 		parts::cell::residualKernel<StateType, ResidualType, ParamType, parts::cell::CellParameters, linalg::BandMatrix::RowIterator, wantJac, false>(
 			t, secIdx, ColumnPosition{z, 0.0, 0.0}, localY, localYdot, localRes, _jac.row(col * idxr.strideColCell()), cellResParams, threadLocalMem.get()
@@ -813,14 +869,39 @@ int LumpedRateModelWithoutPores::linearSolve(double t, double alpha, double oute
 	// Factorize Jacobian only if required
 	if (_factorizeJacobian)
 	{
-		// Assemble
-		assembleDiscretizedJacobian(alpha, idxr);
+		_jacDiscFactorized = nullptr;
+		if (_constJacobian)
+		{
+			// Cached factorizations are only valid for the Jacobian they have been assembled from
+			if (_checkJacobianCache)
+			{
+				if ((_jacCacheRef.rows() != _jac.rows()) || (_jacCacheRef.lowerBandwidth() != _jac.lowerBandwidth())
+					|| !std::equal(_jac.data(), _jac.data() + _jac.rows() * _jac.stride(), _jacCacheRef.data()))
+				{
+					_jacDiscCache.clear();
+					_jacCacheRef = _jac;
+				}
+				_checkJacobianCache = false;
+			}
 
-		// Factorize
-		success = _jacDisc.factorize();
-		if (cadet_unlikely(!success))
+			_jacDiscFactorized = _jacDiscCache.find(alpha);
+		}
+
+		if (!_jacDiscFactorized)
 		{
-			LOG(Error) << "Factorize() failed for par block";
+			// Assemble
+			assembleDiscretizedJacobian(alpha, idxr);
+
+			// Factorize
+			success = _jacDisc.factorize();
+			if (cadet_unlikely(!success))
+			{
+				LOG(Error) << "Factorize() failed for par block";
+			}
+			else if (_constJacobian)
+				_jacDiscCache.insert(alpha, _jacDisc);
+
+			_jacDiscFactorized = &_jacDisc;
 		}
 
 		// Do not factorize again at next call without changed Jacobians
@@ -831,7 +912,7 @@ int LumpedRateModelWithoutPores::linearSolve(double t, double alpha, double oute
 	_jacInlet.multiplySubtract(rhs, rhs + idxr.offsetC());
 
 	// Solve
-	const bool result = _jacDisc.solve(rhs + idxr.offsetC());
+	const bool result = _jacDiscFactorized->solve(rhs + idxr.offsetC());
 	if (cadet_unlikely(!result))
 	{
 		LOG(Error) << "Solve() failed for bulk block";
@@ -1067,7 +1148,7 @@ void LumpedRateModelWithoutPores::consistentInitialState(const SimulationTime& s
 		linalg::DenseMatrixView fullJacobianMatrix(_jacDisc.data() + col * _disc.strideBound * _disc.strideBound, nullptr, mask.len, mask.len);
 
 		// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-		const double z = (0.5 + static_cast<double>(col)) / static_cast<double>(_disc.nCol);
+		const double z = _convDispOp.relativeCoordinate(col);
 
 		// Get workspace memory
 		BufferedArray<double> nonlinMemBuffer = tlmAlloc.array<double>(_nonlinearSolver->workspaceSize(probSize));
@@ -1365,7 +1446,7 @@ void LumpedRateModelWithoutPores::consistentInitialTimeDerivative(const Simulati
 			continue;
 
 		// Midpoint of current column cell (z coordinate) - needed in externally dependent adsorption kinetic
-		const double z = 1.0 / static_cast<double>(_disc.nCol) * (0.5 + col);
+		const double z = _convDispOp.relativeCoordinate(col);
 
 		// Get iterators to beginning of solid phase
 		linalg::BandMatrix::RowIterator jacSolidOrig = _jac.row(idxr.strideColCell() * col + idxr.strideColLiquid());
@@ -1781,6 +1862,14 @@ bool LumpedRateModelWithoutPores::setParameter(const ParameterId& pId, double va
 	return UnitOperationBase::setParameter(pId, value);
 }
 
+bool LumpedRateModelWithoutPores::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	if (_convDispOp.getParameterPointers(pId, ptrs))
+		return true;
+
+	return UnitOperationBase::getParameterPointers(pId, ptrs);
+}
+
 void LumpedRateModelWithoutPores::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
 	if (_convDispOp.setSensitiveParameterValue(_sensParams, pId, value))
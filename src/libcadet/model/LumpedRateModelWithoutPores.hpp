@@ -24,6 +24,7 @@
 #include "AutoDiff.hpp"
 #include "linalg/SparseMatrix.hpp"
 #include "linalg/BandMatrix.hpp"
+#include "linalg/FactorizationCache.hpp"
 #include "linalg/Gmres.hpp"
 #include "Memory.hpp"
 #include "model/ModelUtils.hpp"
@@ -79,6 +80,7 @@ public:
 	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
 	virtual bool configure(IParameterProvider& paramProvider);
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState);
 
 	virtual void useAnalyticJacobian(const bool analyticJac);
 
@@ -139,6 +141,7 @@ public:
 
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
@@ -208,6 +211,14 @@ protected:
 
 	linalg::BandMatrix _jac; //!< Jacobian
 	linalg::FactorizableBandMatrix _jacDisc; //!< Jacobian with time derivatives from BDF method
+	linalg::FactorizableBandMatrix const* _jacDiscFactorized; //!< Factorized Jacobian with time derivatives used by linearSolve()
+
+	linalg::FactorizationCache<linalg::FactorizableBandMatrix> _jacDiscCache; //!< Factorizations of _jacDisc for different BDF factors if the Jacobian is constant
+	linalg::BandMatrix _jacCacheRef; //!< Jacobian from which the factorizations in _jacDiscCache have been assembled
+	bool _constJacobian; //!< Determines whether the Jacobian is constant within the current section
+	bool _jacobianCurrent; //!< Determines whether _jac holds the constant Jacobian of the current section
+	bool _checkJacobianCache; //!< Determines whether _jac has been reevaluated and needs to be checked against _jacCacheRef
+	double _jacVelocity; //!< Interstitial velocity at which _jac has been evaluated
 
 	linalg::DoubleSparseMatrix _jacInlet; //!< Jacobian inlet DOF block matrix connects inlet DOFs to first bulk cells
 
@@ -329,9 +340,9 @@ protected:
 
 		virtual int writePrimaryCoordinates(double* coords) const
 		{
-			const double h = static_cast<double>(_model._convDispOp.columnLength()) / static_cast<double>(_disc.nCol);
+			const double L = static_cast<double>(_model._convDispOp.columnLength());
 			for (unsigned int i = 0; i < _disc.nCol; ++i)
-				coords[i] = (i + 0.5) * h;
+				coords[i] = _model._convDispOp.relativeCoordinate(i) * L;
 			return _disc.nCol;
 		}
 		virtual int writeSecondaryCoordinates(double* coords) const { return 0; }
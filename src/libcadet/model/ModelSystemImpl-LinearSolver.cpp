@@ -18,6 +18,7 @@
 #include "Logging.hpp"
 
 #include "ParallelSupport.hpp"
+#include "MpiSupport.hpp"
 #ifdef CADET_PARALLELIZE
 	#include <tbb/parallel_for.h>
 #endif
@@ -33,7 +34,13 @@ namespace model
 int ModelSystem::linearSolve(double t, double alpha, double outerTol, double* const rhs, double const* const weight,
 	const ConstSimulationState& simState)
 {
-	if (_linearModelOrdering.sliceSize(_curSwitchIndex) == 0)
+	// Distributed unit operations are solved independently of each other, which requires the parallel mode
+	if (!_distributed && (_linearModelBlocks[_curSwitchIndex].slices() > 0))
+	{
+		// Block-triangular
+		return linearSolveBlockTriangular(t, alpha, outerTol, rhs, weight, simState);
+	}
+	else if (_distributed || (_linearModelOrdering.sliceSize(_curSwitchIndex) == 0))
 	{
 		// Parallel
 		return linearSolveParallel(t, alpha, outerTol, rhs, weight, simState);
@@ -112,11 +119,16 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 	for (std::size_t i = 0; i < _models.size(); ++i)
 #endif
 	{
+		if (!ownsModel(i))
+			CADET_PAR_CONTINUE;
+
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 		_errorIndicator[i] = m->linearSolve(t, alpha, outerTol, rhs + offset, weight + offset, applyOffset(simState, offset));
 	} CADET_PARFOR_END;
 
+	gatherUnitOperationVector(rhs);
+
 	// Solve last row of L with backwards substitution: y_f = b_f - \sum_{i=0}^{N_z} J_{f,i} y_i
 	// Note that we cannot easily parallelize this loop since the results of the sparse
 	// matrix-vector multiplications are added in-place to rhs. We would need one copy of rhs
@@ -155,7 +167,7 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 	_gmres.matrixVectorMultiplier(schurComplementMatrixVectorPartial);
 
 	// Reset error indicator as it is used in schurComplementMatrixVector()
-	const int curError = totalErrorIndicatorFromLocal(_errorIndicator);
+	const int curError = totalErrorIndicator();
 	std::fill(_errorIndicator.begin(), _errorIndicator.end(), 0);
 
 	const int gmresResult = _gmres.solve(tolerance, weight + finalOffset, _tempState + finalOffset, rhs + finalOffset);
@@ -176,6 +188,9 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 	for (std::size_t idxModel = 0; idxModel < _models.size(); ++idxModel)
 #endif
 	{
+		if (!ownsModel(idxModel))
+			CADET_PAR_CONTINUE;
+
 		IUnitOperation* const m = _models[idxModel];
 		const unsigned int offset = _dofOffset[idxModel];
 
@@ -194,7 +209,9 @@ int ModelSystem::linearSolveParallel(double t, double alpha, double outerTol, do
 		}
 	} CADET_PARFOR_END;
 
-	return totalErrorIndicatorFromLocal(_errorIndicator);
+	gatherUnitOperationVector(rhs);
+
+	return totalErrorIndicator();
 }
 
 /**
@@ -221,7 +238,11 @@ int ModelSystem::schurComplementMatrixVector(double const* x, double* z, double
 	BENCH_SCOPE(_timerMatVec);
 
 	// Copy x over to result z, which corresponds to the application of the identity matrix
-	std::copy(x, x + numCouplingDOF(), z);
+	// If unit operations are distributed, the contributions of all processes are summed up first
+	if (_distributed)
+		std::fill(z, z + numCouplingDOF(), 0.0);
+	else
+		std::copy(x, x + numCouplingDOF(), z);
 
 	// Inlets and outlets don't participate in the Schur solver since one of NF or FN for them is always 0
 	// As a result we only have to work with items that have both an inlet and an outlet
@@ -232,6 +253,9 @@ int ModelSystem::schurComplementMatrixVector(double const* x, double* z, double
 #endif
 	{
 		const unsigned int idxModel = _inOutModels[i];
+		if (!ownsModel(idxModel))
+			CADET_PAR_CONTINUE;
+
 		IUnitOperation* const m = _models[idxModel];
 		const unsigned int offset = _dofOffset[idxModel];
 
@@ -250,6 +274,169 @@ int ModelSystem::schurComplementMatrixVector(double const* x, double* z, double
 		}
 	} CADET_PARFOR_END;
 
+	if (_distributed)
+	{
+		mpi::allReduceSum(z, numCouplingDOF());
+		for (unsigned int i = 0; i < numCouplingDOF(); ++i)
+			z[i] += x[i];
+	}
+
+	return totalErrorIndicator();
+}
+
+/**
+ * @brief Solves the linear system using the block-triangular structure of the unit operation network
+ * @details The strongly connected components of the network are processed in topological order.
+ *          The coupling DOFs of a block only depend on blocks that have already been solved.
+ *          Blocks without cycles consist of a single unit operation @f$ i @f$, which is solved
+ *          directly by forward substitution:
+ *          @f[ egin{align}
+ y_f &= b_f - \sum_{j} J_{f,j} \, y_j, \\
+ y_i &= J_i^{-1} \left( b_i - J_{i,f} \, y_f \right).
+ \end{align} @f]
+ *          Blocks with cycles (recycle loops) are solved by the Schur-complement approach of
+ *          linearSolveParallel(), where GMRES is restricted to the coupling DOFs of the unit
+ *          operations in the block.
+ */
+int ModelSystem::linearSolveBlockTriangular(double t, double alpha, double outerTol, double* const rhs, double const* const weight,
+	const ConstSimulationState& simState)
+{
+	BENCH_SCOPE(_timerLinearSolve);
+
+	const util::SlicedVector<int>& blocks = _linearModelBlocks[_curSwitchIndex];
+	char const* const cyclic = _linearModelBlockCyclic[_curSwitchIndex];
+	const unsigned int finalOffset = _dofOffset[_models.size()];
+	double* const rhsCoupling = rhs + finalOffset;
+	const double tolerance = std::sqrt(static_cast<double>(numDofs())) * outerTol * _schurSafety;
+
+	int curError = 0;
+	for (unsigned int idxBlock = 0; idxBlock < blocks.slices(); ++idxBlock)
+	{
+		int const* const units = blocks[idxBlock];
+		const int nUnits = blocks.sliceSize(idxBlock);
+
+		if (!cyclic[idxBlock])
+		{
+			const int idxUnit = units[0];
+			IUnitOperation* const m = _models[idxUnit];
+			const unsigned int offset = _dofOffset[idxUnit];
+
+			if (m->hasInlet())
+			{
+				// Coupling DOFs only depend on upstream unit operations, which have been solved already
+				for (std::size_t j = 0; j < _models.size(); ++j)
+					_jacFN[j].multiplySubtract(rhs + _dofOffset[j], rhsCoupling, _conDofOffset[idxUnit], _conDofOffset[idxUnit + 1]);
+
+				// Move coupling DOFs to right hand side of unit operation
+				_jacNF[idxUnit].multiplySubtract(rhsCoupling, rhs + offset);
+			}
+
+			curError = updateErrorIndicator(curError, m->linearSolve(t, alpha, outerTol, rhs + offset, weight + offset, applyOffset(simState, offset)));
+			continue;
+		}
+
+		// Step 1: Solve diagonal blocks y_i = J_i^{-1} b_i of unit operations in the cycle
+		for (int i = 0; i < nUnits; ++i)
+		{
+			const int idxUnit = units[i];
+			const unsigned int offset = _dofOffset[idxUnit];
+			curError = updateErrorIndicator(curError, _models[idxUnit]->linearSolve(t, alpha, outerTol, rhs + offset, weight + offset, applyOffset(simState, offset)));
+		}
+
+		// Step 2: Right hand side of Schur-complement y_f = b_f - \sum_j J_{f,j} y_j restricted to the
+		// coupling DOFs of the block, which only depend on upstream unit operations and the block itself
+		std::fill(_tempState + finalOffset, _tempState + finalOffset + numCouplingDOF(), 0.0);
+		std::fill(_tempCoupling.begin(), _tempCoupling.end(), 0.0);
+		for (int i = 0; i < nUnits; ++i)
+		{
+			const int idxUnit = units[i];
+			for (std::size_t j = 0; j < _models.size(); ++j)
+				_jacFN[j].multiplySubtract(rhs + _dofOffset[j], rhsCoupling, _conDofOffset[idxUnit], _conDofOffset[idxUnit + 1]);
+
+			std::copy(rhsCoupling + _conDofOffset[idxUnit], rhsCoupling + _conDofOffset[idxUnit + 1], _tempState + finalOffset + _conDofOffset[idxUnit]);
+			std::copy(rhsCoupling + _conDofOffset[idxUnit], rhsCoupling + _conDofOffset[idxUnit + 1], _tempCoupling.data() + _conDofOffset[idxUnit]);
+		}
+
+		// Step 3: Solve Schur-complement S x_f = y_f of the block
+		// Coupling DOFs outside of the block are kept at zero in the Krylov space
+		auto schurComplementMatrixVectorPartial = [&, this](void* userData, double const* x, double* z) -> int
+		{
+			return ModelSystem::schurComplementMatrixVectorBlock(units, nUnits, x, z, t, alpha, outerTol, weight, simState);
+		};
+
+		_gmres.matrixVectorMultiplier(schurComplementMatrixVectorPartial);
+		curError = updateErrorIndicator(curError, _gmres.solve(tolerance, weight + finalOffset, _tempState + finalOffset, _tempCoupling.data()));
+		curError = updateErrorIndicator(curError, totalErrorIndicatorFromLocal(_errorIndicator));
+
+		// Step 4: Backward substitution y_i = y_i - J_i^{-1} J_{i,f} x_f
+		for (int i = 0; i < nUnits; ++i)
+		{
+			const int idxUnit = units[i];
+			IUnitOperation* const m = _models[idxUnit];
+			const unsigned int offset = _dofOffset[idxUnit];
+			const unsigned int offsetNext = _dofOffset[idxUnit + 1];
+
+			std::copy(_tempCoupling.data() + _conDofOffset[idxUnit], _tempCoupling.data() + _conDofOffset[idxUnit + 1], rhsCoupling + _conDofOffset[idxUnit]);
+
+			std::fill(_tempState + offset, _tempState + offsetNext, 0.0);
+			_jacNF[idxUnit].multiplyVector(rhsCoupling, _tempState + offset);
+			curError = updateErrorIndicator(curError, m->linearSolve(t, alpha, outerTol, _tempState + offset, weight + offset, applyOffset(simState, offset)));
+
+			for (unsigned int k = offset; k < offsetNext; ++k)
+				rhs[k] -= _tempState[k];
+		}
+	}
+
+	std::fill(_errorIndicator.begin(), _errorIndicator.end(), curError);
+	return curError;
+}
+
+/**
+ * @brief Performs the matrix-vector product @f$ z = Sx @f$ with the Schur-complement of a block of unit operations
+ * @details The Schur-complement is restricted to the coupling DOFs of the unit operations in the
+ *          block, see schurComplementMatrixVector(). All other coupling DOFs are mapped by the
+ *          identity matrix.
+ * @param [in] units Indices of the unit operations in the block
+ * @param [in] nUnits Number of unit operations in the block
+ * @param [in] x Vector @f$ x @f$ the matrix @f$ S @f$ is multiplied with
+ * @param [out] z Result of the matrix-vector multiplication
+ * @return @c 0 if successful, any other value in case of failure
+ */
+int ModelSystem::schurComplementMatrixVectorBlock(int const* units, int nUnits, double const* x, double* z, double t, double alpha, double outerTol,
+	double const* const weight, const ConstSimulationState& simState) const
+{
+	BENCH_SCOPE(_timerMatVec);
+
+	// Copy x over to result z, which corresponds to the application of the identity matrix
+	std::copy(x, x + numCouplingDOF(), z);
+	std::fill(_errorIndicator.begin(), _errorIndicator.end(), 0);
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(0, nUnits, [=](int i)
+#else
+	for (int i = 0; i < nUnits; ++i)
+#endif
+	{
+		const int idxModel = units[i];
+		IUnitOperation* const m = _models[idxModel];
+		const unsigned int offset = _dofOffset[idxModel];
+
+		std::fill(_tempState + offset, _tempState + _dofOffset[idxModel + 1], 0.0);
+		_jacNF[idxModel].multiplyVector(x, _tempState + offset);
+
+		// Apply N_i^{-1} to tempState_i
+		_errorIndicator[idxModel] = m->linearSolve(t, alpha, outerTol, _tempState + offset, weight + offset, applyOffset(simState, offset));
+
+		// Apply J_{f,i} restricted to the coupling DOFs of the block and subtract results from z
+		{
+#ifdef CADET_PARALLELIZE
+			SchurComplementMutex::scoped_lock l(_schurMutex);
+#endif
+			for (int k = 0; k < nUnits; ++k)
+				_jacFN[idxModel].multiplySubtract(_tempState + offset, z, _conDofOffset[units[k]], _conDofOffset[units[k] + 1]);
+		}
+	} CADET_PARFOR_END;
+
 	return totalErrorIndicatorFromLocal(_errorIndicator);
 }
 
@@ -288,7 +475,7 @@ void ModelSystem::multiplyWithDerivativeJacobian(const SimulationTime& simTime,
 	{
 		IUnitOperation* const m = _models[idxModel];
 		const unsigned int offset = _dofOffset[idxModel];
-		m->multiplyWithDerivativeJacobian(simTime, simState, yS + offset, ret + offset);
+		m->multiplyWithDerivativeJacobian(simTime, applyOffset(simState, offset), yS + offset, ret + offset);
 	}
 	std::fill(ret + _dofOffset.back(), ret + numDofs(), 0.0);
 }
@@ -154,6 +154,17 @@ void ModelSystem::notifyDiscontinuousSectionTransition(double t, unsigned int se
 #endif
 }
 
+bool ModelSystem::adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState)
+{
+	bool changed = false;
+	for (std::size_t i = 0; i < _models.size(); ++i)
+	{
+		if (_models[i]->adaptDiscretization(t, secIdx, applyOffset(simState, _dofOffset[i])))
+			changed = true;
+	}
+	return changed;
+}
+
 /**
  * @brief Updates inlet and outlet flow rates of the given unit operation
  * @details Updates the corresponding slice of _flowRateIn and _flowRateOut.
@@ -499,9 +510,12 @@ int ModelSystem::residual(const SimulationTime& simTime, const ConstSimulationSt
 			m->setFlowRates(_flowRateIn[i], _flowRateOut[i]);
 		}
 
-		_errorIndicator[i] = m->residual(simTime, applyOffset(simState, offset), res + offset, _threadLocalStorage);
+		if (ownsModel(i))
+			_errorIndicator[i] = m->residual(simTime, applyOffset(simState, offset), res + offset, _threadLocalStorage);
 	} CADET_PARFOR_END;
 
+	gatherUnitOperationVector(res);
+
 	// Handle connections
 	if (cadet_unlikely(_hasDynamicFlowRates))
 		assembleBottomMacroRow(simTime.t);
@@ -509,7 +523,7 @@ int ModelSystem::residual(const SimulationTime& simTime, const ConstSimulationSt
 	residualConnectUnitOps<double, double, double>(simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res);
 
 	BENCH_STOP(_timerResidual);
-	return totalErrorIndicatorFromLocal(_errorIndicator);
+	return totalErrorIndicator();
 }
 
 int ModelSystem::residualWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState,
@@ -544,7 +558,7 @@ int ModelSystem::residualWithJacobian(const SimulationTime& simTime, const Const
 	residualConnectUnitOps<double, double, double>(simTime.secIdx, simState.vecStateY, simState.vecStateYdot, res);
 
 	BENCH_STOP(_timerResidual);
-	return totalErrorIndicatorFromLocal(_errorIndicator);
+	return totalErrorIndicator();
 }
 
 /**
@@ -699,7 +713,9 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 			m->setFlowRates(_flowRateIn[i], _flowRateOut[i]);
 		}
 
-		_errorIndicator[i] = ResidualSensCaller<evalJacobian>::call(m, simTime, applyOffset(simState, offset), applyOffset(adJac, offset), _threadLocalStorage);
+		// Jacobians are required on all processes (e.g., for consistent initialization)
+		if (evalJacobian || ownsModel(i))
+			_errorIndicator[i] = ResidualSensCaller<evalJacobian>::call(m, simTime, applyOffset(simState, offset), applyOffset(adJac, offset), _threadLocalStorage);
 	} CADET_PARFOR_END;
 
 	// Connect units
@@ -718,6 +734,9 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 		IUnitOperation* const m = _models[i];
 		const unsigned int offset = _dofOffset[i];
 
+		if (!ownsModel(i))
+			CADET_PAR_CONTINUE;
+
 		// Move this outside the loop, these are memory addresses and should never change
 		// Use correct offset in sensitivity state vectors
 		for (std::size_t j = 0; j < yS.size(); ++j)
@@ -731,6 +750,9 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 		_errorIndicator[i] = updateErrorIndicator(_errorIndicator[i], intermediateRes);
 	} CADET_PARFOR_END;
 
+	for (std::size_t param = 0; param < resS.size(); ++param)
+		gatherUnitOperationVector(resS[param]);
+
 	// tmp1 stores result of (dF / dy) * s
 	// tmp2 stores result of (dF / dyDot) * sDot
 
@@ -760,7 +782,7 @@ int ModelSystem::residualSensFwdWithJacobianAlgorithm(unsigned int nSens, const
 	} CADET_PARFOR_END;
 
 	BENCH_STOP(_timerResidualSens);
-	return totalErrorIndicatorFromLocal(_errorIndicator);
+	return totalErrorIndicator();
 }
 
 }  // namespace model
@@ -26,6 +26,7 @@
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
+#include "MpiSupport.hpp"
 
 #include "model/ModelSystemImpl-Helper.hpp"
 
@@ -95,7 +96,8 @@ namespace cadet
 namespace model
 {
 
-ModelSystem::ModelSystem() : _jacNF(nullptr), _jacFN(nullptr), _jacActiveFN(nullptr), _curSwitchIndex(0), _tempState(nullptr), _initState(0, 0.0), _initStateDot(0, 0.0)
+ModelSystem::ModelSystem() : _jacNF(nullptr), _jacFN(nullptr), _jacActiveFN(nullptr), _curSwitchIndex(0), _distributeUnitOps(false), _distributed(false), _mpiRank(0),
+	_tempState(nullptr), _initState(0, 0.0), _initStateDot(0, 0.0)
 {
 }
 
@@ -455,6 +457,8 @@ bool ModelSystem::configureModelDiscretization(IParameterProvider& paramProvider
 	readLinearSolutionMode(paramProvider);
 	paramProvider.popScope();
 
+	partitionModels();
+
 	configureSwitches(paramProvider);
 	_curSwitchIndex = 0;
 
@@ -536,6 +540,7 @@ bool ModelSystem::configureModelDiscretization(IParameterProvider& paramProvider
 	// Allocate tempState vector
 	delete[] _tempState;
 	_tempState = new double[numDofs()];
+	_tempCoupling.resize(numCouplingDOF());
 
 //	_tempSchur = new double[*std::max_element(_dofs.begin(), _dofs.end())];
 	_flowRateIn.reserve(totalNumInletPorts(), _models.size());
@@ -626,6 +631,8 @@ bool ModelSystem::configure(IParameterProvider& paramProvider)
 
 	paramProvider.popScope();
 
+	partitionModels();
+
 	_gmres.orthoMethod(linalg::toOrthogonalization(gsType));
 	_gmres.maxRestarts(maxRestarts);
 
@@ -655,6 +662,9 @@ void ModelSystem::configureSwitches(IParameterProvider& paramProvider)
 	_flowRates.reserve(numSwitches * _models.size() * _models.size(), numSwitches);
 	_linearModelOrdering.reserve(numSwitches * _models.size(), numSwitches);
 	_linearModelOrdering.clear();
+	_linearModelBlocks.clear();
+	_linearModelBlocks.reserve(numSwitches);
+	_linearModelBlockCyclic.clear();
 
 #if CADET_COMPILER_CXX_CONSTEXPR
 	constexpr StringHash flowHash = hashString("CONNECTION");
@@ -802,8 +812,9 @@ void ModelSystem::configureSwitches(IParameterProvider& paramProvider)
 
 			if (hasCycles)
 			{
-				LOG(Warning) << "Detected cycle in connections of switch " << i << ", reverting to parallel solution method";
+				LOG(Warning) << "Detected cycle in connections of switch " << i << ", reverting to block-triangular solution method";
 				_linearModelOrdering.pushBackSlice(0);
+				pushLinearModelBlocks(adjList);
 			}
 			else
 			{
@@ -812,6 +823,14 @@ void ModelSystem::configureSwitches(IParameterProvider& paramProvider)
 				LOG(Debug) << "Reversed ordering: " << topoOrder;
 			}
 		}
+		else if (_linearSolutionMode == 3)
+		{
+			// Block-triangular solution method
+			const util::SlicedVector<int> adjList = graph::adjacencyListFromConnectionList(conn.data(), _models.size(), conn.size() / 6);
+			_linearModelOrdering.pushBackSlice(0);
+			pushLinearModelBlocks(adjList);
+			LOG(Debug) << "Select block-triangular solution method for switch " << i;
+		}
 		else
 		{
 			// Auto detect solution method
@@ -833,8 +852,10 @@ void ModelSystem::configureSwitches(IParameterProvider& paramProvider)
 
 				if (hasCycles)
 				{
+					// Solve acyclic parts directly and only use GMRES for the cycles
 					_linearModelOrdering.pushBackSlice(0);
-					LOG(Debug) << "Select parallel solution method for switch " << i << " (cycles found)";
+					pushLinearModelBlocks(adjList);
+					LOG(Debug) << "Select block-triangular solution method for switch " << i << " (cycles found)";
 				}
 				else
 				{
@@ -845,6 +866,13 @@ void ModelSystem::configureSwitches(IParameterProvider& paramProvider)
 			}
 		}
 
+		// Switches without block-triangular decomposition do not have blocks
+		if (_linearModelBlocks.size() == i)
+		{
+			_linearModelBlocks.emplace_back();
+			_linearModelBlockCyclic.pushBackSlice(0);
+		}
+
 		paramProvider.popScope();
 	}
 
@@ -925,6 +953,131 @@ void ModelSystem::readLinearSolutionMode(IParameterProvider& paramProvider)
 	// Override default by user option
 	if (paramProvider.exists("LINEAR_SOLUTION_MODE"))
 		_linearSolutionMode = paramProvider.getInt("LINEAR_SOLUTION_MODE");
+
+	_distributeUnitOps = paramProvider.exists("DISTRIBUTE_UNIT_OPERATIONS") && paramProvider.getBool("DISTRIBUTE_UNIT_OPERATIONS");
+}
+
+/**
+ * @brief Computes the block-triangular decomposition of the unit operation network
+ * @details The strongly connected components of the network form the diagonal blocks of a
+ *          block-triangular ordering of the unit operations. Blocks without cycles consist of a
+ *          single unit operation, which is solved directly. Only blocks with cycles (recycle loops)
+ *          require GMRES on the Schur-complement. Appends one slice to _linearModelBlocks and
+ *          _linearModelBlockCyclic.
+ * @param [in] adjList Adjacency list of the unit operation network of the current switch
+ */
+void ModelSystem::pushLinearModelBlocks(const util::SlicedVector<int>& adjList)
+{
+	const util::SlicedVector<int> scc = graph::stronglyConnectedComponents(adjList);
+
+	// Reverse order of components such that all dependencies of a block are listed before it
+	util::SlicedVector<int> blocks;
+	blocks.reserve(_models.size(), scc.slices());
+	_linearModelBlockCyclic.pushBackSlice(0);
+
+	int nCyclic = 0;
+	for (int i = static_cast<int>(scc.slices()) - 1; i >= 0; --i)
+	{
+		const bool cyclic = (scc.sliceSize(i) > 1) || graph::hasSelfLoop(adjList, scc(i, 0));
+		blocks.pushBackSlice(scc[i], scc.sliceSize(i));
+		_linearModelBlockCyclic.pushBackInLastSlice(cyclic);
+
+		if (cyclic)
+			++nCyclic;
+	}
+
+	LOG(Debug) << "Found " << blocks.slices() << " blocks, " << nCyclic << " of them cyclic";
+	_linearModelBlocks.push_back(std::move(blocks));
+}
+
+/**
+ * @brief Assigns the unit operations to the MPI processes
+ * @details Each process handles a contiguous range of unit operations such that the number of DOFs
+ *          is balanced across the processes. All processes integrate the full system redundantly,
+ *          but only evaluate residuals and solve linear systems of their own unit operations.
+ *          The results are exchanged after each evaluation. Jacobians are still assembled by all
+ *          processes, since they are also required by the (redundant) consistent initialization.
+ *
+ *          Unit operations are only distributed if requested by the user and if there are at least
+ *          two MPI processes.
+ */
+void ModelSystem::partitionModels()
+{
+	const int nRanks = mpi::size();
+	_mpiRank = mpi::rank();
+	_distributed = _distributeUnitOps && (nRanks > 1);
+
+	if (_distributeUnitOps && !_distributed)
+		LOG(Warning) << "Distribution of unit operations requested, but only a single MPI process is available";
+
+	if (!_distributed)
+	{
+		_rankModelOffset.clear();
+		_rankDofCount.clear();
+		_rankDofOffset.clear();
+		return;
+	}
+
+	_rankModelOffset.resize(nRanks + 1);
+	_rankDofCount.resize(nRanks);
+	_rankDofOffset.resize(nRanks);
+
+	// Greedily assign unit operations whose DOF midpoint lies below the rank's share of the total DOFs
+	const double totalDof = static_cast<double>(_dofOffset[numModels()]);
+	unsigned int idxModel = 0;
+	for (int r = 0; r < nRanks; ++r)
+	{
+		_rankModelOffset[r] = idxModel;
+		const double target = totalDof * static_cast<double>(r + 1) / static_cast<double>(nRanks);
+		while ((idxModel < numModels()) && ((r == nRanks - 1) || (_dofOffset[idxModel] + 0.5 * _dofs[idxModel] <= target)))
+			++idxModel;
+	}
+	_rankModelOffset[nRanks] = numModels();
+
+	for (int r = 0; r < nRanks; ++r)
+	{
+		_rankDofOffset[r] = _dofOffset[_rankModelOffset[r]];
+		_rankDofCount[r] = _dofOffset[_rankModelOffset[r + 1]] - _dofOffset[_rankModelOffset[r]];
+	}
+
+	LOG(Debug) << "Unit operations distributed to MPI processes by offsets " << _rankModelOffset;
+}
+
+/**
+ * @brief Exchanges the unit operation parts of a vector between all MPI processes
+ * @details Each process contributes the parts of its own unit operations. On exit, all processes
+ *          hold the full vector. The coupling DOFs are not exchanged. Does nothing if unit
+ *          operations are not distributed.
+ * @param [in,out] vec Vector of full system size
+ */
+void ModelSystem::gatherUnitOperationVector(double* const vec) const
+{
+	if (!_distributed)
+		return;
+
+	mpi::allGatherSegments(vec, _rankDofCount.data(), _rankDofOffset.data());
+}
+
+/**
+ * @brief Computes the total error code of the last unit operation function calls
+ * @details If unit operations are distributed, the error codes of all MPI processes are combined
+ *          such that all processes return the same result.
+ * @return Total error code summarizing all unit operations
+ */
+int ModelSystem::totalErrorIndicator() const
+{
+	if (_distributed)
+	{
+		// Each unit operation contributes only on its owning process
+		for (std::size_t i = 0; i < _models.size(); ++i)
+		{
+			if (!ownsModel(i))
+				_errorIndicator[i] = 0;
+		}
+		mpi::allReduceSum(_errorIndicator.data(), static_cast<int>(_errorIndicator.size()));
+	}
+
+	return totalErrorIndicatorFromLocal(_errorIndicator);
 }
 
 /**
@@ -1219,6 +1372,64 @@ bool ModelSystem::setParameter(const ParameterId& pId, bool value)
 	return setParameterImpl(pId, value);
 }
 
+bool ModelSystem::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	const std::size_t oldSize = ptrs.size();
+	auto paramHandle = _parameters.find(pId);
+	if (paramHandle != _parameters.end())
+	{
+		ptrs.push_back(paramHandle->second);
+
+		// Multiplex flow rate parameters
+#if CADET_COMPILER_CXX_CONSTEXPR
+		constexpr StringHash flowHash = hashString("CONNECTION");
+#else
+		const StringHash flowHash = hashString("CONNECTION");
+#endif
+		if (flowHash == pId.name)
+		{
+			// Find the index of the valve switch
+			const auto it = std::find(_switchSectionIndex.begin(), _switchSectionIndex.end(), pId.section);
+			if (it != _switchSectionIndex.end())
+			{
+				const unsigned int idxSwitch = std::distance(_switchSectionIndex.begin(), it);
+				int const* ptrConn = _connections[idxSwitch];
+				active* conRates = _flowRates[idxSwitch];
+
+				// Collect all flow rates of the same connection (except for components)
+				for (unsigned int i = 0; i < _connections.sliceSize(idxSwitch) / 6; ++i, ptrConn += 6, ++conRates)
+				{
+					if ((ptrConn[2] != pId.component) || (ptrConn[3] != pId.particleType) || (ptrConn[0] != pId.boundState) || (ptrConn[1] != pId.reaction))
+						continue;
+
+					ptrs.push_back(conRates);
+				}
+			}
+		}
+	}
+
+	// Filter by unit operation ID (same as setParameterImpl())
+	for (IUnitOperation* m : _models)
+	{
+		if ((m->unitOperationId() != pId.unitOperation) && (pId.unitOperation != UnitOpIndep))
+			continue;
+
+		if (m->getParameterPointers(pId, ptrs))
+			return true;
+
+		// Unit operation knows the parameter but cannot expose it directly
+		if (m->hasParameter(pId))
+		{
+			ptrs.resize(oldSize);
+			return false;
+		}
+
+		break;
+	}
+
+	return ptrs.size() > oldSize;
+}
+
 void ModelSystem::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
 	if (pId.unitOperation == UnitOpIndep)
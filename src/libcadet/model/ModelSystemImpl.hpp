@@ -85,6 +85,7 @@ public:
 	virtual bool configureModelDiscretization(IParameterProvider& paramProvider, IConfigHelper& helper);
 	virtual bool configure(IParameterProvider& paramProvider);
 	virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const ConstSimulationState& simState, const AdJacobianParams& adJac);
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState);
 	virtual bool configureModel(IParameterProvider& paramProvider, unsigned int unitOpIdx);
 
 	virtual bool hasParameter(const ParameterId& pId) const;
@@ -95,6 +96,8 @@ public:
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setParameter(const ParameterId& pId, bool value);
 
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
+
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
@@ -180,7 +183,7 @@ public:
 #endif
 
 	void multiplyWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double alpha, double beta, double* ret);
-	void multiplyWithDerivativeJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double* ret);
+	virtual void multiplyWithDerivativeJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, double const* yS, double* ret);
 
 #ifdef CADET_DEBUG
 	void genJacobian(const SimulationTime& simTime, const ConstSimulationState& simState);
@@ -202,6 +205,12 @@ protected:
 	int schurComplementMatrixVector(double const* x, double* z, double t, double alpha, double outerTol, double const* const weight,
 		const ConstSimulationState& simState) const;
 
+	int linearSolveBlockTriangular(double t, double alpha, double tol, double* const rhs, double const* const weight,
+		const ConstSimulationState& simState);
+
+	int schurComplementMatrixVectorBlock(int const* units, int nUnits, double const* x, double* z, double t, double alpha, double outerTol,
+		double const* const weight, const ConstSimulationState& simState) const;
+
 	void configureSwitches(IParameterProvider& paramProvider);
 
 	template <typename StateType, typename ResidualType, typename ParamType>
@@ -217,6 +226,10 @@ protected:
 	int dResDpFwdWithJacobian(const SimulationTime& simTime, const ConstSimulationState& simState, const AdJacobianParams& adJac);
 
 	void readLinearSolutionMode(IParameterProvider& paramProvider);
+	void pushLinearModelBlocks(const util::SlicedVector<int>& adjList);
+	void partitionModels();
+	void gatherUnitOperationVector(double* const vec) const;
+	int totalErrorIndicator() const;
 	void rebuildInternalDataStructures();
 	void allocateSuperStructMatrices();
 	void calcUnitFlowRateCoefficients();
@@ -255,6 +268,17 @@ protected:
 	 */
 	inline unsigned int numCouplingDOF() const CADET_NOEXCEPT { return _couplingIdxMap.size(); }
 
+	/**
+	 * @brief Returns whether the given unit operation is handled by the current process
+	 * @details If unit operations are not distributed across MPI processes, all of them are handled by the current process.
+	 * @param [in] idxModel Index of the unit operation in _models
+	 * @return @c true if the current process evaluates the unit operation, otherwise @c false
+	 */
+	inline bool ownsModel(std::size_t idxModel) const CADET_NOEXCEPT
+	{
+		return !_distributed || ((idxModel >= _rankModelOffset[_mpiRank]) && (idxModel < _rankModelOffset[_mpiRank + 1]));
+	}
+
 	std::vector<IUnitOperation*> _models; //!< Unit operation models
 	std::vector<IExternalFunction*> _extFunctions; //!< External functions
 	linalg::SparseMatrix<double>* _jacNF; //!< Jacobian block connecting coupling DOF to inlets
@@ -271,11 +295,20 @@ protected:
 	std::vector<unsigned int> _switchSectionIndex; //!< Holds indices of sections where valves are switched
 	unsigned int _curSwitchIndex; //!< Current index in _switchSectionIndex list 
 	util::SlicedVector<int> _linearModelOrdering; //!< Dependency-consistent ordering of unit operation models for linear execution (for each switch)
-	int _linearSolutionMode; //!< Linear solution mode (0: automatic, 1: parallel, 2: sequential)
+	std::vector<util::SlicedVector<int>> _linearModelBlocks; //!< Strongly connected components of the unit operation network in topological order for block-triangular linear execution (for each switch, empty if not used)
+	util::SlicedVector<char> _linearModelBlockCyclic; //!< Determines whether a block in _linearModelBlocks contains a cycle (for each switch)
+	int _linearSolutionMode; //!< Linear solution mode (0: automatic, 1: parallel, 2: sequential, 3: block-triangular)
+	bool _distributeUnitOps; //!< Determines whether distribution of unit operations across MPI processes is requested
+	bool _distributed; //!< Determines whether unit operations are actually distributed across MPI processes
+	int _mpiRank; //!< Rank of the current MPI process
+	std::vector<unsigned int> _rankModelOffset; //!< Index of the first unit operation handled by each MPI process (contiguous ranges)
+	std::vector<int> _rankDofCount; //!< Number of unit operation DOFs handled by each MPI process
+	std::vector<int> _rankDofOffset; //!< Offset of the unit operation DOFs handled by each MPI process
 
 	mutable std::vector<int> _errorIndicator; //!< Storage for return value of unit operation function calls
 
 	double* _tempState; //!< Temporary storage for the state vector
+	std::vector<double> _tempCoupling; //!< Temporary storage for the coupling DOFs in linearSolveBlockTriangular()
 	util::SlicedVector<active> _totalInletFlow; //!< Total flow rate into each inlet at the current section
 	util::SlicedVector<active> _totalInletFlowLin; //!< Total linear flow rate coefficient into each inlet at the current section
 	util::SlicedVector<active> _totalInletFlowQuad; //!< Total quadratic flow rate coefficient into each inlet at the current section
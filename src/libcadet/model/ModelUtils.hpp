@@ -236,6 +236,43 @@ bool setParameter(const ParameterId& pId, param_t value, const std::vector<T*>&
 	return false;
 }
 
+template <typename T>
+bool getParameterPointers(const ParameterId& pId, const std::vector<T*>& items, bool singleItem, std::vector<active*>& ptrs)
+{
+	if (items.empty())
+		return false;
+
+	if (singleItem)
+	{
+		if (!items[0])
+			return false;
+
+		active* const val = items[0]->getParameter(pId);
+		if (val)
+		{
+			ptrs.push_back(val);
+			return true;
+		}
+	}
+	else
+	{
+		for (T* bm : items)
+		{
+			if (!bm)
+				continue;
+
+			active* const val = bm->getParameter(pId);
+			if (val)
+			{
+				ptrs.push_back(val);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
 template <typename T>
 bool setSensitiveParameterValue(const ParameterId& pId, double value, const std::unordered_set<active*>& sensParams, const std::vector<T*>& items, bool singleItem)
 {
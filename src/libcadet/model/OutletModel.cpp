@@ -102,6 +102,11 @@ bool OutletModel::setParameter(const ParameterId& pId, double value)
 	return false;
 }
 
+bool OutletModel::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	return false;
+}
+
 bool OutletModel::setParameter(const ParameterId& pId, bool value)
 {
 	return false;
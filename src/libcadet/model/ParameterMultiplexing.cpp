@@ -36,7 +36,8 @@ bool readAndRegisterMultiplexTypeParam(IParameterProvider& paramProvider, std::u
 	return singleValue;
 }
 
-bool multiplexTypeParameterValue(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, double value, std::unordered_set<active*> const* sensParams)
+template <typename visitor_t>
+inline bool visitMultiplexTypeParameter(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, std::unordered_set<active*> const* sensParams, visitor_t visitor)
 {
 	if (!mode || (pId.name != nameHash))
 		return false;
@@ -47,11 +48,21 @@ bool multiplexTypeParameterValue(const ParameterId& pId, StringHash nameHash, bo
 		return false;
 
 	for (std::size_t i = 0; i < data.size(); ++i)
-		data[i].setValue(value);
+		visitor(data[i]);
 
 	return true;
 }
 
+bool multiplexTypeParameterValue(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, double value, std::unordered_set<active*> const* sensParams)
+{
+	return visitMultiplexTypeParameter(pId, nameHash, mode, data, sensParams, [=](active& p) { p.setValue(value); });
+}
+
+bool multiplexTypeParameterPointers(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, std::vector<active*>& ptrs)
+{
+	return visitMultiplexTypeParameter(pId, nameHash, mode, data, nullptr, [&](active& p) { ptrs.push_back(&p); });
+}
+
 bool multiplexTypeParameterAD(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, unsigned int adDirection, double adValue, std::unordered_set<active*>& sensParams)
 {
 	if (!mode || (pId.name != nameHash))
@@ -170,7 +181,8 @@ MultiplexMode readAndRegisterMultiplexCompTypeSecParam(IParameterProvider& param
 	return mode;
 }
 
-bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, double value, std::unordered_set<active*> const* sensParams)
+template <typename visitor_t>
+inline bool visitMultiplexCompTypeSecParameter(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, std::unordered_set<active*> const* sensParams, visitor_t visitor)
 {
 	if (pId.name != nameHash)
 		return false;
@@ -187,7 +199,7 @@ bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameH
 					return false;
 
 				for (unsigned int i = 0; i < nParType; ++i)
-					data[i * nComp + pId.component].setValue(value);
+					visitor(data[i * nComp + pId.component]);
 
 				return true;
 			}
@@ -201,7 +213,7 @@ bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameH
 					return false;
 
 				for (unsigned int i = 0; i < nParType; ++i)
-					data[i * nComp + pId.section * nComp * nParType + pId.component].setValue(value);
+					visitor(data[i * nComp + pId.section * nComp * nParType + pId.component]);
 
 				return true;
 			}
@@ -223,6 +235,16 @@ bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameH
 	return false;
 }
 
+bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, double value, std::unordered_set<active*> const* sensParams)
+{
+	return visitMultiplexCompTypeSecParameter(pId, nameHash, mode, data, nParType, nComp, sensParams, [=](active& p) { p.setValue(value); });
+}
+
+bool multiplexCompTypeSecParameterPointers(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, std::vector<active*>& ptrs)
+{
+	return visitMultiplexCompTypeSecParameter(pId, nameHash, mode, data, nParType, nComp, nullptr, [&](active& p) { ptrs.push_back(&p); });
+}
+
 bool multiplexCompTypeSecParameterAD(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, unsigned int adDirection, double adValue, std::unordered_set<active*>& sensParams)
 {
 	if (pId.name != nameHash)
@@ -403,8 +425,9 @@ MultiplexMode readAndRegisterMultiplexBndCompTypeSecParam(IParameterProvider& pa
 	return mode;
 }
 
-bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
-	unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, double value, std::unordered_set<active*> const* sensParams)
+template <typename visitor_t>
+inline bool visitMultiplexBndCompTypeSecParameter(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
+	unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, std::unordered_set<active*> const* sensParams, visitor_t visitor)
 {
 	if (pId.name != nameHash)
 		return false;
@@ -424,7 +447,7 @@ bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash na
 					return false;
 
 				for (unsigned int i = 0; i < nParType; ++i)
-					data[boundOffset[pId.component] + pId.boundState + i * strideBound[0]].setValue(value);
+					visitor(data[boundOffset[pId.component] + pId.boundState + i * strideBound[0]]);
 
 				return true;
 			}
@@ -438,7 +461,7 @@ bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash na
 					return false;
 
 				for (unsigned int i = 0; i < nParType; ++i)
-					data[pId.section * strideBound[nParType] + boundOffset[pId.component] + pId.boundState + i * strideBound[0]].setValue(value);
+					visitor(data[pId.section * strideBound[nParType] + boundOffset[pId.component] + pId.boundState + i * strideBound[0]]);
 
 				return true;
 			}
@@ -460,6 +483,18 @@ bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash na
 	return false;
 }
 
+bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
+	unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, double value, std::unordered_set<active*> const* sensParams)
+{
+	return visitMultiplexBndCompTypeSecParameter(pId, nameHash, mode, data, nParType, nComp, strideBound, nBound, boundOffset, sensParams, [=](active& p) { p.setValue(value); });
+}
+
+bool multiplexBndCompTypeSecParameterPointers(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
+	unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, std::vector<active*>& ptrs)
+{
+	return visitMultiplexBndCompTypeSecParameter(pId, nameHash, mode, data, nParType, nComp, strideBound, nBound, boundOffset, nullptr, [&](active& p) { ptrs.push_back(&p); });
+}
+
 bool multiplexBndCompTypeSecParameterAD(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
 	unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, unsigned int adDirection, double adValue, std::unordered_set<active*>& sensParams)
 {
@@ -100,6 +100,19 @@ namespace model
 	 */
 	bool multiplexTypeParameterValue(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, double value, std::unordered_set<active*> const* sensParams);
 
+	/**
+	 * @brief Collects the instances of a multiplexed parameter that may depend on particle type
+	 * @details Appends all parameter instances that multiplexTypeParameterValue() would update to @p ptrs.
+	 * 
+	 * @param [in] pId ParameterID
+	 * @param [in] nameHash Hash of the parameter name
+	 * @param [in] mode Multiplexing mode as obtained by readAndRegisterMultiplexTypeParam()
+	 * @param [in] data Array with parameters
+	 * @param [in,out] ptrs List the parameter instances are appended to
+	 * @return @c true if the parameter has been found, or @c false otherwise
+	 */
+	bool multiplexTypeParameterPointers(const ParameterId& pId, StringHash nameHash, bool mode, std::vector<active>& data, std::vector<active*>& ptrs);
+
 	/**
 	 * @brief Sets AD info of a multiplexed parameter that may depend on particle type
 	 * @details Sets the AD direction and seed value of a parameter and multiplexes the info onto all parameter instances.
@@ -168,6 +181,21 @@ namespace model
 	 */
 	bool multiplexCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, double value, std::unordered_set<active*> const* sensParams);
 
+	/**
+	 * @brief Collects the instances of a multiplexed parameter that depends on particle type, component, and (optionally) section
+	 * @details Appends all parameter instances that multiplexCompTypeSecParameterValue() would update to @p ptrs.
+	 * 
+	 * @param [in] pId ParameterID
+	 * @param [in] nameHash Hash of the parameter name
+	 * @param [in] mode Multiplexing mode as obtained by readAndRegisterMultiplexCompTypeSecParam()
+	 * @param [in] data Array with parameters
+	 * @param [in] nParType Number of particle types
+	 * @param [in] nComp Number of components
+	 * @param [in,out] ptrs List the parameter instances are appended to
+	 * @return @c true if the parameter has been found, or @c false otherwise
+	 */
+	bool multiplexCompTypeSecParameterPointers(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data, unsigned int nParType, unsigned int nComp, std::vector<active*>& ptrs);
+
 	/**
 	 * @brief Sets AD info of a multiplexed parameter that depends on particle type, component, and (optionally) section
 	 * @details Sets the AD direction and seed value of a parameter and multiplexes the info onto all parameter instances.
@@ -248,6 +276,25 @@ namespace model
 	bool multiplexBndCompTypeSecParameterValue(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
 		unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, double value, std::unordered_set<active*> const* sensParams);
 
+	/**
+	 * @brief Collects the instances of a multiplexed parameter that depends on particle type, component, bound state, and (optionally) section
+	 * @details Appends all parameter instances that multiplexBndCompTypeSecParameterValue() would update to @p ptrs.
+	 * 
+	 * @param [in] pId ParameterID
+	 * @param [in] nameHash Hash of the parameter name
+	 * @param [in] mode Multiplexing mode as obtained by readAndRegisterMultiplexCompTypeSecParam()
+	 * @param [in] data Array with parameters
+	 * @param [in] nParType Number of particle types
+	 * @param [in] nComp Number of components
+	 * @param [in] strideBound Array with number of bound states per particle type (additional last element is total number of bound states)
+	 * @param [in] nBound Array with number of bound states per component and particle type in type-major ordering
+	 * @param [in] boundOffset Array with offset to component in bound-phase (cumulative sum of nBound per particle type) per particle type in type-major ordering
+	 * @param [in,out] ptrs List the parameter instances are appended to
+	 * @return @c true if the parameter has been found, or @c false otherwise
+	 */
+	bool multiplexBndCompTypeSecParameterPointers(const ParameterId& pId, StringHash nameHash, MultiplexMode mode, std::vector<active>& data,
+		unsigned int nParType, unsigned int nComp, unsigned int const* strideBound, unsigned int const* nBound, unsigned int const* boundOffset, std::vector<active*>& ptrs);
+
 	/**
 	 * @brief Sets AD info of a multiplexed parameter that depends on particle type, component, bound state, and (optionally) section
 	 * @details Sets the AD direction and seed value of a parameter and multiplexes the info onto all parameter instances.
@@ -157,6 +157,15 @@ public:
 	 */
 	virtual bool dependsOnTime() const CADET_NOEXCEPT = 0;
 
+	/**
+	 * @brief Returns whether the Jacobian of the reaction fluxes is constant
+	 * @details The Jacobian is constant if all reaction rates are affine in the state and their
+	 *          coefficients neither depend on time nor on the position (e.g., via external
+	 *          functions). Unit operations may use this to reuse Jacobians and their factorizations.
+	 * @return @c true if the Jacobian is constant, otherwise @c false
+	 */
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT = 0;
+
 	/**
 	 * @brief Returns whether this dynamic reaction model requires workspace
 	 * @details The workspace may be required for evaluation of residual and
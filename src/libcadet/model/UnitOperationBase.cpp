@@ -163,6 +163,26 @@ bool UnitOperationBase::setParameter(const ParameterId& pId, bool value)
 	return false;
 }
 
+bool UnitOperationBase::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	if ((pId.unitOperation != _unitOpIdx) && (pId.unitOperation != UnitOpIndep))
+		return false;
+
+	paramMap_t::iterator paramHandle = _parameters.find(pId);
+	if (paramHandle != _parameters.end())
+	{
+		ptrs.push_back(paramHandle->second);
+		return true;
+	}
+
+	if (model::getParameterPointers(pId, _binding, _singleBinding, ptrs))
+		return true;
+	if (model::getParameterPointers(pId, _dynReaction, _singleDynReaction, ptrs))
+		return true;
+
+	return false;
+}
+
 void UnitOperationBase::setSensitiveParameterValue(const ParameterId& pId, double value)
 {
 	if ((pId.unitOperation != _unitOpIdx) && (pId.unitOperation != UnitOpIndep))
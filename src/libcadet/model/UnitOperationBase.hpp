@@ -57,12 +57,16 @@ public:
 	virtual bool setParameter(const ParameterId& pId, double value);
 	virtual bool setParameter(const ParameterId& pId, bool value);
 
+	virtual bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
+
 	virtual bool setSensitiveParameter(const ParameterId& pId, unsigned int adDirection, double adValue);
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual void clearSensParams();
 	virtual unsigned int numSensParams() const;
 
+	virtual bool adaptDiscretization(double t, unsigned int secIdx, const SimulationState& simState) { return false; }
+
 	virtual int residualSensFwdCombine(const SimulationTime& simTime, const ConstSimulationState& simState,
 		const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes,
 		double* const tmp1, double* const tmp2, double* const tmp3);
@@ -77,6 +77,7 @@ public:
 	virtual int const* reactionQuasiStationarity() const CADET_NOEXCEPT { return _reactionQuasistationarity.data(); }
 	virtual bool hasQuasiStationaryReactions() const CADET_NOEXCEPT { return _hasQuasiStationary; }
 	virtual bool hasDynamicReactions() const CADET_NOEXCEPT { return _hasDynamic; }
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT { return false; }
 
 	virtual bool preConsistentInitialState(double t, unsigned int secIdx, const ColumnPosition& colPos, double* y, double const* yCp, LinearBufferAllocator workSpace) const { return true; }
 	virtual void postConsistentInitialState(double t, unsigned int secIdx, const ColumnPosition& colPos, double* y, double const* yCp, LinearBufferAllocator workSpace) const { }
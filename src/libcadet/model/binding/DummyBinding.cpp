@@ -139,6 +139,7 @@ public:
 	virtual bool hasQuasiStationaryReactions() const CADET_NOEXCEPT { return false; }
 	virtual bool hasDynamicReactions() const CADET_NOEXCEPT { return true; }
 	virtual bool dependsOnTime() const CADET_NOEXCEPT { return false; }
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT { return true; }
 	virtual bool requiresWorkspace() const CADET_NOEXCEPT { return false; }
 	virtual bool implementsAnalyticJacobian() const CADET_NOEXCEPT { return true; }
 	virtual int const* reactionQuasiStationarity() const CADET_NOEXCEPT { return _stateQuasistationarity.data(); }
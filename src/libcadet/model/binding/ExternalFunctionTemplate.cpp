@@ -22,6 +22,7 @@
 #include "Memory.hpp"
 
 #include <tuple>
+#include <cmath>
 
 namespace cadet
 {
@@ -429,5 +430,137 @@ protected:
 {% endif %}
 };
 
+{% if exists("flux") %}
+/**
+ * @brief Flux and analytic Jacobian generated from the flux expression of {{ name }}
+ * @details Flux of bound component @c i: {{ flux/expr }}
+ *          Both functions expect a single bound state per binding component.
+ */
+struct {{ flux/name }}
+{
+	template <typename ResidualType, typename ParamType, typename ParamsHandle_t, typename StateType, typename CpStateType>
+	static inline void flux(const ParamsHandle_t& p, int nComp, unsigned int const* nBoundStates, StateType const* y, CpStateType const* yCp, ResidualType* res)
+	{
+		using std::exp;
+		using std::log;
+		using std::pow;
+		using std::sqrt;
+
+{% for s in flux/sums %}
+		ResidualType {{ s/name }} = 0.0;
+{% endfor %}
+{% if length(flux/sums) > 0 %}
+		int bndIdx2 = 0;
+		for (int j = 0; j < nComp; ++j)
+		{
+			if (nBoundStates[j] == 0)
+				continue;
+
+	{% for t in flux/sumTemps %}
+			const ResidualType {{ t/name }} = {{ t/expr }};
+	{% endfor %}
+	{% for s in flux/sums %}
+			{{ s/name }} += {{ s/value }};
+	{% endfor %}
+			++bndIdx2;
+		}
+{% endif %}
+
+		int bndIdx = 0;
+		for (int i = 0; i < nComp; ++i)
+		{
+			if (nBoundStates[i] == 0)
+				continue;
+
+{% for t in flux/resTemps %}
+			const ResidualType {{ t/name }} = {{ t/expr }};
+{% endfor %}
+			res[bndIdx] = {{ flux/residual }};
+			++bndIdx;
+		}
+	}
+
+	template <typename ParamsHandle_t, typename RowIterator>
+	static inline void jacobian(const ParamsHandle_t& p, int nComp, unsigned int const* nBoundStates, double const* y, double const* yCp, int offsetCp, RowIterator jac)
+	{
+		using std::exp;
+		using std::log;
+		using std::pow;
+		using std::sqrt;
+
+{% for s in flux/sums %}
+		double {{ s/name }} = 0.0;
+{% endfor %}
+{% if length(flux/sums) > 0 %}
+		{
+			int bndIdx2 = 0;
+			for (int j = 0; j < nComp; ++j)
+			{
+				if (nBoundStates[j] == 0)
+					continue;
+
+	{% for t in flux/jacSumTemps %}
+				const double {{ t/name }} = {{ t/expr }};
+	{% endfor %}
+	{% for s in flux/sums %}
+				{{ s/name }} += {{ s/jacValue }};
+	{% endfor %}
+				++bndIdx2;
+			}
+		}
+{% endif %}
+
+		int bndIdx = 0;
+		for (int i = 0; i < nComp; ++i)
+		{
+			if (nBoundStates[i] == 0)
+				continue;
+
+{% for t in flux/rowTemps %}
+			const double {{ t/name }} = {{ t/expr }};
+{% endfor %}
+{% if flux/hasCoupling %}
+	{% for s in flux/sums %}
+		{% if s/hasDFdS %}
+			const double dFd{{ s/name }} = {{ s/dFdS }};
+		{% endif %}
+	{% endfor %}
+
+			// Couplings via sums: jac[j - bndIdx - offsetCp] corresponds to c_{p,j}, jac[bndIdx2 - bndIdx] to q_j
+			int bndIdx2 = 0;
+			for (int j = 0; j < nComp; ++j)
+			{
+				if (nBoundStates[j] == 0)
+					continue;
+
+	{% for t in flux/colTemps %}
+				const double {{ t/name }} = {{ t/expr }};
+	{% endfor %}
+	{% if flux/hasDcSum %}
+				jac[j - bndIdx - offsetCp] = {{ flux/dcSum }};
+	{% endif %}
+	{% if flux/hasDqSum %}
+				jac[bndIdx2 - bndIdx] = {{ flux/dqSum }};
+	{% endif %}
+				++bndIdx2;
+			}
+{% endif %}
+
+{% if flux/hasDc %}
+			// dres_i / dc_{p,i}
+			jac[i - bndIdx - offsetCp] {{ flux/dcAssign }} {{ flux/dc }};
+{% endif %}
+{% if flux/hasDq %}
+			// dres_i / dq_i
+			jac[0] {{ flux/dqAssign }} {{ flux/dq }};
+{% endif %}
+
+			++bndIdx;
+			++jac;
+		}
+	}
+};
+{% endif %}
+
 } // namespace model
 } // namespace cadet
@@ -32,7 +32,13 @@
 			{ "type": "ScalarComponentDependentParameter", "varName": "kA", "confName": "MCL_KA"},
 			{ "type": "ScalarComponentDependentParameter", "varName": "kD", "confName": "MCL_KD"},
 			{ "type": "ScalarComponentDependentParameter", "varName": "qMax", "confName": "MCL_QMAX"}
-		]
+		],
+	"flux":
+		{
+			"name": "LangmuirFlux",
+			"sums": [ { "name": "qSum", "expr": "q / qMax" } ],
+			"expr": "kD * q - kA * c * qMax * (1 - qSum)"
+		}
 }
 </codegen>*/
 
@@ -157,34 +163,7 @@ protected:
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
 		// Protein fluxes: -k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) + k_{d,i} * q_i
-		ResidualType qSum = 1.0;
-		unsigned int bndIdx = 0;
-		for (int i = 0; i < _nComp; ++i)
-		{
-			// Skip components without bound states (bound state index bndIdx is not advanced)
-			if (_nBoundStates[i] == 0)
-				continue;
-
-			qSum -= y[bndIdx] / static_cast<ParamType>(p->qMax[i]);
-
-			// Next bound component
-			++bndIdx;
-		}
-
-		bndIdx = 0;
-		for (int i = 0; i < _nComp; ++i)
-		{
-			// Skip components without bound states (bound state index bndIdx is not advanced)
-			if (_nBoundStates[i] == 0)
-				continue;
-
-			// Residual
-			res[bndIdx] = static_cast<ParamType>(p->kD[i]) * y[bndIdx] - static_cast<ParamType>(p->kA[i]) * yCp[i] * static_cast<ParamType>(p->qMax[i]) * qSum;
-
-			// Next bound component
-			++bndIdx;
-		}
-
+		LangmuirFlux::flux<ResidualType, ParamType>(p, _nComp, _nBoundStates, y, yCp, res);
 		return 0;
 	}
 
@@ -193,59 +172,9 @@ protected:
 	{
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
-		// Protein fluxes: -k_{a,i} * c_{p,i} * q_{max,i} * (1 - \sum_j q_j / q_{max,j}) + k_{d,i} * q_i
-		double qSum = 1.0;
-		int bndIdx = 0;
-		for (int i = 0; i < _nComp; ++i)
-		{
-			// Skip components without bound states (bound state index bndIdx is not advanced)
-			if (_nBoundStates[i] == 0)
-				continue;
-
-			qSum -= y[bndIdx] / static_cast<double>(p->qMax[i]);
-
-			// Next bound component
-			++bndIdx;
-		}
-
-		bndIdx = 0;
-		for (int i = 0; i < _nComp; ++i)
-		{
-			// Skip components without bound states (bound state index bndIdx is not advanced)
-			if (_nBoundStates[i] == 0)
-				continue;
-
-			const double ka = static_cast<double>(p->kA[i]);
-			const double kd = static_cast<double>(p->kD[i]);
-
-			// dres_i / dc_{p,i}
-			jac[i - bndIdx - offsetCp] = -ka * static_cast<double>(p->qMax[i]) * qSum;
-			// Getting to c_{p,i}: -bndIdx takes us to q_0, another -offsetCp to c_{p,0} and a +i to c_{p,i}.
-			//                     This means jac[i - bndIdx - offsetCp] corresponds to c_{p,i}.
-
-			// Fill dres_i / dq_j
-			int bndIdx2 = 0;
-			for (int j = 0; j < _nComp; ++j)
-			{
-				// Skip components without bound states (bound state index bndIdx is not advanced)
-				if (_nBoundStates[j] == 0)
-					continue;
-
-				// dres_i / dq_j
-				jac[bndIdx2 - bndIdx] = ka * yCp[i] * static_cast<double>(p->qMax[i]) / static_cast<double>(p->qMax[j]);
-				// Getting to q_j: -bndIdx takes us to q_0, another +bndIdx2 to q_j. This means jac[bndIdx2 - bndIdx] corresponds to q_j.
-
-				++bndIdx2;
-			}
-
-			// Add to dres_i / dq_i
-			jac[0] += kd;
-
-			// Advance to next flux and Jacobian row
-			++bndIdx;
-			++jac;
-		}
-	}	
+		// Jacobian is derived symbolically from the flux expression at build time (see codegen block)
+		LangmuirFlux::jacobian(p, _nComp, _nBoundStates, y, yCp, offsetCp, jac);
+	}
 };
 
 typedef LangmuirBindingBase<LangmuirParamHandler> LangmuirBinding;
@@ -0,0 +1,81 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides interval search on time grids of external functions.
+ */
+
+#ifndef LIBCADET_EXTFUN_INTERVALLOOKUP_HPP_
+#define LIBCADET_EXTFUN_INTERVALLOOKUP_HPP_
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+
+namespace cadet
+{
+
+namespace model
+{
+
+/**
+ * @brief Finds the interval of a sorted grid that contains a given point
+ * @details Consecutive queries of external functions mostly hit the same or the
+ *          next interval (same time point at neighboring positions, or slowly
+ *          advancing time). The last found interval is remembered and checked
+ *          first, so that the binary search is only performed on a miss. The
+ *          hint is atomic since external functions are evaluated concurrently.
+ */
+class IntervalLookup
+{
+public:
+	IntervalLookup() : _hint(0) { }
+
+	/**
+	 * @brief Returns the index @c idx with @f$ g_{idx} \leq x < g_{idx+1} @f$
+	 * @details Assumes @f$ g_0 < x < g_{n-1} @f$.
+	 * @param [in] grid Strictly increasing grid @f$ g @f$
+	 * @param [in] x Point to locate
+	 * @return Index of the left interval boundary
+	 */
+	inline std::size_t find(const std::vector<double>& grid, double x)
+	{
+		const std::size_t hint = _hint.load(std::memory_order_relaxed);
+		if (hint + 1 < grid.size())
+		{
+			if ((grid[hint] <= x) && (x < grid[hint + 1]))
+				return hint;
+
+			// Try next interval
+			if ((hint + 2 < grid.size()) && (grid[hint + 1] <= x) && (x < grid[hint + 2]))
+			{
+				_hint.store(hint + 1, std::memory_order_relaxed);
+				return hint + 1;
+			}
+		}
+
+		const std::vector<double>::const_iterator it = std::lower_bound(grid.begin(), grid.end(), x);
+		const std::size_t idx = (it - grid.begin()) - (*it > x ? 1 : 0);
+		_hint.store(idx, std::memory_order_relaxed);
+		return idx;
+	}
+
+private:
+	std::atomic<std::size_t> _hint; //!< Index of the last found interval
+};
+
+} // namespace model
+
+} // namespace cadet
+
+#endif  // LIBCADET_EXTFUN_INTERVALLOOKUP_HPP_
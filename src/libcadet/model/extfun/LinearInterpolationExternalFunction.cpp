@@ -18,6 +18,7 @@
 #include "cadet/ExternalFunction.hpp"
 #include "cadet/ParameterProvider.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "model/extfun/IntervalLookup.hpp"
 
 #include <vector>
 #include <functional>
@@ -110,8 +111,7 @@ public:
 		// In the middle use linear interpolation
 
 		// Find the the interval [_time[idx], _time[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_time.begin(), _time.end(), transT);
-		const std::size_t idx = (it - _time.begin()) - (*it > transT ? 1 : 0);
+		const std::size_t idx = _interval.find(_time, transT);
 
 		// Now idx is the index of the left and idx + 1 is the index of the right data point
 		// Perform linear interpolation
@@ -132,8 +132,7 @@ public:
 		// In the middle use linear interpolation
 
 		// Find the the interval [_time[idx], _time[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_time.begin(), _time.end(), transT);
-		const std::size_t idx = (it - _time.begin()) - (*it > transT ? 1 : 0);
+		const std::size_t idx = _interval.find(_time, transT);
 
 		// Now idx is the index of the left and idx + 1 is the index of the right data point
 		// Return slope of linear interpolation
@@ -144,6 +143,7 @@ private:
 	double _velocity; //!< Velocity of the movement of the external profile in [1/s] (normalized by column length)
 	std::vector<double> _dataY; //!< External profile data points (function values)
 	std::vector<double> _time; //!< Time point of each measurement in [s]
+	IntervalLookup _interval; //!< Cached interval search in time points
 };
 
 namespace extfun
@@ -18,6 +18,7 @@
 #include "cadet/ExternalFunction.hpp"
 #include "cadet/ParameterProvider.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "model/extfun/IntervalLookup.hpp"
 
 #include <vector>
 #include <unordered_map>
@@ -91,8 +92,7 @@ public:
 		}
 
 		// Find the the interval [_sectionTimes[idx], _sectionTimes[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_sectionTimes.begin(), _sectionTimes.end(), transT);
-		const std::size_t idx = (it - _sectionTimes.begin()) - (*it > transT ? 1 : 0);
+		const std::size_t idx = _interval.find(_sectionTimes, transT);
 
 		// This function evaluates a piecewise cubic polynomial given on some intervals
 		// called sections. On each section a polynomial of degree 3 is evaluated:
@@ -119,8 +119,7 @@ public:
 			return 0.0;
 
 		// Find the the interval [_sectionTimes[idx], _sectionTimes[idx+1]] in which transT is located
-		const std::vector<double>::iterator it = std::lower_bound(_sectionTimes.begin(), _sectionTimes.end(), transT);
-		const std::size_t idx = (it - _sectionTimes.begin()) - (*it > transT ? 1 : 0);
+		const std::size_t idx = _interval.find(_sectionTimes, transT);
 
 		// This function evaluates a piecewise cubic polynomial given on some intervals
 		// called sections. On each section a polynomial of degree 3 is evaluated:
@@ -146,6 +145,7 @@ private:
 	std::vector<double> _lin; //!< Linear coefficient of each polynomial piece
 	std::vector<double> _quad; //!< Quadratic coefficient of each polynomial piece
 	std::vector<double> _cub; //!< Cubic coefficient of each polynomial piece
+	IntervalLookup _interval; //!< Cached interval search in section times
 };
 
 namespace extfun
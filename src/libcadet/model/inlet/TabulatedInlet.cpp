@@ -0,0 +1,300 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides an inlet profile that interpolates tabulated data.
+ */
+
+#include "cadet/InletProfile.hpp"
+#include "cadet/ParameterProvider.hpp"
+#include "cadet/Exceptions.hpp"
+#include "common/CompilerSpecific.hpp"
+#include "model/extfun/IntervalLookup.hpp"
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <string>
+#include <cmath>
+
+namespace cadet
+{
+
+namespace model
+{
+
+/**
+ * @brief An inlet profile that interpolates a time series of concentrations
+ * @details The concentrations of all components are given at arbitrary time points.
+ *          They are interpolated either linearly or by a monotone piecewise cubic
+ *          Hermite polynomial (Fritsch-Carlson), which does not overshoot the data.
+ *          Outside of the time series, the first and last data point are extrapolated
+ *          constantly.
+ *
+ *          In contrast to PiecewiseCubicPolyInlet, the profile does not depend on the
+ *          sections of the simulator. Hence, a measured profile with many data points
+ *          can be used within a single section (or continuous section transitions)
+ *          without restarting the time integrator at each data point.
+ *
+ *          On each interval, the interpolant is converted to the coefficients of a
+ *          cubic polynomial once during configuration, so evaluation only requires
+ *          the interval search and Horner's scheme.
+ */
+class TabulatedInlet : public cadet::IInletProfile
+{
+public:
+	TabulatedInlet() : _nComp(0) { }
+
+	virtual ~TabulatedInlet() CADET_NOEXCEPT { }
+
+	static const char* identifier() { return "TABULATED"; }
+	virtual const char* name() const CADET_NOEXCEPT { return TabulatedInlet::identifier(); }
+
+	virtual std::vector<cadet::ParameterId> availableParameters(unsigned int unitOpIdx) CADET_NOEXCEPT
+	{
+		// Tabulated data is not exposed as parameters
+		return std::vector<cadet::ParameterId>();
+	}
+
+	virtual void inletConcentration(double t, unsigned int sec, double* inletConc)
+	{
+		// Use constant extrapolation on both sides of the time series
+		if (t <= _time.front())
+		{
+			std::copy_n(_data.begin(), _nComp, inletConc);
+			return;
+		}
+		else if (t >= _time.back())
+		{
+			std::copy_n(_data.end() - _nComp, _nComp, inletConc);
+			return;
+		}
+
+		const std::size_t idx = _interval.find(_time, t);
+		const double tShift = t - _time[idx];
+
+		double const* const con = _data.data() + idx * _nComp;
+		double const* const lin = _lin.data() + idx * _nComp;
+		double const* const quad = _quad.data() + idx * _nComp;
+		double const* const cub = _cub.data() + idx * _nComp;
+
+		// Evaluate polynomial using Horner's scheme
+		for (unsigned int comp = 0; comp < _nComp; ++comp)
+			inletConc[comp] = con[comp] + tShift * (lin[comp] + tShift * (quad[comp] + tShift * cub[comp]));
+	}
+
+	virtual void parameterDerivative(double t, unsigned int sec, const cadet::ParameterId& pId, double* paramDeriv)
+	{
+		std::fill(paramDeriv, paramDeriv + _nComp, 0.0);
+	}
+
+	virtual void timeDerivative(double t, unsigned int sec, double* timeDerivative)
+	{
+		// Constant extrapolation => slope is 0.0
+		if ((t <= _time.front()) || (t >= _time.back()))
+		{
+			std::fill(timeDerivative, timeDerivative + _nComp, 0.0);
+			return;
+		}
+
+		const std::size_t idx = _interval.find(_time, t);
+		const double tShift = t - _time[idx];
+
+		double const* const lin = _lin.data() + idx * _nComp;
+		double const* const quad = _quad.data() + idx * _nComp;
+		double const* const cub = _cub.data() + idx * _nComp;
+
+		for (unsigned int comp = 0; comp < _nComp; ++comp)
+			timeDerivative[comp] = lin[comp] + tShift * (2.0 * quad[comp] + tShift * 3.0 * cub[comp]);
+	}
+
+	virtual void timeParameterDerivative(double t, unsigned int sec, const ParameterId& pId, double* deriv)
+	{
+		std::fill(deriv, deriv + _nComp, 0.0);
+	}
+
+	virtual void setParameterValue(const cadet::ParameterId& pId, double value) { }
+
+	virtual double getParameterValue(const cadet::ParameterId& pId)
+	{
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+
+	virtual void numComponents(unsigned int nComp) CADET_NOEXCEPT { _nComp = nComp; }
+
+	virtual void setSectionTimes(double const* secTimes, bool const* secContinuity, unsigned int nSections) CADET_NOEXCEPT { }
+
+	virtual bool configure(IParameterProvider* paramProvider, unsigned int nComp)
+	{
+		_nComp = nComp;
+
+		if (!paramProvider)
+			return false;
+
+		_time = paramProvider->getDoubleArray("TIME");
+		_data = paramProvider->getDoubleArray("DATA");
+
+		if (_time.empty())
+			throw InvalidParameterException("Field TIME has to contain at least one element");
+
+		if (_data.size() != _time.size() * nComp)
+			throw InvalidParameterException("Field DATA has to contain NCOMP * size(TIME) elements (expected " + std::to_string(_time.size() * nComp) + ", got " + std::to_string(_data.size()) + ")");
+
+		for (std::size_t i = 1; i < _time.size(); ++i)
+		{
+			if (_time[i] <= _time[i-1])
+				throw InvalidParameterException("Field TIME has to be strictly increasing");
+		}
+
+		bool monotoneCubic = true;
+		if (paramProvider->exists("INTERPOLATION"))
+		{
+			const std::string method = paramProvider->getString("INTERPOLATION");
+			if (method == "LINEAR")
+				monotoneCubic = false;
+			else if (method != "MONOTONE_CUBIC")
+				throw InvalidParameterException("Unknown interpolation method " + method + " in field INTERPOLATION");
+		}
+
+		const std::size_t nIntervals = _time.size() - 1;
+		_lin.assign(nIntervals * nComp, 0.0);
+		_quad.assign(nIntervals * nComp, 0.0);
+		_cub.assign(nIntervals * nComp, 0.0);
+
+		if (monotoneCubic)
+			computeMonotoneCubicCoefficients();
+		else
+			computeLinearCoefficients();
+
+		return true;
+	}
+
+private:
+
+	/**
+	 * @brief Returns the slope of the data of a component on a given interval
+	 * @param [in] idx Index of the interval
+	 * @param [in] comp Index of the component
+	 * @return Slope of the secant
+	 */
+	inline double secant(std::size_t idx, unsigned int comp) const CADET_NOEXCEPT
+	{
+		return (_data[(idx + 1) * _nComp + comp] - _data[idx * _nComp + comp]) / (_time[idx + 1] - _time[idx]);
+	}
+
+	void computeLinearCoefficients()
+	{
+		for (std::size_t i = 0; i + 1 < _time.size(); ++i)
+		{
+			for (unsigned int comp = 0; comp < _nComp; ++comp)
+				_lin[i * _nComp + comp] = secant(i, comp);
+		}
+	}
+
+	void computeMonotoneCubicCoefficients()
+	{
+		const std::size_t nPoints = _time.size();
+		if (nPoints < 2)
+			return;
+
+		std::vector<double> slopes(nPoints);
+		for (unsigned int comp = 0; comp < _nComp; ++comp)
+		{
+			// Compute slopes at the data points
+			if (nPoints == 2)
+			{
+				slopes[0] = secant(0, comp);
+				slopes[1] = slopes[0];
+			}
+			else
+			{
+				// Weighted harmonic mean of the adjacent secants in the interior,
+				// zero slope at local extrema
+				for (std::size_t i = 1; i + 1 < nPoints; ++i)
+				{
+					const double hL = _time[i] - _time[i-1];
+					const double hR = _time[i+1] - _time[i];
+					const double dL = secant(i - 1, comp);
+					const double dR = secant(i, comp);
+
+					if (dL * dR <= 0.0)
+					{
+						slopes[i] = 0.0;
+						continue;
+					}
+
+					const double wL = 2.0 * hR + hL;
+					const double wR = hR + 2.0 * hL;
+					slopes[i] = (wL + wR) / (wL / dL + wR / dR);
+				}
+
+				slopes[0] = endpointSlope(_time[1] - _time[0], _time[2] - _time[1], secant(0, comp), secant(1, comp));
+				slopes[nPoints - 1] = endpointSlope(_time[nPoints - 1] - _time[nPoints - 2], _time[nPoints - 2] - _time[nPoints - 3], secant(nPoints - 2, comp), secant(nPoints - 3, comp));
+			}
+
+			// Convert Hermite form to polynomial coefficients
+			for (std::size_t i = 0; i + 1 < nPoints; ++i)
+			{
+				const double h = _time[i+1] - _time[i];
+				const double delta = secant(i, comp);
+
+				_lin[i * _nComp + comp] = slopes[i];
+				_quad[i * _nComp + comp] = (3.0 * delta - 2.0 * slopes[i] - slopes[i+1]) / h;
+				_cub[i * _nComp + comp] = (slopes[i] + slopes[i+1] - 2.0 * delta) / (h * h);
+			}
+		}
+	}
+
+	/**
+	 * @brief Computes a shape preserving slope at the end of the time series
+	 * @details Uses a one-sided three-point formula that is limited such that the interpolant remains monotone.
+	 * @param [in] h0 Length of the interval at the end point
+	 * @param [in] h1 Length of the adjacent interval
+	 * @param [in] d0 Secant on the interval at the end point
+	 * @param [in] d1 Secant on the adjacent interval
+	 * @return Slope at the end point
+	 */
+	static double endpointSlope(double h0, double h1, double d0, double d1)
+	{
+		const double slope = ((2.0 * h0 + h1) * d0 - h0 * d1) / (h0 + h1);
+		if (slope * d0 <= 0.0)
+			return 0.0;
+
+		if ((d0 * d1 <= 0.0) && (std::abs(slope) > std::abs(3.0 * d0)))
+			return 3.0 * d0;
+
+		return slope;
+	}
+
+	unsigned int _nComp; //!< Number of components
+
+	std::vector<double> _time; //!< Time points of the data in [s]
+	std::vector<double> _data; //!< Concentrations at the time points in time-major ordering, also constant coefficients of the polynomials
+	std::vector<double> _lin; //!< Linear coefficients of the polynomial on each interval
+	std::vector<double> _quad; //!< Quadratic coefficients of the polynomial on each interval
+	std::vector<double> _cub; //!< Cubic coefficients of the polynomial on each interval
+	IntervalLookup _interval; //!< Cached interval search in time points
+};
+
+namespace inlet
+{
+	void registerTabulated(std::unordered_map<std::string, std::function<IInletProfile*()>>& inlets)
+	{
+		inlets[TabulatedInlet::identifier()] = []() { return new TabulatedInlet(); };
+	}
+} // namespace inlet
+
+} // namespace model
+} // namespace cadet
@@ -52,16 +52,47 @@ struct FlowParameters
 	unsigned int nCol;
 	unsigned int offsetToInlet; //!< Offset to the first component of the inlet DOFs in the local state vector
 	unsigned int offsetToBulk; //!< Offset to the first component of the first bulk cell in the local state vector
+	double const* cellWidthFactor; //!< Width of each cell relative to @c h (non-uniform grid), @c nullptr for a uniform grid
 };
 
 
 namespace impl
 {
+	/**
+	 * @brief Returns the width of the given cell
+	 * @param [in] p Flow parameters
+	 * @param [in] col Index of the cell
+	 * @return Width of the cell
+	 */
+	template <typename ParamType>
+	inline ParamType cellWidth(const FlowParameters<ParamType>& p, unsigned int col)
+	{
+		if (p.cellWidthFactor)
+			return p.h * p.cellWidthFactor[col];
+		return p.h;
+	}
+
+	/**
+	 * @brief Returns the factor of the dispersive flux between two neighboring cells
+	 * @details The flux over the common face is divided by the distance of the cell centers
+	 *          and by the width of the cell @p col. On a uniform grid, this reduces to @f$ D_{\text{ax}} / h^2 @f$.
+	 * @param [in] p Flow parameters
+	 * @param [in] d_ax Axial dispersion coefficient
+	 * @param [in] hCell Width of the cell @p col
+	 * @param [in] nb Index of the neighboring cell
+	 * @return Factor of the dispersive flux
+	 */
+	template <typename ParamType>
+	inline ParamType dispersionFactor(const FlowParameters<ParamType>& p, const ParamType& d_ax, const ParamType& hCell, unsigned int nb)
+	{
+		if (p.cellWidthFactor)
+			return d_ax / (hCell * 0.5 * (hCell + cellWidth(p, nb)));
+		return d_ax / (hCell * hCell);
+	}
+
 	template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
 	int residualForwardsFlow(const SimulationTime& simTime, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin, const FlowParameters<ParamType>& p)
 	{
-		const ParamType h2 = p.h * p.h;
-
 		// The stencil caches parts of the state vector for better spatial coherence
 		typedef CachingStencil<StateType, ArrayPool> StencilType;
 		StencilType stencil(std::max(p.weno->stencilSize(), 3u), *p.stencilMemory, std::max(p.weno->order() - 1, 1));
@@ -116,27 +147,31 @@ namespace impl
 			{
 				// ------------------- Dispersion -------------------
 
+				const ParamType hCell = cellWidth(p, col);
+
 				// Right side, leave out if we're in the last cell (boundary condition)
 				if (cadet_likely(col < p.nCol - 1))
 				{
-					resBulkComp[col * p.strideCell] -= d_ax / h2 * (stencil[1] - stencil[0]);
+					const ParamType dispFactor = dispersionFactor(p, d_ax, hCell, col + 1);
+					resBulkComp[col * p.strideCell] -= dispFactor * (stencil[1] - stencil[0]);
 					// Jacobian entries
 					if (wantJac)
 					{
-						jac[0] += static_cast<double>(d_ax) / static_cast<double>(h2);
-						jac[p.strideCell] -= static_cast<double>(d_ax) / static_cast<double>(h2);
+						jac[0] += static_cast<double>(dispFactor);
+						jac[p.strideCell] -= static_cast<double>(dispFactor);
 					}
 				}
 
 				// Left side, leave out if we're in the first cell (boundary condition)
 				if (cadet_likely(col > 0))
 				{
-					resBulkComp[col * p.strideCell] -= d_ax / h2 * (stencil[-1] - stencil[0]);
+					const ParamType dispFactor = dispersionFactor(p, d_ax, hCell, col - 1);
+					resBulkComp[col * p.strideCell] -= dispFactor * (stencil[-1] - stencil[0]);
 					// Jacobian entries
 					if (wantJac)
 					{
-						jac[0] += static_cast<double>(d_ax) / static_cast<double>(h2);
-						jac[-p.strideCell] -= static_cast<double>(d_ax) / static_cast<double>(h2);
+						jac[0] += static_cast<double>(dispFactor);
+						jac[-p.strideCell] -= static_cast<double>(dispFactor);
 					}
 				}
 
@@ -147,7 +182,7 @@ namespace impl
 				{
 					// Remember that vm still contains the reconstructed value of the previous 
 					// cell's *right* face, which is identical to this cell's *left* face!
-					resBulkComp[col * p.strideCell] -= p.u / p.h * vm;
+					resBulkComp[col * p.strideCell] -= p.u / hCell * vm;
 
 					// Jacobian entries
 					if (wantJac)
@@ -155,13 +190,13 @@ namespace impl
 						for (int i = 0; i < 2 * wenoOrder - 1; ++i)
 							// Note that we have an offset of -1 here (compared to the right cell face below), since
 							// the reconstructed value depends on the previous stencil (which has now been moved by one cell)
-							jac[(i - wenoOrder) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];
+							jac[(i - wenoOrder) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(hCell) * p.wenoDerivatives[i];
 					}
 				}
 				else
 				{
 					// In the first cell we need to apply the boundary condition: inflow concentration
-					resBulkComp[col * p.strideCell] -= p.u / p.h * y[p.offsetToInlet + comp];
+					resBulkComp[col * p.strideCell] -= p.u / hCell * y[p.offsetToInlet + comp];
 				}
 
 				// Reconstruct concentration on this cell's right face
@@ -171,12 +206,12 @@ namespace impl
 					wenoOrder = p.weno->template reconstruct<StateType, StencilType>(p.wenoEpsilon, col, p.nCol, stencil, vm);
 
 				// Right side
-				resBulkComp[col * p.strideCell] += p.u / p.h * vm;
+				resBulkComp[col * p.strideCell] += p.u / hCell * vm;
 				// Jacobian entries
 				if (wantJac)
 				{
 					for (int i = 0; i < 2 * wenoOrder - 1; ++i)
-						jac[(i - wenoOrder + 1) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];
+						jac[(i - wenoOrder + 1) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(hCell) * p.wenoDerivatives[i];
 				}
 
 				// Update stencil
@@ -202,8 +237,6 @@ namespace impl
 	template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
 	int residualBackwardsFlow(const SimulationTime& simTime, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin, const FlowParameters<ParamType>& p)
 	{
-		const ParamType h2 = p.h * p.h;
-
 		// The stencil caches parts of the state vector for better spatial coherence
 		typedef CachingStencil<StateType, ArrayPool> StencilType;
 		StencilType stencil(std::max(p.weno->stencilSize(), 3u), *p.stencilMemory, std::max(p.weno->order() - 1, 1));
@@ -259,27 +292,31 @@ namespace impl
 			{
 				// ------------------- Dispersion -------------------
 
+				const ParamType hCell = cellWidth(p, col);
+
 				// Right side, leave out if we're in the first cell (boundary condition)
 				if (cadet_likely(col < p.nCol - 1))
 				{
-					resBulkComp[col * p.strideCell] -= d_ax / h2 * (stencil[-1] - stencil[0]);
+					const ParamType dispFactor = dispersionFactor(p, d_ax, hCell, col + 1);
+					resBulkComp[col * p.strideCell] -= dispFactor * (stencil[-1] - stencil[0]);
 					// Jacobian entries
 					if (wantJac)
 					{
-						jac[0] += static_cast<double>(d_ax) / static_cast<double>(h2);
-						jac[p.strideCell] -= static_cast<double>(d_ax) / static_cast<double>(h2);
+						jac[0] += static_cast<double>(dispFactor);
+						jac[p.strideCell] -= static_cast<double>(dispFactor);
 					}
 				}
 
 				// Left side, leave out if we're in the last cell (boundary condition)
 				if (cadet_likely(col > 0))
 				{
-					resBulkComp[col * p.strideCell] -= d_ax / h2 * (stencil[1] - stencil[0]);
+					const ParamType dispFactor = dispersionFactor(p, d_ax, hCell, col - 1);
+					resBulkComp[col * p.strideCell] -= dispFactor * (stencil[1] - stencil[0]);
 					// Jacobian entries
 					if (wantJac)
 					{
-						jac[0] += static_cast<double>(d_ax) / static_cast<double>(h2);
-						jac[-p.strideCell] -= static_cast<double>(d_ax) / static_cast<double>(h2);
+						jac[0] += static_cast<double>(dispFactor);
+						jac[-p.strideCell] -= static_cast<double>(dispFactor);
 					}
 				}
 
@@ -290,7 +327,7 @@ namespace impl
 				{
 					// Remember that vm still contains the reconstructed value of the previous 
 					// cell's *left* face, which is identical to this cell's *right* face!
-					resBulkComp[col * p.strideCell] += p.u / p.h * vm;
+					resBulkComp[col * p.strideCell] += p.u / hCell * vm;
 
 					// Jacobian entries
 					if (wantJac)
@@ -298,13 +335,13 @@ namespace impl
 						for (int i = 0; i < 2 * wenoOrder - 1; ++i)
 							// Note that we have an offset of +1 here (compared to the left cell face below), since
 							// the reconstructed value depends on the previous stencil (which has now been moved by one cell)
-							jac[(wenoOrder - i) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];					
+							jac[(wenoOrder - i) * p.strideCell] += static_cast<double>(p.u) / static_cast<double>(hCell) * p.wenoDerivatives[i];					
 					}
 				}
 				else
 				{
 					// In the last cell (z = L) we need to apply the boundary condition: inflow concentration
-					resBulkComp[col * p.strideCell] += p.u / p.h * y[p.offsetToInlet + comp];
+					resBulkComp[col * p.strideCell] += p.u / hCell * y[p.offsetToInlet + comp];
 				}
 
 				// Reconstruct concentration on this cell's left face
@@ -314,12 +351,12 @@ namespace impl
 					wenoOrder = p.weno->template reconstruct<StateType, StencilType>(p.wenoEpsilon, col, p.nCol, stencil, vm);
 
 				// Left face
-				resBulkComp[col * p.strideCell] -= p.u / p.h * vm;
+				resBulkComp[col * p.strideCell] -= p.u / hCell * vm;
 				// Jacobian entries
 				if (wantJac)
 				{
 					for (int i = 0; i < 2 * wenoOrder - 1; ++i)
-						jac[(wenoOrder - i - 1) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(p.h) * p.wenoDerivatives[i];				
+						jac[(wenoOrder - i - 1) * p.strideCell] -= static_cast<double>(p.u) / static_cast<double>(hCell) * p.wenoDerivatives[i];				
 				}
 
 				// Update stencil (be careful because of wrap-around, might cause reading memory very far away [although never used])
@@ -19,11 +19,13 @@
 #include "SimulationTypes.hpp"
 #include "model/parts/ConvectionDispersionKernel.hpp"
 #include "SensParamUtil.hpp"
+#include "SpectralElement.hpp"
 
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 namespace cadet
 {
@@ -38,7 +40,8 @@ namespace parts
  * @brief Creates a ConvectionDispersionOperatorBase
  */
 ConvectionDispersionOperatorBase::ConvectionDispersionOperatorBase() : _stencilMemory(sizeof(active) * Weno::maxStencilSize()), 
-	_wenoDerivatives(new double[Weno::maxStencilSize()]), _weno()
+	_wenoDerivatives(new double[Weno::maxStencilSize()]), _weno(), _dgPolyDeg(0), _dgNelem(0), _dgInletFactor(0.0),
+	_adaptThreshold(0.0), _adaptMaxRefinement(1.0), _gridChanged(false)
 {
 }
 
@@ -63,18 +66,226 @@ bool ConvectionDispersionOperatorBase::configureModelDiscretization(IParameterPr
 
 	paramProvider.pushScope("discretization");
 
-	// Read WENO settings and apply them
-	paramProvider.pushScope("weno");
-	_weno.order(paramProvider.getInt("WENO_ORDER"));
-	_weno.boundaryTreatment(paramProvider.getInt("BOUNDARY_MODEL"));
-	_wenoEpsilon = paramProvider.getDouble("WENO_EPS");
-	paramProvider.popScope();
+	_dgPolyDeg = 0;
+	_dgNelem = 0;
+	_cellWidthFactor.clear();
+	_prevCellWidthFactor.clear();
+	_cellCenter.clear();
+	_gridChanged = false;
+
+	const bool adaptive = paramProvider.exists("ADAPTIVE_AXIAL_GRID") && paramProvider.getBool("ADAPTIVE_AXIAL_GRID");
+	if (paramProvider.exists("AXIAL_DISC_TYPE") && (paramProvider.getString("AXIAL_DISC_TYPE") == "DG"))
+	{
+		if (adaptive)
+			throw InvalidParameterException("Adaptive axial grid (ADAPTIVE_AXIAL_GRID) is only supported by the FV axial discretization");
+
+		_dgPolyDeg = paramProvider.getInt("POLYDEG");
+		_dgNelem = paramProvider.getInt("NELEM");
+
+		if (_dgNelem * (_dgPolyDeg + 1) != _nCol)
+			throw InvalidParameterException("Number of axial DG nodes (NELEM * (POLYDEG + 1)) inconsistent with number of axial points");
+
+		assembleDGOperators();
+	}
+	else
+	{
+		// Read WENO settings and apply them
+		paramProvider.pushScope("weno");
+		_weno.order(paramProvider.getInt("WENO_ORDER"));
+		_weno.boundaryTreatment(paramProvider.getInt("BOUNDARY_MODEL"));
+		_wenoEpsilon = paramProvider.getDouble("WENO_EPS");
+		paramProvider.popScope();
+
+		if (adaptive)
+		{
+			_adaptThreshold = 0.05;
+			if (paramProvider.exists("ADAPTIVE_FRONT_THRESHOLD"))
+				_adaptThreshold = paramProvider.getDouble("ADAPTIVE_FRONT_THRESHOLD");
+
+			_adaptMaxRefinement = 10.0;
+			if (paramProvider.exists("ADAPTIVE_MAX_REFINEMENT"))
+				_adaptMaxRefinement = paramProvider.getDouble("ADAPTIVE_MAX_REFINEMENT");
+
+			if (_adaptThreshold < 0.0)
+				throw InvalidParameterException("Field ADAPTIVE_FRONT_THRESHOLD has to be non-negative");
+			if (_adaptMaxRefinement < 1.0)
+				throw InvalidParameterException("Field ADAPTIVE_MAX_REFINEMENT has to be at least 1");
+
+			// Start with a uniform grid
+			_cellWidthFactor.assign(_nCol, 1.0);
+			_cellCenter.resize(_nCol);
+			for (unsigned int i = 0; i < _nCol; ++i)
+				_cellCenter[i] = (0.5 + static_cast<double>(i)) / static_cast<double>(_nCol);
+		}
+	}
 
 	paramProvider.popScope();
 
 	return true;
 }
 
+/**
+ * @brief Reads the number of axial points of the selected discretization
+ * @details The number of axial points is the number of cells (FV) or the number of
+ *          nodes (DG, @f$ N_e (N+1) @f$ for @f$ N_e @f$ elements of degree @f$ N @f$).
+ *          Assumes that the discretization scope of the unit operation is active.
+ * @param [in] paramProvider Parameter provider for reading parameters
+ * @return Number of axial points
+ */
+unsigned int ConvectionDispersionOperatorBase::readNumAxialPoints(IParameterProvider& paramProvider)
+{
+	if (!paramProvider.exists("AXIAL_DISC_TYPE"))
+		return paramProvider.getInt("NCOL");
+
+	const std::string discType = paramProvider.getString("AXIAL_DISC_TYPE");
+	if (discType == "FV")
+		return paramProvider.getInt("NCOL");
+	else if (discType != "DG")
+		throw InvalidParameterException("Unknown axial discretization type " + discType + " in field AXIAL_DISC_TYPE");
+
+	const int polyDeg = paramProvider.getInt("POLYDEG");
+	const int nElem = paramProvider.getInt("NELEM");
+	if (polyDeg < 1)
+		throw InvalidParameterException("Field POLYDEG has to be positive");
+	if (nElem < 1)
+		throw InvalidParameterException("Field NELEM has to be positive");
+
+	return static_cast<unsigned int>(nElem * (polyDeg + 1));
+}
+
+/**
+ * @brief Assembles the DG operators on a column of unit length
+ * @details The nodal DG spectral element method in strong form with collocated Legendre-Gauss-Lobatto
+ *          quadrature (diagonal mass matrix) is used. The dispersion term is treated by an auxiliary
+ *          variable @f$ g = \partial_z c @f$ with central interface values (Bassi-Rebay). Convection
+ *          uses upwind fluxes. The Danckwerts boundary conditions prescribe the total flux
+ *          @f$ u c_{\text{in}} @f$ at the inlet and a vanishing dispersive flux at the outlet.
+ *
+ *          The semi-discrete equations read
+ *          @f[ \dot{c} + \frac{u}{L} A_{\text{conv}} c - \frac{D_{\text{ax}}}{L^2} A_{\text{disp}} c - \frac{u}{L} \beta c_{\text{in}} e_0 = 0, @f]
+ *          where @f$ A_{\text{conv}} @f$ and @f$ A_{\text{disp}} @f$ only depend on the mesh topology. The residual of
+ *          a node of element @f$ k @f$ depends on the nodes of elements @f$ k-1 @f$, @f$ k @f$, and @f$ k+1 @f$. Hence,
+ *          the operators are stored row-wise in a band of @f$ 3(N+1) @f$ entries that starts at the first node
+ *          of element @f$ k-1 @f$. They are obtained by applying the scheme to all unit vectors.
+ */
+void ConvectionDispersionOperatorBase::assembleDGOperators()
+{
+	const unsigned int nNode = _dgPolyDeg + 1;
+	const unsigned int width = 3 * nNode;
+
+	std::vector<double> weights;
+	std::vector<double> D;
+	spectral::lglNodesAndWeights(_dgPolyDeg, _dgNodes, weights);
+	spectral::lglDerivativeMatrix(_dgNodes, D);
+
+	// Metric of the mapping from reference element to an element of the unit column
+	const double J = 2.0 * static_cast<double>(_dgNelem);
+	const double liftL = J / weights[0];
+	const double liftR = J / weights[_dgPolyDeg];
+	_dgInletFactor = liftL;
+
+	_dgConv.assign(_nCol * width, 0.0);
+	_dgDisp.assign(_nCol * width, 0.0);
+
+	std::vector<double> c(_nCol, 0.0);
+	std::vector<double> g(_nCol, 0.0);
+	std::vector<double> conv(_nCol, 0.0);
+	std::vector<double> disp(_nCol, 0.0);
+
+	// Applies the derivative matrix in each element
+	const auto derivative = [&](const std::vector<double>& in, std::vector<double>& out)
+	{
+		for (unsigned int e = 0; e < _dgNelem; ++e)
+		{
+			for (unsigned int i = 0; i < nNode; ++i)
+			{
+				double sum = 0.0;
+				for (unsigned int j = 0; j < nNode; ++j)
+					sum += D[i * nNode + j] * in[e * nNode + j];
+				out[e * nNode + i] = J * sum;
+			}
+		}
+	};
+
+	for (unsigned int col = 0; col < _nCol; ++col)
+	{
+		std::fill(c.begin(), c.end(), 0.0);
+		c[col] = 1.0;
+
+		// Auxiliary variable with central interface values, no jumps on the column boundaries
+		derivative(c, g);
+		for (unsigned int e = 1; e < _dgNelem; ++e)
+		{
+			const unsigned int left = e * nNode - 1;
+			const unsigned int right = e * nNode;
+			const double cStar = 0.5 * (c[left] + c[right]);
+			g[left] += liftR * (cStar - c[left]);
+			g[right] -= liftL * (cStar - c[right]);
+		}
+
+		derivative(c, conv);
+		derivative(g, disp);
+		for (unsigned int e = 0; e < _dgNelem; ++e)
+		{
+			const unsigned int first = e * nNode;
+			const unsigned int last = first + _dgPolyDeg;
+
+			// Convection: upwind flux, the inlet flux is added in the residual
+			const double convStarL = (e > 0) ? c[first - 1] : 0.0;
+			conv[first] -= liftL * (convStarL - c[first]);
+
+			// Dispersion: central flux, vanishes on the column boundaries
+			const double dispStarL = (e > 0) ? 0.5 * (g[first - 1] + g[first]) : 0.0;
+			const double dispStarR = (e + 1 < _dgNelem) ? 0.5 * (g[last] + g[last + 1]) : 0.0;
+			disp[first] -= liftL * (dispStarL - g[first]);
+			disp[last] += liftR * (dispStarR - g[last]);
+		}
+
+		// Scatter column into band storage
+		for (unsigned int row = 0; row < _nCol; ++row)
+		{
+			const int k = static_cast<int>(col) - (static_cast<int>(row / nNode) - 1) * static_cast<int>(nNode);
+			if ((k < 0) || (k >= static_cast<int>(width)))
+				continue;
+
+			_dgConv[row * width + k] = conv[row];
+			_dgDisp[row * width + k] = disp[row];
+		}
+	}
+}
+
+/**
+ * @brief Returns the relative axial position of an axial point
+ * @param [in] col Index of the axial cell (FV) or node (DG)
+ * @return Axial position in @f$ [0, 1] @f$
+ */
+double ConvectionDispersionOperatorBase::relativeCoordinate(unsigned int col) const CADET_NOEXCEPT
+{
+	if (isAdaptive())
+		return _cellCenter[col];
+	if (!isDG())
+		return (0.5 + static_cast<double>(col)) / static_cast<double>(_nCol);
+
+	const unsigned int nNode = _dgPolyDeg + 1;
+	return (static_cast<double>(col / nNode) + 0.5 * (1.0 + _dgNodes[col % nNode])) / static_cast<double>(_dgNelem);
+}
+
+/**
+ * @brief Returns the derivative of the residual of the first axial point with respect to the inlet concentration
+ * @details The first axial point is the first cell or node in flow direction. The derivative is
+ *          the same for all components.
+ * @return Derivative of the residual with respect to the inlet DOF of the same component
+ */
+double ConvectionDispersionOperatorBase::inletJacobian() const CADET_NOEXCEPT
+{
+	const double u = std::abs(static_cast<double>(_curVelocity));
+	double factor = isDG() ? _dgInletFactor : static_cast<double>(_nCol);
+	if (isAdaptive())
+		factor /= (_curVelocity >= 0.0) ? _cellWidthFactor.front() : _cellWidthFactor.back();
+
+	return -u * factor / static_cast<double>(_colLength);
+}
+
 /**
  * @brief Reads model parameters
  * @details Only reads parameters that do not affect model structure (e.g., discretization).
@@ -179,13 +390,17 @@ bool ConvectionDispersionOperatorBase::configure(UnitOpIdx unitOpIdx, IParameter
 /**
  * @brief Notifies the operator that a discontinuous section transition is in progress
  * @details In addition to changing flow direction internally, if necessary, the function returns whether
- *          the flow direction has changed.
+ *          the flow direction has changed. Since the inlet Jacobian depends on the width of the first
+ *          cell, an adaptation of the axial grid (see adaptAxialGrid()) is also reported as change.
  * @param [in] t Current time point
  * @param [in] secIdx Index of the new section that is about to be integrated
- * @return @c true if flow direction has changed, otherwise @c false
+ * @return @c true if flow direction or axial grid has changed, otherwise @c false
  */
 bool ConvectionDispersionOperatorBase::notifyDiscontinuousSectionTransition(double t, unsigned int secIdx)
 {
+	const bool gridChanged = _gridChanged;
+	_gridChanged = false;
+
 	// setFlowRates() was called before, so _curVelocity has direction dirOld
 	const int dirOld = _dir;
 
@@ -211,7 +426,238 @@ bool ConvectionDispersionOperatorBase::notifyDiscontinuousSectionTransition(doub
 	// No action required.
 
 	// Detect change in flow direction
-	return (dirOld * _dir < 0);
+	return (dirOld * _dir < 0) || gridChanged;
+}
+
+/**
+ * @brief Redistributes the axial cells such that fronts in the given state are resolved
+ * @details The number of cells is kept. For each cell, the normalized concentration gradient is estimated
+ *          from the differences to the neighboring cells, where the concentrations of each component are
+ *          scaled by their range in the column. If no front is found (the largest gradient times the uniform
+ *          cell width is below the threshold), the grid returns to uniform. Otherwise, the monitor function
+ *          @f[ M = 1 + (R - 1) \frac{g}{g_{\max}} @f]
+ *          with maximum refinement ratio @f$ R @f$ is smoothed and equidistributed on the current grid, that is,
+ *          each new cell carries the same integral of @f$ M @f$. This limits the ratio of the largest to the
+ *          smallest cell width by @f$ R @f$.
+ *
+ *          Small changes of the grid are rejected since each remapping of the state adds numerical diffusion.
+ *          If the grid has changed, the owning model has to remap all axially distributed quantities by
+ *          remapAxialField().
+ * @param [in] y Pointer to unit operation's state vector
+ * @return @c true if the grid has changed, otherwise @c false
+ */
+bool ConvectionDispersionOperatorBase::adaptAxialGrid(double const* y)
+{
+	if (!isAdaptive() || (_nCol < 3))
+		return false;
+
+	double const* const yBulk = y + offsetC();
+	const double nCol = static_cast<double>(_nCol);
+
+	// Concentration range of each component
+	std::vector<double> range(_nComp, 0.0);
+	double maxRange = 0.0;
+	for (unsigned int comp = 0; comp < _nComp; ++comp)
+	{
+		double cMin = yBulk[comp];
+		double cMax = yBulk[comp];
+		for (unsigned int col = 1; col < _nCol; ++col)
+		{
+			cMin = std::min(cMin, yBulk[col * _strideCell + comp]);
+			cMax = std::max(cMax, yBulk[col * _strideCell + comp]);
+		}
+		range[comp] = cMax - cMin;
+		maxRange = std::max(maxRange, range[comp]);
+	}
+
+	// Normalized gradient with respect to the relative axial coordinate, components with negligible range are ignored
+	std::vector<double> monitor(_nCol, 0.0);
+	for (unsigned int comp = 0; comp < _nComp; ++comp)
+	{
+		if ((range[comp] <= 0.0) || (range[comp] < 1e-6 * maxRange))
+			continue;
+
+		for (unsigned int col = 0; col < _nCol - 1; ++col)
+		{
+			const double diff = std::abs(yBulk[(col + 1) * _strideCell + comp] - yBulk[col * _strideCell + comp]) / range[comp];
+			const double grad = diff / (_cellCenter[col + 1] - _cellCenter[col]);
+			monitor[col] = std::max(monitor[col], grad);
+			monitor[col + 1] = std::max(monitor[col + 1], grad);
+		}
+	}
+
+	const double maxGrad = *std::max_element(monitor.begin(), monitor.end());
+	std::vector<double> newFactor(_nCol, 1.0);
+	if (maxGrad / nCol >= _adaptThreshold)
+	{
+		for (unsigned int col = 0; col < _nCol; ++col)
+			monitor[col] = 1.0 + (_adaptMaxRefinement - 1.0) * monitor[col] / maxGrad;
+
+		// Smooth monitor function to avoid abrupt changes of the cell width
+		std::vector<double> smoothed(_nCol);
+		for (int pass = 0; pass < 2; ++pass)
+		{
+			for (unsigned int col = 0; col < _nCol; ++col)
+			{
+				const double left = (col > 0) ? monitor[col - 1] : monitor[col];
+				const double right = (col < _nCol - 1) ? monitor[col + 1] : monitor[col];
+				smoothed[col] = 0.25 * (left + 2.0 * monitor[col] + right);
+			}
+			monitor.swap(smoothed);
+		}
+
+		// Limit the ratio of neighboring cell widths, which keeps the grid mapping smooth
+		const double maxGrowth = 1.1;
+		for (unsigned int col = 1; col < _nCol; ++col)
+			monitor[col] = std::max(monitor[col], monitor[col - 1] / maxGrowth);
+		for (unsigned int col = _nCol - 1; col > 0; --col)
+			monitor[col - 1] = std::max(monitor[col - 1], monitor[col] / maxGrowth);
+
+		// Equidistribute the integral of the piecewise constant monitor function over the interior cells,
+		// the cells at both column ends keep their uniform width such that inlet and outlet values do not jump
+		double total = 0.0;
+		for (unsigned int col = 1; col < _nCol - 1; ++col)
+			total += monitor[col] * _cellWidthFactor[col];
+
+		const double target = total / (nCol - 2.0);
+		const double interiorEnd = nCol - 1.0;
+		unsigned int oldCell = 1;
+		double oldLeft = 1.0;
+		double integral = 0.0;
+		double newLeft = 1.0;
+		for (unsigned int col = 1; col < _nCol - 2; ++col)
+		{
+			const double edgeIntegral = target * static_cast<double>(col);
+			while ((oldCell < _nCol - 2) && (integral + monitor[oldCell] * _cellWidthFactor[oldCell] < edgeIntegral))
+			{
+				integral += monitor[oldCell] * _cellWidthFactor[oldCell];
+				oldLeft += _cellWidthFactor[oldCell];
+				++oldCell;
+			}
+
+			const double edge = std::min(oldLeft + (edgeIntegral - integral) / monitor[oldCell], interiorEnd);
+			newFactor[col] = edge - newLeft;
+			newLeft = edge;
+		}
+		newFactor[_nCol - 2] = interiorEnd - newLeft;
+	}
+
+	// Reject small changes
+	const double minRelChange = 0.1;
+	double relChange = 0.0;
+	for (unsigned int col = 0; col < _nCol; ++col)
+		relChange = std::max(relChange, std::abs(newFactor[col] - _cellWidthFactor[col]) / _cellWidthFactor[col]);
+
+	if (relChange < minRelChange)
+		return false;
+
+	_prevCellWidthFactor.swap(_cellWidthFactor);
+	_cellWidthFactor = std::move(newFactor);
+
+	double left = 0.0;
+	for (unsigned int col = 0; col < _nCol; ++col)
+	{
+		_cellCenter[col] = (left + 0.5 * _cellWidthFactor[col]) / nCol;
+		left += _cellWidthFactor[col];
+	}
+
+	_gridChanged = true;
+	return true;
+}
+
+/**
+ * @brief Remaps an axially distributed field from the previous to the current axial grid
+ * @details The field consists of a block of @p blockSize consecutive items per cell. On the previous grid,
+ *          each item is reconstructed linearly in each cell with slopes limited by the monotonized central (MC)
+ *          limiter. The value of a new cell is the average of this reconstruction over the new cell. This
+ *          conserves the mass in the column and does not create new extrema.
+ * @param [in,out] data Pointer to the first item of the block of the first cell
+ * @param [in] blockSize Number of items per cell
+ * @param [in] stride Number of elements between the same item in two adjacent cells
+ */
+void ConvectionDispersionOperatorBase::remapAxialField(double* data, unsigned int blockSize, unsigned int stride) const
+{
+	if (_prevCellWidthFactor.size() != _nCol)
+		return;
+
+	// Cell centers of the previous grid
+	std::vector<double> center(_nCol);
+	double left = 0.0;
+	for (unsigned int col = 0; col < _nCol; ++col)
+	{
+		center[col] = left + 0.5 * _prevCellWidthFactor[col];
+		left += _prevCellWidthFactor[col];
+	}
+
+	// Limited slopes, boundary cells are reconstructed constant
+	std::vector<double> slope(_nCol * blockSize, 0.0);
+	for (unsigned int col = 1; col < _nCol - 1; ++col)
+	{
+		double const* const v = data + col * stride;
+		double const* const vLeft = v - stride;
+		double const* const vRight = v + stride;
+		for (unsigned int i = 0; i < blockSize; ++i)
+		{
+			const double sLeft = (v[i] - vLeft[i]) / (center[col] - center[col - 1]);
+			const double sRight = (vRight[i] - v[i]) / (center[col + 1] - center[col]);
+			if (sLeft * sRight <= 0.0)
+				continue;
+
+			const double sCentral = 0.5 * (sLeft + sRight);
+			const double sign = (sCentral > 0.0) ? 1.0 : -1.0;
+			slope[col * blockSize + i] = sign * std::min(std::abs(sCentral), 2.0 * std::min(std::abs(sLeft), std::abs(sRight)));
+		}
+	}
+
+	std::vector<double> remapped(_nCol * blockSize, 0.0);
+	std::vector<double> weight(_nCol, 0.0);
+
+	// Sweep over old and new cells simultaneously
+	unsigned int oldCell = 0;
+	unsigned int newCell = 0;
+	double oldLeft = 0.0;
+	double oldRight = _prevCellWidthFactor[0];
+	double newLeft = 0.0;
+	double newRight = _cellWidthFactor[0];
+	while ((oldCell < _nCol) && (newCell < _nCol))
+	{
+		const double overlapLeft = std::max(oldLeft, newLeft);
+		const double overlap = std::min(oldRight, newRight) - overlapLeft;
+		if (overlap > 0.0)
+		{
+			// Integrate linear reconstruction over overlap
+			const double dist = overlapLeft + 0.5 * overlap - center[oldCell];
+			double const* const src = data + oldCell * stride;
+			double const* const srcSlope = slope.data() + oldCell * blockSize;
+			double* const dest = remapped.data() + newCell * blockSize;
+			for (unsigned int i = 0; i < blockSize; ++i)
+				dest[i] += overlap * (src[i] + srcSlope[i] * dist);
+			weight[newCell] += overlap;
+		}
+
+		if (oldRight < newRight)
+		{
+			++oldCell;
+			oldLeft = oldRight;
+			if (oldCell < _nCol)
+				oldRight += _prevCellWidthFactor[oldCell];
+		}
+		else
+		{
+			++newCell;
+			newLeft = newRight;
+			if (newCell < _nCol)
+				newRight += _cellWidthFactor[newCell];
+		}
+	}
+
+	for (unsigned int col = 0; col < _nCol; ++col)
+	{
+		double* const dest = data + col * stride;
+		double const* const src = remapped.data() + col * blockSize;
+		for (unsigned int i = 0; i < blockSize; ++i)
+			dest[i] = src[i] / weight[col];
+	}
 }
 
 /**
@@ -277,6 +723,9 @@ int ConvectionDispersionOperatorBase::residual(double t, unsigned int secIdx, ac
 template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
 int ConvectionDispersionOperatorBase::residualImpl(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin)
 {
+	if (isDG())
+		return residualImplDG<StateType, ResidualType, ParamType, RowIteratorType, wantJac>(t, secIdx, y, yDot, res, jacBegin);
+
 	const ParamType u = static_cast<ParamType>(_curVelocity);
 	active const* const d_c = getSectionDependentSlice(_colDispersion, _nComp, secIdx);
 	const ParamType h = static_cast<ParamType>(_colLength) / static_cast<double>(_nCol);
@@ -294,12 +743,77 @@ int ConvectionDispersionOperatorBase::residualImpl(double t, unsigned int secIdx
 		_nComp,
 		_nCol,
 		0u,
-		_nComp
+		_nComp,
+		isAdaptive() ? _cellWidthFactor.data() : nullptr
 	};
 
 	return convdisp::residualKernel<StateType, ResidualType, ParamType, RowIteratorType, wantJac>(SimulationTime{t, secIdx}, y, yDot, res, jacBegin, fp);
 }
 
+template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
+int ConvectionDispersionOperatorBase::residualImplDG(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin)
+{
+	const ParamType u = static_cast<ParamType>(_curVelocity);
+	active const* const d_c = getSectionDependentSlice(_colDispersion, _nComp, secIdx);
+	const ParamType L = static_cast<ParamType>(_colLength);
+
+	// Backwards flow is handled by mirroring the axial points
+	const bool forward = (u >= 0.0);
+	const ParamType convFactor = (forward ? u : ParamType(-u)) / L;
+
+	const int nNode = static_cast<int>(_dgPolyDeg) + 1;
+	const int width = 3 * nNode;
+	const int nPoints = static_cast<int>(_nCol);
+	const int stride = strideColCell();
+
+	StateType const* const yBulk = y + offsetC();
+	ResidualType* const resBulk = res + offsetC();
+
+	for (unsigned int comp = 0; comp < _nComp; ++comp)
+	{
+		const ParamType dispFactor = static_cast<ParamType>(d_c[comp]) / (L * L);
+
+		for (int row = 0; row < nPoints; ++row)
+		{
+			const int pos = forward ? row : nPoints - 1 - row;
+			ResidualType& resCur = resBulk[pos * stride + comp];
+
+			if (yDot)
+				resCur = yDot[offsetC() + pos * stride + comp];
+			else
+				resCur = 0.0;
+
+			// Band of this row starts at the first node of the previous element
+			const int bandStart = (row / nNode - 1) * nNode;
+			const int kStart = std::max(0, -bandStart);
+			const int kEnd = std::min(width, nPoints - bandStart);
+
+			double const* const convRow = _dgConv.data() + row * width;
+			double const* const dispRow = _dgDisp.data() + row * width;
+
+			RowIteratorType jac;
+			if (wantJac)
+				jac = jacBegin + (pos * stride + static_cast<int>(comp));
+
+			for (int k = kStart; k < kEnd; ++k)
+			{
+				const int colPos = forward ? bandStart + k : nPoints - 1 - bandStart - k;
+				const ParamType val = convFactor * convRow[k] - dispFactor * dispRow[k];
+				resCur += val * yBulk[colPos * stride + comp];
+
+				if (wantJac)
+					jac[(colPos - pos) * stride] += static_cast<double>(val);
+			}
+
+			// Inflow through the first node
+			if (row == 0)
+				resCur -= convFactor * _dgInletFactor * y[comp];
+		}
+	}
+
+	return 0;
+}
+
 /**
  * @brief Multiplies the time derivative Jacobian @f$ \frac{\partial F}{\partial \dot{y}}\left(t, y, \dot{y}\right) @f$ with a given vector
  * @details The operation @f$ z = \frac{\partial F}{\partial \dot{y}} x @f$ is performed.
@@ -349,6 +863,10 @@ void ConvectionDispersionOperatorBase::addTimeDerivativeToJacobian(double alpha,
 
 unsigned int ConvectionDispersionOperatorBase::jacobianLowerBandwidth() const CADET_NOEXCEPT
 {
+	// The nodes of a DG element are coupled to all nodes of the neighboring elements
+	if (isDG())
+		return (2 * _dgPolyDeg + 1) * strideColCell();
+
 	// Note that we have to increase the lower bandwidth by 1 because the WENO stencil is applied to the
 	// right cell face (lower + 1 + upper) and to the left cell face (shift the stencil by -1 because influx of cell i
 	// is outflux of cell i-1)
@@ -358,6 +876,9 @@ unsigned int ConvectionDispersionOperatorBase::jacobianLowerBandwidth() const CA
 
 unsigned int ConvectionDispersionOperatorBase::jacobianUpperBandwidth() const CADET_NOEXCEPT
 {
+	if (isDG())
+		return (2 * _dgPolyDeg + 1) * strideColCell();
+
 	// We have to make sure that there's at least one sub and super diagonal for the dispersion term
 	return std::max(_weno.upperBandwidth(), 1u) * strideColCell();
 }
@@ -400,6 +921,37 @@ bool ConvectionDispersionOperatorBase::setParameter(const ParameterId& pId, doub
 	return true;
 }
 
+bool ConvectionDispersionOperatorBase::getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+{
+	// We only need to do something if COL_DISPERSION is component independent
+	if (!_dispersionCompIndep)
+		return false;
+
+	if ((pId.name != hashString("COL_DISPERSION")) || (pId.component != CompIndep) || (pId.boundState != BoundStateIndep) || (pId.reaction != ReactionIndep) || (pId.particleType != ParTypeIndep))
+		return false;
+
+	if (_colDispersion.size() > _nComp)
+	{
+		// Section dependent
+		if (pId.section == SectionIndep)
+			return false;
+
+		for (unsigned int i = 0; i < _nComp; ++i)
+			ptrs.push_back(&_colDispersion[pId.section * _nComp + i]);
+	}
+	else
+	{
+		// Section independent
+		if (pId.section != SectionIndep)
+			return false;
+
+		for (unsigned int i = 0; i < _nComp; ++i)
+			ptrs.push_back(&_colDispersion[i]);
+	}
+
+	return true;
+}
+
 bool ConvectionDispersionOperatorBase::setSensitiveParameterValue(const std::unordered_set<active*>& sensParams, const ParameterId& pId, double value)
 {
 	// We only need to do something if COL_DISPERSION is component independent
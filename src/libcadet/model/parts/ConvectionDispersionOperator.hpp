@@ -56,6 +56,16 @@ u c_{\text{in},i}(t) &= u c_i(t,0) - D_{\text{ax},i} \frac{\partial c_i}{\partia
 \end{align} @f]
  * Methods are described in @cite VonLieres2010a (WENO, linear solver), and @cite Puttmann2013, @cite Puttmann2016 (forward sensitivities, AD, band compression)
  * 
+ * As an alternative to the finite volume (FV) scheme with WENO reconstruction, a nodal discontinuous Galerkin
+ * spectral element method (DG) on Legendre-Gauss-Lobatto nodes can be selected (field @c AXIAL_DISC_TYPE).
+ * Each node of the DG scheme takes the place of an axial cell, so that the state layout and the banded
+ * Jacobian structure are the same for both schemes.
+ * 
+ * The FV scheme supports an adaptive axial grid (field @c ADAPTIVE_AXIAL_GRID). The number of cells is fixed, but
+ * the cells are redistributed at discontinuous section transitions such that fronts in the current solution are
+ * resolved by smaller cells (see adaptAxialGrid()). The owning model remaps its axially distributed state to the
+ * new grid by remapAxialField().
+ * 
  * This class does not store the Jacobian. It only fills existing matrices given to its residual() functions.
  * It assumes that there is no offset to the inlet in the local state vector and that the firsts cell is placed
  * directly after the inlet DOFs.
@@ -69,10 +79,15 @@ public:
 
 	void setFlowRates(const active& in, const active& out, const active& colPorosity) CADET_NOEXCEPT;
 
+	static unsigned int readNumAxialPoints(IParameterProvider& paramProvider);
+
 	bool configureModelDiscretization(IParameterProvider& paramProvider, unsigned int nComp, unsigned int nCol, unsigned int strideCell);
 	bool configure(UnitOpIdx unitOpIdx, IParameterProvider& paramProvider, std::unordered_map<ParameterId, active*>& parameters);
 	bool notifyDiscontinuousSectionTransition(double t, unsigned int secIdx);
 
+	bool adaptAxialGrid(double const* y);
+	void remapAxialField(double* data, unsigned int blockSize, unsigned int stride) const;
+
 	int residual(double t, unsigned int secIdx, double const* y, double const* yDot, double* res, linalg::BandMatrix& jac);
 	int residual(double t, unsigned int secIdx, double const* y, double const* yDot, active* res, linalg::BandMatrix& jac);
 	int residual(double t, unsigned int secIdx, double const* y, double const* yDot, double* res, WithoutParamSensitivity);
@@ -90,12 +105,19 @@ public:
 	inline unsigned int nComp() const CADET_NOEXCEPT { return _nComp; }
 	inline unsigned int nCol() const CADET_NOEXCEPT { return _nCol; }
 	inline const Weno& weno() const CADET_NOEXCEPT { return _weno; }
+	inline bool isDG() const CADET_NOEXCEPT { return _dgPolyDeg > 0; }
+	inline bool isAdaptive() const CADET_NOEXCEPT { return !_cellWidthFactor.empty(); }
+	inline bool hasConstantJacobian() const CADET_NOEXCEPT { return isDG() || (_weno.order() == 1); }
+
+	double relativeCoordinate(unsigned int col) const CADET_NOEXCEPT;
+	double inletJacobian() const CADET_NOEXCEPT;
 
 	unsigned int jacobianLowerBandwidth() const CADET_NOEXCEPT;
 	unsigned int jacobianUpperBandwidth() const CADET_NOEXCEPT;
 	unsigned int jacobianDiscretizedBandwidth() const CADET_NOEXCEPT;
 
 	bool setParameter(const ParameterId& pId, double value);
+	bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs);
 	bool setSensitiveParameter(std::unordered_set<active*>& sensParams, const ParameterId& pId, unsigned int adDirection, double adValue);
 	bool setSensitiveParameterValue(const std::unordered_set<active*>& sensParams, const ParameterId& id, double value);
 
@@ -110,6 +132,11 @@ protected:
 	template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
 	int residualBackwardsFlow(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin);
 
+	template <typename StateType, typename ResidualType, typename ParamType, typename RowIteratorType, bool wantJac>
+	int residualImplDG(double t, unsigned int secIdx, StateType const* y, double const* yDot, ResidualType* res, RowIteratorType jacBegin);
+
+	void assembleDGOperators();
+
 	unsigned int _nComp; //!< Number of components
 	unsigned int _nCol; //!< Number of axial cells
 	unsigned int _strideCell; //!< Number of elements between the same item in two adjacent cells
@@ -130,6 +157,20 @@ protected:
 
 	bool _dispersionCompIndep; //!< Determines whether dispersion is component independent
 
+	unsigned int _dgPolyDeg; //!< Polynomial degree @f$ N @f$ of the DG scheme, @c 0 if FV is used
+	unsigned int _dgNelem; //!< Number of DG elements
+	std::vector<double> _dgNodes; //!< LGL nodes on the reference element @f$ [-1, 1] @f$
+	std::vector<double> _dgConv; //!< Banded DG convection operator on a column of unit length (row-wise, @f$ 3(N+1) @f$ entries per row)
+	std::vector<double> _dgDisp; //!< Banded DG dispersion operator on a column of unit length (row-wise, @f$ 3(N+1) @f$ entries per row)
+	double _dgInletFactor; //!< Lifting factor of the inlet flux into the first node on a column of unit length
+
+	std::vector<double> _cellWidthFactor; //!< Width of each axial cell relative to the uniform width @f$ L / N_{\text{col}} @f$, empty if the grid is not adaptive
+	std::vector<double> _prevCellWidthFactor; //!< Cell width factors before the last grid adaptation
+	std::vector<double> _cellCenter; //!< Relative axial position of the cell centers on the adaptive grid
+	double _adaptThreshold; //!< Minimum normalized concentration difference over a uniform cell width that marks a front
+	double _adaptMaxRefinement; //!< Maximum ratio of the largest to the smallest cell width
+	bool _gridChanged; //!< Determines whether the axial grid has been adapted since the last section transition
+
 	// Indexer functionality
 
 	// Strides
@@ -196,6 +237,11 @@ public:
 	inline const active& columnLength() const CADET_NOEXCEPT { return _baseOp.columnLength(); }
 	inline const active& crossSectionArea() const CADET_NOEXCEPT { return _baseOp.crossSectionArea(); }
 	inline const active& currentVelocity() const CADET_NOEXCEPT { return _baseOp.currentVelocity(); }
+	inline double relativeCoordinate(unsigned int col) const CADET_NOEXCEPT { return _baseOp.relativeCoordinate(col); }
+	inline double inletJacobian() const CADET_NOEXCEPT { return _baseOp.inletJacobian(); }
+	inline bool isAdaptive() const CADET_NOEXCEPT { return _baseOp.isAdaptive(); }
+	inline bool adaptAxialGrid(double const* y) { return _baseOp.adaptAxialGrid(y); }
+	inline void remapAxialField(double* data, unsigned int blockSize, unsigned int stride) const { _baseOp.remapAxialField(data, blockSize, stride); }
 
 	inline linalg::BandMatrix& jacobian() CADET_NOEXCEPT { return _jacC; }
 	inline const linalg::BandMatrix& jacobian() const CADET_NOEXCEPT { return _jacC; }
@@ -207,6 +253,10 @@ public:
 	{
 		return _baseOp.setParameter(pId, value);
 	}
+	inline bool getParameterPointers(const ParameterId& pId, std::vector<active*>& ptrs)
+	{
+		return _baseOp.getParameterPointers(pId, ptrs);
+	}
 	inline bool setSensitiveParameter(std::unordered_set<active*>& sensParams, const ParameterId& pId, unsigned int adDirection, double adValue)
 	{
 		return _baseOp.setSensitiveParameter(sensParams, pId, adDirection, adValue);
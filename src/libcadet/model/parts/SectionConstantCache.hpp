@@ -0,0 +1,106 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Defines a cache for derived coefficients that are constant within a section.
+ */
+
+#ifndef LIBCADET_SECTIONCONSTANTCACHE_HPP_
+#define LIBCADET_SECTIONCONSTANTCACHE_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#include <vector>
+
+namespace cadet
+{
+
+namespace model
+{
+
+namespace parts
+{
+
+/**
+ * @brief Flat array of derived coefficients that only change at section transitions or on parameter updates
+ * @details Unit operations compute coefficients like discretized film diffusion rates or surface to
+ *          volume ratios from their parameters. Since these parameters are either constant or section
+ *          dependent, the coefficients can be reused in all residual and Jacobian evaluations of a section.
+ *
+ *          The cache remembers the section it has been computed for. It has to be invalidated whenever a
+ *          parameter it depends on is changed. The layout of the array is determined by the owning model.
+ *          Only @c double values are cached, evaluations that require parameter sensitivities have to
+ *          compute the coefficients with AD.
+ */
+class SectionConstantCache
+{
+public:
+
+	SectionConstantCache() : _secIdx(0), _valid(false) { }
+
+	/**
+	 * @brief Resizes the cache and invalidates it
+	 * @param [in] n Number of coefficients
+	 */
+	inline void resize(unsigned int n)
+	{
+		_data.resize(n, 0.0);
+		_valid = false;
+	}
+
+	/**
+	 * @brief Checks whether the cached coefficients belong to the given section
+	 * @param [in] secIdx Index of the section
+	 * @return @c true if the cache is up to date, otherwise @c false
+	 */
+	inline bool isValid(unsigned int secIdx) const CADET_NOEXCEPT { return _valid && (_secIdx == secIdx); }
+
+	/**
+	 * @brief Marks the cache as out of date
+	 * @details Has to be called when a parameter the coefficients depend on changes.
+	 */
+	inline void invalidate() CADET_NOEXCEPT { _valid = false; }
+
+	/**
+	 * @brief Marks the cache as up to date for the given section
+	 * @details Has to be called after all coefficients have been written to data().
+	 * @param [in] secIdx Index of the section
+	 */
+	inline void validate(unsigned int secIdx) CADET_NOEXCEPT
+	{
+		_secIdx = secIdx;
+		_valid = true;
+	}
+
+	/**
+	 * @brief Returns the number of cached coefficients
+	 * @return Number of coefficients
+	 */
+	inline unsigned int size() const CADET_NOEXCEPT { return _data.size(); }
+
+	inline double* data() CADET_NOEXCEPT { return _data.data(); }
+	inline double const* data() const CADET_NOEXCEPT { return _data.data(); }
+
+protected:
+	std::vector<double> _data; //!< Cached coefficients
+	unsigned int _secIdx; //!< Index of the section the coefficients have been computed for
+	bool _valid; //!< Determines whether the coefficients are up to date
+};
+
+} // namespace parts
+
+} // namespace model
+
+} // namespace cadet
+
+#endif  // LIBCADET_SECTIONCONSTANTCACHE_HPP_
@@ -1003,7 +1003,8 @@ int TwoDimensionalConvectionDispersionOperator::residualImpl(double t, unsigned
 			_nComp,
 			_nCol,
 			_nComp * i,                        // Offset to the first component of the inlet DOFs in the local state vector
-			_nComp * (_nRad + i)               // Offset to the first component of the first bulk cell in the local state vector
+			_nComp * (_nRad + i),              // Offset to the first component of the first bulk cell in the local state vector
+			nullptr                            // Uniform axial grid
 		};
 
 		if (wantJac)
@@ -55,6 +55,7 @@ public:
 	virtual active* getParameter(const ParameterId& pId) { return nullptr; }
 
 	virtual bool dependsOnTime() const CADET_NOEXCEPT { return false; }
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT { return true; }
 	virtual bool requiresWorkspace() const CADET_NOEXCEPT { return false; }
 	virtual unsigned int workspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates) const CADET_NOEXCEPT
 	{
@@ -21,6 +21,7 @@
 #include "Memory.hpp"
 
 #include <functional>
+#include <cmath>
 #include <algorithm>
 #include <unordered_map>
 #include <string>
@@ -155,135 +156,315 @@ namespace
 	}
 
 	/**
-	 * @brief Calculate gradient of reaction rate (flux) in liquid phase
-	 * @param [out] fluxGrad Array that holds the gradient of the reaction rate
-	 * @param [in] r Index of the reaction
-	 * @param [in] nComp Number of components
-	 * @param [in] rate Rate constant
-	 * @param [in] exponents Matrix with exponents in the rate law
-	 * @param [in] y Array of concentrations
+	 * @brief Checks whether a rate law is affine in the state
+	 * @details The rate law is affine if all exponents are either 0 or 1 and at most one of them is 1.
+	 * @param [in] idxReaction Index of the reaction
+	 * @param [in] expA Matrix with exponents of the first set of concentrations in the rate law
+	 * @param [in] nA Number of rows in @p expA
+	 * @param [in] expB Matrix with exponents of the second set of concentrations in the rate law
+	 * @param [in] nB Number of rows in @p expB
+	 * @return @c true if the rate law is affine in the state, otherwise @c false
 	 */
-	inline void fluxGradLiquid(double* fluxGrad, unsigned int r, unsigned int nComp, double rate, const cadet::linalg::ActiveDenseMatrix& exponents, double const* y)
+	inline bool isAffineRate(unsigned int idxReaction, const cadet::linalg::ActiveDenseMatrix& expA, unsigned int nA, const cadet::linalg::ActiveDenseMatrix& expB, unsigned int nB)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		unsigned int order = 0;
+		for (unsigned int c = 0; c < nA + nB; ++c)
 		{
-			if (cadet_unlikely(exponents.native(c, r) != 0.0))
-				fluxGrad[c] = rate;
-			else
-				fluxGrad[c] = 0.0;
+			const double e = (c < nA) ? static_cast<double>(expA.native(c, idxReaction)) : static_cast<double>(expB.native(c - nA, idxReaction));
+			if (e == 0.0)
+				continue;
+			if (e != 1.0)
+				return false;
+			++order;
 		}
+		return order <= 1;
+	}
 
-		// Calculate gradient
-		for (unsigned int c = 0; c < nComp; ++c)
-		{
-			if (cadet_unlikely(exponents.native(c, r) != 0.0))
+	/**
+	 * @brief Largest exponent that is evaluated by repeated multiplication instead of pow()
+	 */
+	const int maxChainExponent = 8;
+
+	/**
+	 * @brief Returns an exponent as integer if it can be evaluated by repeated multiplication
+	 * @param [in] exponent Exponent of a participant in a rate law
+	 * @return Exponent as integer, or @c 0 if it is not a small positive integer
+	 */
+	inline int chainExponent(double exponent)
+	{
+		if ((exponent >= 1.0) && (exponent <= static_cast<double>(maxChainExponent)) && (exponent == std::floor(exponent)))
+			return static_cast<int>(exponent);
+
+		return 0;
+	}
+
+	/**
+	 * @brief Computes a positive integer power by repeated multiplication
+	 * @param [in] base Base
+	 * @param [in] n Positive exponent
+	 * @return @p base to the power of @p n
+	 */
+	template <typename ValueType>
+	inline ValueType multiplyChain(const ValueType& base, int n)
+	{
+		ValueType result = base;
+		for (int i = 1; i < n; ++i)
+			result *= base;
+
+		return result;
+	}
+
+	/**
+	 * @brief Computes the factor of a participant in a rate law
+	 * @details Uses repeated multiplication if the exponent is a small positive integer. The precompiled
+	 *          integer exponent is checked against the current value, which may have been changed directly.
+	 * @param [in] y Concentration of the participant
+	 * @param [in] exponent Exponent of the participant
+	 * @param [in] intExp Precompiled integer exponent (see chainExponent())
+	 * @return Factor @f$ y^e @f$ of the participant
+	 */
+	template <typename StateType>
+	inline StateType participantFactor(const StateType& y, double exponent, int intExp)
+	{
+		if ((intExp > 0) && (exponent == static_cast<double>(intExp)))
+			return multiplyChain(y, intExp);
+
+		return pow(y, exponent);
+	}
+
+	/**
+	 * @brief Computes the factor of a participant in a rate law with an AD exponent
+	 * @details Always uses pow() in order to keep derivatives with respect to the exponent.
+	 * @param [in] y Concentration of the participant
+	 * @param [in] exponent Exponent of the participant
+	 * @param [in] intExp Precompiled integer exponent (unused)
+	 * @return Factor @f$ y^e @f$ of the participant
+	 */
+	inline active participantFactor(const active& y, const active& exponent, int intExp)
+	{
+		return pow(y, exponent);
+	}
+
+	/**
+	 * @brief Computes the derivative of the factor of a participant in a rate law
+	 * @param [in] y Concentration of the participant
+	 * @param [in] exponent Exponent of the participant
+	 * @param [in] intExp Precompiled integer exponent (see chainExponent())
+	 * @return Derivative @f$ e y^{e-1} @f$ of the factor
+	 */
+	inline double participantFactorDerivative(double y, double exponent, int intExp)
+	{
+		if ((intExp > 0) && (exponent == static_cast<double>(intExp)))
+			return (intExp == 1) ? 1.0 : exponent * multiplyChain(y, intExp - 1);
+
+		return exponent * pow(y, exponent - 1.0);
+	}
+
+	/**
+	 * @brief Nonzero entries of a stoichiometric or exponent matrix in compressed column (reaction) storage
+	 * @details The entries of reaction @c r are stored in the range @c start[r] to @c start[r+1].
+	 *          Rate laws of particle reactions are given by two exponent matrices (liquid and solid phase),
+	 *          which are stored one after another. The entries of the second matrix start at @c split[r].
+	 *
+	 *          Only pointers to the values are stored, such that changed values and parameter sensitivities
+	 *          are respected. The sparsity pattern, however, is fixed by compile() and has to be rebuilt if
+	 *          entries change from or to zero.
+	 */
+	struct CompressedReactionMatrix
+	{
+		std::vector<int> start; //!< Index of the first entry of each reaction, has an additional last element
+		std::vector<int> split; //!< Index of the first entry of each reaction that belongs to the second matrix
+		std::vector<int> row; //!< Row index of each entry in its matrix
+		std::vector<active const*> value; //!< Pointer to the value of each entry
+		std::vector<int> intExp; //!< Precompiled integer exponent of each entry (see chainExponent())
+
+		/**
+		 * @brief Extracts the nonzero entries of the given matrices
+		 * @param [in] first Stoichiometric or (first) exponent matrix with reactions as columns
+		 * @param [in] second Second exponent matrix or @c nullptr
+		 */
+		inline void compile(const cadet::linalg::ActiveDenseMatrix& first, cadet::linalg::ActiveDenseMatrix const* second)
+		{
+			start.clear();
+			split.clear();
+			row.clear();
+			value.clear();
+			intExp.clear();
+
+			for (int r = 0; r < first.columns(); ++r)
 			{
-				const double exponentValue = static_cast<double>(exponents.native(c, r));
-				const double v = pow(y[c], exponentValue);
-				for (unsigned int j = 0; j < c; ++j)
-					fluxGrad[j] *= v;
+				start.push_back(row.size());
+				append(first, r);
+
+				split.push_back(row.size());
+				if (second && (r < second->columns()))
+					append(*second, r);
+			}
+			start.push_back(row.size());
+		}
 
-				fluxGrad[c] *= exponentValue * pow(y[c], exponentValue - 1.0);
+		inline int numReactions() const CADET_NOEXCEPT { return static_cast<int>(split.size()); }
 
-				for (unsigned int j = c + 1; j < nComp; ++j)
-					fluxGrad[j] *= v;
+	private:
 
+		inline void append(const cadet::linalg::ActiveDenseMatrix& mat, int r)
+		{
+			for (int c = 0; c < mat.rows(); ++c)
+			{
+				const double v = static_cast<double>(mat.native(c, r));
+				if (v == 0.0)
+					continue;
+
+				row.push_back(c);
+				value.push_back(&mat.native(c, r));
+				intExp.push_back(chainExponent(v));
 			}
 		}
-	}
+	};
 
 	/**
-	 * @brief Calculate gradient of reaction rate (flux) in liquid-solid phase cell
-	 * @param [out] fluxGrad Array that holds the gradient of the reaction rate
+	 * @brief Evaluates a rate law
+	 * @details The rate law vanishes if it does not have participants or if the concentration of a participant
+	 *          is not positive. In log-space, @f$ k \exp\left( \sum_i e_i \log y_i \right) @f$ is computed instead
+	 *          of the product of the single factors.
+	 * @param [in] law Compressed exponent matrices of the rate law
 	 * @param [in] r Index of the reaction
-	 * @param [in] nComp Number of components
-	 * @param [in] nTotalBoundStates Total number of bound states
 	 * @param [in] rate Rate constant
-	 * @param [in] expLiquid Matrix with exponents of the liquid phase concentrations in the rate law
-	 * @param [in] expSolid Matrix with exponents of the solid phase concentrations in the rate law
-	 * @param [in] yLiquid Array of liquid phase concentrations (points to first component of liquid phase concentrations)
-	 * @param [in] ySolid Array of solid phase concentrations (points to first component of solid phase concentrations)
+	 * @param [in] yFirst Concentrations corresponding to the first exponent matrix
+	 * @param [in] ySecond Concentrations corresponding to the second exponent matrix
+	 * @param [in] logSpace Determines whether the rate is evaluated in log-space
+	 * @return Reaction rate
 	 */
-	inline void fluxGradCombined(double* fluxGrad, unsigned int r, unsigned int nComp, unsigned int nTotalBoundStates, double rate,
-		const cadet::linalg::ActiveDenseMatrix& expLiquid, const cadet::linalg::ActiveDenseMatrix& expSolid, double const* yLiquid, double const* ySolid)
+	template <typename flux_t, typename ParamType, typename StateType>
+	inline flux_t evaluateRateLaw(const CompressedReactionMatrix& law, int r, const flux_t& rate, StateType const* yFirst, StateType const* ySecond, bool logSpace)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		const int first = law.start[r];
+		const int split = law.split[r];
+		const int last = law.start[r + 1];
+
+		if (first == last)
+			return 0.0;
+
+		for (int k = first; k < split; ++k)
 		{
-			if (cadet_unlikely(expLiquid.native(c, r) != 0.0))
-				fluxGrad[c] = rate;
-			else
-				fluxGrad[c] = 0.0;
+			if (static_cast<double>(yFirst[law.row[k]]) <= 0.0)
+				return 0.0;
 		}
-
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
+		for (int k = split; k < last; ++k)
 		{
-			if (cadet_unlikely(expSolid.native(c, r) != 0.0))
-				fluxGrad[nComp + c] = rate;
-			else
-				fluxGrad[nComp + c] = 0.0;
+			if (static_cast<double>(ySecond[law.row[k]]) <= 0.0)
+				return 0.0;
 		}
 
-		// Calculate gradient
-		for (unsigned int c = 0; c < nComp; ++c)
+		if (logSpace)
 		{
-			if (cadet_unlikely(expLiquid.native(c, r) != 0.0))
-			{
-				const double exponentValue = static_cast<double>(expLiquid.native(c, r));
-				const double v = pow(yLiquid[c], exponentValue);
-				for (unsigned int j = 0; j < c; ++j)
-					fluxGrad[j] *= v;
+			// Namespace cadet::log hides the function, AD types are found by argument dependent lookup
+			using std::log;
 
-				fluxGrad[c] *= exponentValue * pow(yLiquid[c], exponentValue - 1.0);
+			flux_t logRate = 0.0;
+			for (int k = first; k < split; ++k)
+				logRate += static_cast<ParamType>(*law.value[k]) * log(static_cast<flux_t>(yFirst[law.row[k]]));
+			for (int k = split; k < last; ++k)
+				logRate += static_cast<ParamType>(*law.value[k]) * log(static_cast<flux_t>(ySecond[law.row[k]]));
 
-				for (unsigned int j = c + 1; j < nComp + nTotalBoundStates; ++j)
-					fluxGrad[j] *= v;
-
-			}
+			return rate * exp(logRate);
 		}
 
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
-		{
-			if (cadet_unlikely(expSolid.native(c, r) != 0.0))
-			{
-				const double exponentValue = static_cast<double>(expSolid.native(c, r));
-				const double v = pow(ySolid[c], exponentValue);
-				for (unsigned int j = 0; j < nComp + c; ++j)
-					fluxGrad[j] *= v;
+		flux_t result = rate;
+		for (int k = first; k < split; ++k)
+			result *= participantFactor(static_cast<flux_t>(yFirst[law.row[k]]), static_cast<ParamType>(*law.value[k]), law.intExp[k]);
+		for (int k = split; k < last; ++k)
+			result *= participantFactor(static_cast<flux_t>(ySecond[law.row[k]]), static_cast<ParamType>(*law.value[k]), law.intExp[k]);
 
-				fluxGrad[nComp + c] *= exponentValue * pow(ySolid[c], exponentValue - 1.0);
+		return result;
+	}
 
-				for (unsigned int j = c + 1; j < nTotalBoundStates; ++j)
-					fluxGrad[nComp + j] *= v;
+	/**
+	 * @brief Calculates the gradient of a rate law with respect to its participants
+	 * @details The partial derivative of participant @f$ j @f$ is given by the product of the derivative of its
+	 *          factor and all other factors, which are obtained by prefix and suffix products.
+	 * @param [out] grad Gradient with respect to the participants in order of their storage in @p law
+	 * @param [out] factors Work memory for the factors of the participants
+	 * @param [in] law Compressed exponent matrices of the rate law
+	 * @param [in] r Index of the reaction
+	 * @param [in] rate Rate constant
+	 * @param [in] yFirst Concentrations corresponding to the first exponent matrix
+	 * @param [in] ySecond Concentrations corresponding to the second exponent matrix
+	 */
+	inline void rateLawGradient(double* grad, double* factors, const CompressedReactionMatrix& law, int r, double rate, double const* yFirst, double const* ySecond)
+	{
+		const int first = law.start[r];
+		const int split = law.split[r];
+		const int n = law.start[r + 1] - first;
 
-			}
+		double prefix = rate;
+		for (int k = 0; k < n; ++k)
+		{
+			const int idx = first + k;
+			const double y = (idx < split) ? yFirst[law.row[idx]] : ySecond[law.row[idx]];
+			const double e = static_cast<double>(*law.value[idx]);
+
+			factors[k] = participantFactor(y, e, law.intExp[idx]);
+			grad[k] = prefix * participantFactorDerivative(y, e, law.intExp[idx]);
+			prefix *= factors[k];
 		}
-	}
 
-	template <typename num_t>
-	inline num_t rateConstantOrZero(const num_t& rate, unsigned int idxReaction, const cadet::linalg::ActiveDenseMatrix& exponents, unsigned int nComp)
-	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		double suffix = 1.0;
+		for (int k = n - 1; k >= 0; --k)
 		{
-			if (cadet_unlikely(exponents.native(c, idxReaction) != 0.0))
-				return rate;
+			grad[k] *= suffix;
+			suffix *= factors[k];
 		}
-		return 0.0;
 	}
 
-	template <typename num_t>
-	inline num_t rateConstantOrZero(const num_t& rate, unsigned int idxReaction, const cadet::linalg::ActiveDenseMatrix& expLiquid, const cadet::linalg::ActiveDenseMatrix& expSolid, unsigned int nComp, unsigned int nTotalBoundStates)
+	/**
+	 * @brief Adds the Jacobian of a rate law times the stoichiometric coefficients to a Jacobian
+	 * @param [in,out] jac Row iterator pointing to the first row of the reaction terms
+	 * @param [in] stoich Compressed stoichiometric matrix
+	 * @param [in] law Compressed exponent matrices of the rate law
+	 * @param [in] r Index of the reaction
+	 * @param [in] grad Gradient of the rate law computed by rateLawGradient()
+	 * @param [in] factor Factor in front of the reaction term
+	 * @param [in] nFirst Number of rows of the first exponent matrix
+	 * @param [in] colOffset Offset of the first column of the rate law relative to the first row of @p jac
+	 */
+	template <typename RowIterator>
+	inline void addRateLawJacobian(const RowIterator& jac, const CompressedReactionMatrix& stoich, const CompressedReactionMatrix& law, int r,
+		double const* grad, double factor, int nFirst, int colOffset)
 	{
-		for (unsigned int c = 0; c < nComp; ++c)
+		const int first = law.start[r];
+		const int split = law.split[r];
+		const int last = law.start[r + 1];
+
+		for (int s = stoich.start[r]; s < stoich.start[r + 1]; ++s)
 		{
-			if (cadet_unlikely(expLiquid.native(c, idxReaction) != 0.0))
-				return rate;
+			const int row = stoich.row[s];
+			const double rowFactor = static_cast<double>(*stoich.value[s]) * factor;
+			RowIterator curJac = jac + row;
+
+			for (int k = first; k < split; ++k)
+				curJac[law.row[k] + colOffset - row] += rowFactor * grad[k - first];
+			for (int k = split; k < last; ++k)
+				curJac[nFirst + law.row[k] + colOffset - row] += rowFactor * grad[k - first];
 		}
-		for (unsigned int c = 0; c < nTotalBoundStates; ++c)
+	}
+
+	/**
+	 * @brief Adds the reaction terms to a residual
+	 * @details Computes @f$ \text{res} = \text{res} + \alpha S f @f$, where @f$ S @f$ is the stoichiometric matrix.
+	 * @param [in] stoich Compressed stoichiometric matrix
+	 * @param [in] fluxes Reaction rates
+	 * @param [in] factor Factor @f$ \alpha @f$ in front of the reaction terms
+	 * @param [in,out] res Residual
+	 */
+	template <typename ResidualType, typename flux_t, typename FactorType>
+	inline void addReactionTerms(const CompressedReactionMatrix& stoich, flux_t const* fluxes, const FactorType& factor, ResidualType* res)
+	{
+		for (int r = 0; r < stoich.numReactions(); ++r)
 		{
-			if (cadet_unlikely(expSolid.native(c, idxReaction) != 0.0))
-				return rate;
+			for (int k = stoich.start[r]; k < stoich.start[r + 1]; ++k)
+				res[stoich.row[k]] += factor * static_cast<typename DoubleDemoter<ResidualType>::type>(*stoich.value[k]) * static_cast<typename DoubleActiveDemoter<ResidualType, flux_t>::type>(fluxes[r]);
 		}
-		return 0.0;
 	}
 }
 
@@ -303,7 +484,7 @@ class MassActionLawReactionBase : public DynamicReactionModelBase
 {
 public:
 
-	MassActionLawReactionBase() { }
+	MassActionLawReactionBase() : _logSpace(false) { }
 	virtual ~MassActionLawReactionBase() CADET_NOEXCEPT { }
 
 	static const char* identifier() { return ParamHandler_t::identifier(); }
@@ -312,6 +493,32 @@ public:
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { _paramHandler.setExternalFunctions(extFuns, size); }
 	virtual bool dependsOnTime() const CADET_NOEXCEPT { return ParamHandler_t::dependsOnTime(); }
 	virtual bool requiresWorkspace() const CADET_NOEXCEPT { return true; }
+
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT
+	{
+		if (ParamHandler_t::dependsOnTime())
+			return false;
+
+		for (int r = 0; r < _stoichiometryBulk.columns(); ++r)
+		{
+			if (!isAffineRate(r, _expBulkFwd, _nComp, _expBulkFwd, 0) || !isAffineRate(r, _expBulkBwd, _nComp, _expBulkBwd, 0))
+				return false;
+		}
+
+		for (int r = 0; r < _stoichiometryLiquid.columns(); ++r)
+		{
+			if (!isAffineRate(r, _expLiquidFwd, _nComp, _expLiquidFwdSolid, _nTotalBoundStates) || !isAffineRate(r, _expLiquidBwd, _nComp, _expLiquidBwdSolid, _nTotalBoundStates))
+				return false;
+		}
+
+		for (int r = 0; r < _stoichiometrySolid.columns(); ++r)
+		{
+			if (!isAffineRate(r, _expSolidFwd, _nTotalBoundStates, _expSolidFwdLiquid, _nComp) || !isAffineRate(r, _expSolidBwd, _nTotalBoundStates, _expSolidBwdLiquid, _nComp))
+				return false;
+		}
+
+		return true;
+	}
 	virtual unsigned int workspaceSize(unsigned int nComp, unsigned int totalNumBoundStates, unsigned int const* nBoundStates) const CADET_NOEXCEPT
 	{
 		return _paramHandler.cacheSize(maxNumReactions(), nComp, totalNumBoundStates) + std::max(maxNumReactions() * sizeof(active), 2 * (_nComp + totalNumBoundStates) * sizeof(double));
@@ -375,6 +582,18 @@ public:
 	virtual unsigned int numReactionsLiquid() const CADET_NOEXCEPT { return _stoichiometryBulk.columns(); }
 	virtual unsigned int numReactionsCombined() const CADET_NOEXCEPT { return _stoichiometryLiquid.columns() + _stoichiometrySolid.columns(); }
 
+	using DynamicReactionModelBase::setParameter;
+
+	virtual bool setParameter(const ParameterId& pId, double value)
+	{
+		if (!DynamicReactionModelBase::setParameter(pId, value))
+			return false;
+
+		// Entries of the stoichiometric or exponent matrices may have changed from or to zero
+		compileReactions();
+		return true;
+	}
+
 	CADET_DYNAMICREACTIONMODEL_BOILERPLATE
 
 protected:
@@ -396,9 +615,33 @@ protected:
 	linalg::ActiveDenseMatrix _expSolidFwdLiquid;
 	linalg::ActiveDenseMatrix _expSolidBwdLiquid;
 
+	CompressedReactionMatrix _nzStoichiometryBulk; //!< Nonzero entries of the bulk stoichiometric matrix
+	CompressedReactionMatrix _nzRateBulkFwd; //!< Participants of the forward bulk rate laws
+	CompressedReactionMatrix _nzRateBulkBwd; //!< Participants of the backward bulk rate laws
+
+	CompressedReactionMatrix _nzStoichiometryLiquid; //!< Nonzero entries of the particle liquid phase stoichiometric matrix
+	CompressedReactionMatrix _nzRateLiquidFwd; //!< Participants of the forward particle liquid phase rate laws (liquid, solid)
+	CompressedReactionMatrix _nzRateLiquidBwd; //!< Participants of the backward particle liquid phase rate laws (liquid, solid)
+
+	CompressedReactionMatrix _nzStoichiometrySolid; //!< Nonzero entries of the solid phase stoichiometric matrix
+	CompressedReactionMatrix _nzRateSolidFwd; //!< Participants of the forward solid phase rate laws (liquid, solid)
+	CompressedReactionMatrix _nzRateSolidBwd; //!< Participants of the backward solid phase rate laws (liquid, solid)
+
+	bool _logSpace; //!< Determines whether rate laws are evaluated in log-space
+
 	inline int maxNumReactions() const CADET_NOEXCEPT { return std::max(std::max(_stoichiometryBulk.columns(), _stoichiometryLiquid.columns()), _stoichiometrySolid.columns()); }
 
 	virtual bool configureImpl(IParameterProvider& paramProvider, UnitOpIdx unitOpIdx, ParticleTypeIdx parTypeIdx)
+	{
+		const bool result = configureMatrices(paramProvider, unitOpIdx, parTypeIdx);
+
+		_logSpace = paramProvider.exists("MAL_LOG_SPACE") && paramProvider.getBool("MAL_LOG_SPACE");
+
+		compileReactions();
+		return result;
+	}
+
+	bool configureMatrices(IParameterProvider& paramProvider, UnitOpIdx unitOpIdx, ParticleTypeIdx parTypeIdx)
 	{
 		_paramHandler.configure(paramProvider, maxNumReactions(), _nComp, _nBoundStates);
 		_paramHandler.registerParameters(_parameters, unitOpIdx, parTypeIdx, _nComp, _nBoundStates);
@@ -560,43 +803,13 @@ protected:
 		BufferedArray<flux_t> fluxes = workSpace.array<flux_t>(maxNumReactions());
 		for (int r = 0; r < _stoichiometryBulk.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdBulk[r]), r, _expBulkFwd, _nComp);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expBulkFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(y[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(y[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expBulkFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdBulk[r]), r, _expBulkBwd, _nComp);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expBulkBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(y[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(y[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expBulkBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateBulkFwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdBulk[r]), y, nullptr, _logSpace);
+			const flux_t bwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateBulkBwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdBulk[r]), y, nullptr, _logSpace);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to residual
-		_stoichiometryBulk.multiplyVector(static_cast<flux_t*>(fluxes), factor, res);
+		addReactionTerms(_nzStoichiometryBulk, static_cast<flux_t*>(fluxes), factor, res);
 
 		return 0;
 	}
@@ -612,71 +825,13 @@ protected:
 		BufferedArray<flux_t> fluxes = workSpace.array<flux_t>(maxNumReactions());
 		for (int r = 0; r < _stoichiometryLiquid.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdLiquid[r]), r, _expLiquidFwd, _expLiquidFwdSolid, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expLiquidFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expLiquidFwdSolid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidFwdSolid.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdLiquid[r]), r, _expLiquidBwd, _expLiquidBwdSolid, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expLiquidBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expLiquidBwdSolid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expLiquidBwdSolid.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateLiquidFwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdLiquid[r]), yLiquid, ySolid, _logSpace);
+			const flux_t bwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateLiquidBwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdLiquid[r]), yLiquid, ySolid, _logSpace);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to liquid phase residual
-		_stoichiometryLiquid.multiplyVector(static_cast<flux_t*>(fluxes), factor, resLiquid);
+		addReactionTerms(_nzStoichiometryLiquid, static_cast<flux_t*>(fluxes), factor, resLiquid);
 
 		if (_nTotalBoundStates == 0)
 			return 0;
@@ -684,71 +839,13 @@ protected:
 		// Calculate fluxes in solid phase
 		for (int r = 0; r < _stoichiometrySolid.columns(); ++r)
 		{
-			flux_t fwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdSolid[r]), r, _expSolidFwdLiquid, _expSolidFwd, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expSolidFwdLiquid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidFwdLiquid.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expSolidFwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						fwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidFwd.native(c, r)));
-					else
-					{
-						fwd *= 0.0;
-						break;
-					}
-				}
-			}
-
-			flux_t bwd = rateConstantOrZero(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdSolid[r]), r, _expSolidBwdLiquid, _expSolidBwd, _nComp, _nTotalBoundStates);
-			for (int c = 0; c < _nComp; ++c)
-			{
-				if (_expSolidBwdLiquid.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(yLiquid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(yLiquid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidBwdLiquid.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-			for (int c = 0; c < _nTotalBoundStates; ++c)
-			{
-				if (_expSolidBwd.native(c, r) != 0.0)
-				{
-					if (static_cast<double>(ySolid[c]) > 0.0)
-						bwd *= pow(static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(ySolid[c]),
-							static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(_expSolidBwd.native(c, r)));
-					else
-					{
-						bwd *= 0.0;
-						break;
-					}
-				}
-			}
-
+			const flux_t fwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateSolidFwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kFwdSolid[r]), yLiquid, ySolid, _logSpace);
+			const flux_t bwd = evaluateRateLaw<flux_t, ParamType, StateType>(_nzRateSolidBwd, r, static_cast<typename DoubleActiveDemoter<flux_t, active>::type>(p->kBwdSolid[r]), yLiquid, ySolid, _logSpace);
 			fluxes[r] = fwd - bwd;
 		}
 
 		// Add reaction terms to solid phase residual
-		_stoichiometrySolid.multiplyVector(static_cast<flux_t*>(fluxes), factor, resSolid);
+		addReactionTerms(_nzStoichiometrySolid, static_cast<flux_t*>(fluxes), factor, resSolid);
 
 		return 0;
 	}
@@ -758,23 +855,17 @@ protected:
 	{
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
-		BufferedArray<double> fluxes = workSpace.array<double>(2 * _nComp);
-		double* const fluxGradFwd = static_cast<double*>(fluxes);
-		double* const fluxGradBwd = fluxGradFwd + _nComp;
+		BufferedArray<double> buffer = workSpace.array<double>(2 * _nComp);
+		double* const fluxGrad = static_cast<double*>(buffer);
+		double* const factors = fluxGrad + _nComp;
 		for (int r = 0; r < _stoichiometryBulk.columns(); ++r)
 		{
-			// Calculate gradients of forward and backward fluxes
-			fluxGradLiquid(fluxGradFwd, r, _nComp, static_cast<double>(p->kFwdBulk[r]), _expBulkFwd, y);
-			fluxGradLiquid(fluxGradBwd, r, _nComp, static_cast<double>(p->kBwdBulk[r]), _expBulkBwd, y);
+			// Add gradients of forward and backward fluxes to Jacobian
+			rateLawGradient(fluxGrad, factors, _nzRateBulkFwd, r, static_cast<double>(p->kFwdBulk[r]), y, nullptr);
+			addRateLawJacobian(jac, _nzStoichiometryBulk, _nzRateBulkFwd, r, fluxGrad, factor, _nComp, 0);
 
-			// Add gradients to Jacobian
-			RowIterator curJac = jac;
-			for (int row = 0; row < _nComp; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometryBulk.native(row, r)) * factor;
-				for (int col = 0; col < _nComp; ++col)
-					curJac[col - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			rateLawGradient(fluxGrad, factors, _nzRateBulkBwd, r, static_cast<double>(p->kBwdBulk[r]), y, nullptr);
+			addRateLawJacobian(jac, _nzStoichiometryBulk, _nzRateBulkBwd, r, fluxGrad, -factor, _nComp, 0);
 		}
 	}
 
@@ -783,24 +874,18 @@ protected:
 	{
 		typename ParamHandler_t::ParamsHandle const p = _paramHandler.update(t, secIdx, colPos, _nComp, _nBoundStates, workSpace);
 
-		BufferedArray<double> fluxes = workSpace.array<double>(2 * (_nComp + _nTotalBoundStates));
-		double* const fluxGradFwd = static_cast<double*>(fluxes);
-		double* const fluxGradBwd = fluxGradFwd + _nComp + _nTotalBoundStates;
+		BufferedArray<double> buffer = workSpace.array<double>(2 * (_nComp + _nTotalBoundStates));
+		double* const fluxGrad = static_cast<double*>(buffer);
+		double* const factors = fluxGrad + _nComp + _nTotalBoundStates;
 
 		for (int r = 0; r < _stoichiometryLiquid.columns(); ++r)
 		{
-			// Calculate gradients of forward and backward fluxes
-			fluxGradCombined(fluxGradFwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kFwdLiquid[r]), _expLiquidFwd, _expLiquidFwdSolid, yLiquid, ySolid);
-			fluxGradCombined(fluxGradBwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kBwdLiquid[r]), _expLiquidBwd, _expLiquidBwdSolid, yLiquid, ySolid);
+			// Add gradients of forward and backward fluxes to Jacobian
+			rateLawGradient(fluxGrad, factors, _nzRateLiquidFwd, r, static_cast<double>(p->kFwdLiquid[r]), yLiquid, ySolid);
+			addRateLawJacobian(jacLiquid, _nzStoichiometryLiquid, _nzRateLiquidFwd, r, fluxGrad, factor, _nComp, 0);
 
-			// Add gradients to Jacobian
-			RowIteratorLiquid curJac = jacLiquid;
-			for (int row = 0; row < _nComp; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometryLiquid.native(row, r)) * factor;
-				for (int col = 0; col < _nComp + _nTotalBoundStates; ++col)
-					curJac[col - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			rateLawGradient(fluxGrad, factors, _nzRateLiquidBwd, r, static_cast<double>(p->kBwdLiquid[r]), yLiquid, ySolid);
+			addRateLawJacobian(jacLiquid, _nzStoichiometryLiquid, _nzRateLiquidBwd, r, fluxGrad, -factor, _nComp, 0);
 		}
 
 		if (_nTotalBoundStates == 0)
@@ -808,20 +893,33 @@ protected:
 
 		for (int r = 0; r < _stoichiometrySolid.columns(); ++r)
 		{
-			// Calculate gradients of forward and backward fluxes
-			fluxGradCombined(fluxGradFwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kFwdSolid[r]), _expSolidFwdLiquid, _expSolidFwd, yLiquid, ySolid);
-			fluxGradCombined(fluxGradBwd, r, _nComp, _nTotalBoundStates, static_cast<double>(p->kBwdSolid[r]), _expSolidBwdLiquid, _expSolidBwd, yLiquid, ySolid);
+			// Add gradients of forward and backward fluxes to Jacobian
+			rateLawGradient(fluxGrad, factors, _nzRateSolidFwd, r, static_cast<double>(p->kFwdSolid[r]), yLiquid, ySolid);
+			addRateLawJacobian(jacSolid, _nzStoichiometrySolid, _nzRateSolidFwd, r, fluxGrad, factor, _nComp, -static_cast<int>(_nComp));
 
-			// Add gradients to Jacobian
-			RowIteratorSolid curJac = jacSolid;
-			for (int row = 0; row < _nTotalBoundStates; ++row, ++curJac)
-			{
-				const double colFactor = static_cast<double>(_stoichiometrySolid.native(row, r)) * factor;
-				for (int col = 0; col < _nComp + _nTotalBoundStates; ++col)
-					curJac[col - static_cast<int>(_nComp) - static_cast<int>(row)] += colFactor * (fluxGradFwd[col] - fluxGradBwd[col]);
-			}
+			rateLawGradient(fluxGrad, factors, _nzRateSolidBwd, r, static_cast<double>(p->kBwdSolid[r]), yLiquid, ySolid);
+			addRateLawJacobian(jacSolid, _nzStoichiometrySolid, _nzRateSolidBwd, r, fluxGrad, -factor, _nComp, -static_cast<int>(_nComp));
 		}
 	}
+
+	/**
+	 * @brief Extracts the nonzero entries of the stoichiometric and exponent matrices
+	 * @details Has to be called whenever the matrices have been changed.
+	 */
+	void compileReactions()
+	{
+		_nzStoichiometryBulk.compile(_stoichiometryBulk, nullptr);
+		_nzRateBulkFwd.compile(_expBulkFwd, nullptr);
+		_nzRateBulkBwd.compile(_expBulkBwd, nullptr);
+
+		_nzStoichiometryLiquid.compile(_stoichiometryLiquid, nullptr);
+		_nzRateLiquidFwd.compile(_expLiquidFwd, &_expLiquidFwdSolid);
+		_nzRateLiquidBwd.compile(_expLiquidBwd, &_expLiquidBwdSolid);
+
+		_nzStoichiometrySolid.compile(_stoichiometrySolid, nullptr);
+		_nzRateSolidFwd.compile(_expSolidFwdLiquid, &_expSolidFwd);
+		_nzRateSolidBwd.compile(_expSolidBwdLiquid, &_expSolidBwd);
+	}
 };
 
 typedef MassActionLawReactionBase<MassActionLawParamHandler> MassActionLawReaction;
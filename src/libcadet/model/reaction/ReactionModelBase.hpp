@@ -58,6 +58,8 @@ public:
 
 	virtual void setExternalFunctions(IExternalFunction** extFuns, unsigned int size) { }
 
+	virtual bool hasConstantJacobian() const CADET_NOEXCEPT { return false; }
+
 protected:
 	int _nComp; //!< Number of components
 	unsigned int const* _nBoundStates; //!< Array with number of bound states for each component
@@ -0,0 +1,145 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "nonlin/AndersonAcceleration.hpp"
+#include "linalg/DenseMatrix.hpp"
+
+#include <algorithm>
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+AndersonAcceleration::AndersonAcceleration() : _size(0), _depth(0), _numHistory(0), _head(0), _hasPrev(false) { }
+
+void AndersonAcceleration::resize(unsigned int size, unsigned int depth)
+{
+	_size = size;
+	_depth = depth;
+
+	_dF.resize(static_cast<std::size_t>(size) * depth);
+	_dG.resize(static_cast<std::size_t>(size) * depth);
+	_prevF.resize(size);
+	_prevG.resize(size);
+	_f.resize(size);
+
+	reset();
+}
+
+void AndersonAcceleration::reset()
+{
+	_numHistory = 0;
+	_head = 0;
+	_hasPrev = false;
+}
+
+void AndersonAcceleration::next(double* const x, double const* const gx)
+{
+	for (unsigned int i = 0; i < _size; ++i)
+		_f[i] = gx[i] - x[i];
+
+	if (_depth > 0)
+	{
+		if (_hasPrev)
+		{
+			// Append differences to history, overwrite oldest entry if full
+			unsigned int slot = 0;
+			if (_numHistory < _depth)
+			{
+				slot = (_head + _numHistory) % _depth;
+				++_numHistory;
+			}
+			else
+			{
+				slot = _head;
+				_head = (_head + 1) % _depth;
+			}
+
+			double* const dF = _dF.data() + static_cast<std::size_t>(slot) * _size;
+			double* const dG = _dG.data() + static_cast<std::size_t>(slot) * _size;
+			for (unsigned int i = 0; i < _size; ++i)
+			{
+				dF[i] = _f[i] - _prevF[i];
+				dG[i] = gx[i] - _prevG[i];
+			}
+		}
+
+		std::copy(_f.begin(), _f.end(), _prevF.begin());
+		std::copy(gx, gx + _size, _prevG.begin());
+		_hasPrev = true;
+	}
+
+	// Start with plain fixed-point step
+	std::copy(gx, gx + _size, x);
+
+	if (_numHistory == 0)
+		return;
+
+	// Assemble normal equations (dF^T dF) gamma = dF^T f
+	const unsigned int m = _numHistory;
+	linalg::DenseMatrix normalMat;
+	normalMat.resize(m, m);
+	std::vector<double> gamma(m, 0.0);
+
+	double trace = 0.0;
+	for (unsigned int r = 0; r < m; ++r)
+	{
+		double const* const colR = _dF.data() + static_cast<std::size_t>((_head + r) % _depth) * _size;
+		for (unsigned int c = r; c < m; ++c)
+		{
+			double const* const colC = _dF.data() + static_cast<std::size_t>((_head + c) % _depth) * _size;
+			double dot = 0.0;
+			for (unsigned int i = 0; i < _size; ++i)
+				dot += colR[i] * colC[i];
+
+			normalMat.native(r, c) = dot;
+			normalMat.native(c, r) = dot;
+		}
+
+		trace += normalMat.native(r, r);
+
+		double dot = 0.0;
+		for (unsigned int i = 0; i < _size; ++i)
+			dot += colR[i] * _f[i];
+		gamma[r] = dot;
+	}
+
+	// Zero differences carry no information
+	if (trace <= 0.0)
+		return;
+
+	// Tikhonov regularization guards against (nearly) linearly dependent differences
+	const double reg = 1e-12 * trace;
+	for (unsigned int r = 0; r < m; ++r)
+		normalMat.native(r, r) += reg;
+
+	if (!normalMat.factorize() || !normalMat.solve(gamma.data()))
+	{
+		// Fall back to plain fixed-point step and start over
+		reset();
+		return;
+	}
+
+	for (unsigned int j = 0; j < m; ++j)
+	{
+		double const* const dG = _dG.data() + static_cast<std::size_t>((_head + j) % _depth) * _size;
+		const double g = gamma[j];
+		for (unsigned int i = 0; i < _size; ++i)
+			x[i] -= g * dG[i];
+	}
+}
+
+} // namespace nonlin
+
+} // namespace cadet
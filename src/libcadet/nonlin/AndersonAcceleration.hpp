@@ -0,0 +1,89 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides Anderson acceleration of fixed-point iterations
+ */
+
+#ifndef LIBCADET_ANDERSONACCELERATION_HPP_
+#define LIBCADET_ANDERSONACCELERATION_HPP_
+
+#include <vector>
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+	/**
+	 * @brief Accelerates the fixed-point iteration @f$ x_{k+1} = G(x_k) @f$ by Anderson mixing
+	 * @details The next iterate is a combination of the last @f$ m @f$ map values that minimizes
+	 *          the linearized fixed-point residual @f$ f = G(x) - x @f$ (Walker and Ni, 2011):
+	 *          @f[ x_{k+1} = G(x_k) - \sum_{j} \gamma_j \Delta G_j, \qquad \gamma = \text{argmin} \lVert f_k - \Delta F \gamma \rVert_2. @f]
+	 *          The small least squares problem is solved via regularized normal equations.
+	 *          A depth of @c 0 results in plain successive substitution.
+	 */
+	class AndersonAcceleration
+	{
+	public:
+		AndersonAcceleration();
+
+		/**
+		 * @brief Allocates memory and clears the history
+		 * @param [in] size Number of unknowns
+		 * @param [in] depth Maximum number of stored differences
+		 */
+		void resize(unsigned int size, unsigned int depth);
+
+		/**
+		 * @brief Drops all stored differences
+		 * @details The next call to next() performs a plain fixed-point step.
+		 */
+		void reset();
+
+		/**
+		 * @brief Computes the next iterate from the current iterate and its map value
+		 * @param [in,out] x On entry current iterate @f$ x_k @f$, on exit next iterate @f$ x_{k+1} @f$
+		 * @param [in] gx Map value @f$ G(x_k) @f$
+		 */
+		void next(double* const x, double const* const gx);
+
+		/**
+		 * @brief Returns the number of differences currently used for mixing
+		 * @return Number of stored differences
+		 */
+		inline unsigned int historySize() const { return _numHistory; }
+
+		inline unsigned int depth() const { return _depth; }
+		inline unsigned int size() const { return _size; }
+
+	protected:
+		unsigned int _size; //!< Number of unknowns
+		unsigned int _depth; //!< Maximum number of stored differences
+		unsigned int _numHistory; //!< Number of currently stored differences
+		unsigned int _head; //!< Ring buffer index of the oldest stored difference
+		bool _hasPrev; //!< Determines whether @a _prevF and @a _prevG are valid
+
+		std::vector<double> _dF; //!< Residual differences (column-wise ring buffer)
+		std::vector<double> _dG; //!< Map value differences (column-wise ring buffer)
+		std::vector<double> _prevF; //!< Residual of the previous iterate
+		std::vector<double> _prevG; //!< Map value of the previous iterate
+		std::vector<double> _f; //!< Residual of the current iterate
+	};
+
+} // namespace nonlin
+
+} // namespace cadet
+
+#endif // LIBCADET_ANDERSONACCELERATION_HPP_
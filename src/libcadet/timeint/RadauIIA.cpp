@@ -0,0 +1,695 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "timeint/RadauIIA.hpp"
+#include "SimulatableModel.hpp"
+
+#include "Logging.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	const double uround = std::numeric_limits<double>::epsilon();
+	const double sqrt6 = std::sqrt(6.0);
+
+	// Collocation nodes
+	const double c1 = (4.0 - sqrt6) / 10.0;
+	const double c2 = (4.0 + sqrt6) / 10.0;
+	const double c1m1 = c1 - 1.0;
+	const double c2m1 = c2 - 1.0;
+	const double c1mc2 = c1 - c2;
+	const double nodes[3] = {c1, c2, 1.0};
+
+	// Coefficients of the embedded error estimator
+	const double dd1 = -(13.0 + 7.0 * sqrt6) / 3.0;
+	const double dd2 = (-13.0 + 7.0 * sqrt6) / 3.0;
+	const double dd3 = -1.0 / 3.0;
+
+	// Eigenvalues of the inverse Butcher matrix: gamma and alpha +/- i beta
+	const double gammaRe = 30.0 / (6.0 + std::cbrt(81.0) - std::cbrt(9.0));
+	const double alphaRe = (12.0 - std::cbrt(81.0) + std::cbrt(9.0)) / 60.0;
+	const double betaIm = (std::cbrt(81.0) + std::cbrt(9.0)) * std::sqrt(3.0) / 60.0;
+	const double alphaBetaNorm = alphaRe * alphaRe + betaIm * betaIm;
+	const double alpha = alphaRe / alphaBetaNorm;
+	const double beta = betaIm / alphaBetaNorm;
+
+	// Inverse of the Butcher matrix A
+	const double ai[3][3] = {
+		{ 3.2247448713915890491,  1.1678400846904058, -0.2531972647421809},
+		{-3.5678400846904057,  0.7752551286084112, 1.053197264742181},
+		{ 5.531972647421811, -7.531972647421811,  5.0}
+	};
+
+	// Transformation T and its inverse with T^{-1} A^{-1} T = [gamma, 0, 0; 0, alpha, -beta; 0, beta, alpha]
+	const double tr[3][3] = {
+		{9.1232394870892942792e-02, -0.14125529502095420843, -3.0029194105147424492e-02},
+		{0.24171793270710701896, 0.20412935229379993199, 0.38294211275726193779},
+		{0.96604818261509293619, 1.0, 0.0}
+	};
+	const double ti[3][3] = {
+		{4.3255798900631553510, 0.33919925181580986954, 0.54177053993587487119},
+		{-4.1787185915519047273, -0.32768282076106238708, 0.47662355450055045196},
+		{-0.50287263494578687595, 2.5719269498556054292, -0.59603920482822492497}
+	};
+
+	// Step size control (see RADAU5)
+	const unsigned int maxNewtonIter = 7;
+	const double safetyFactor = 0.9;
+	const double minStepRatio = 0.2;
+	const double maxStepRatio = 8.0;
+	const double jacobianReuseContraction = 1e-3;
+	const double keepStepMinRatio = 1.0;
+	const double keepStepMaxRatio = 1.2;
+	const unsigned int maxKrylovDim = 20;
+}
+
+namespace cadet
+{
+
+namespace timeint
+{
+
+const char* to_string(RadauStepResult res) CADET_NOEXCEPT
+{
+	switch (res)
+	{
+		case RadauStepResult::Success:
+			return "RADAU_SUCCESS";
+		case RadauStepResult::ResidualFailure:
+			return "RADAU_RES_FAIL";
+		case RadauStepResult::LinearSolverFailure:
+			return "RADAU_LSOLVE_FAIL";
+		case RadauStepResult::TooManyErrorTestFailures:
+			return "RADAU_ERR_FAIL";
+		case RadauStepResult::TooManyConvergenceFailures:
+			return "RADAU_CONV_FAIL";
+		case RadauStepResult::StepSizeTooSmall:
+			return "RADAU_TOO_SMALL_STEP";
+		case RadauStepResult::TooManySteps:
+			return "RADAU_TOO_MUCH_WORK";
+	}
+	return "RADAU_UNKNOWN";
+}
+
+RadauIIA::RadauIIA() : _model(nullptr), _adJac{nullptr, nullptr, 0}, _nDof(0), _relTol(0.0), _newtonTol(0.03), _maxStepSize(0.0),
+	_maxSteps(500), _maxErrorTestFails(7), _maxConvFails(10), _t(0.0), _h(0.0), _hLast(0.0), _hJac(0.0), _contraction(0.0),
+	_faccon(1.0), _havePolynomial(false), _rejected(false), _stepsSinceRestart(0), _lastNewtonIter(0), _jacT(0.0), _gmresShiftRe(0.0), _gmresShiftIm(0.0)
+{
+	clearStatistics();
+}
+
+RadauIIA::~RadauIIA() CADET_NOEXCEPT
+{
+}
+
+void RadauIIA::initialize(ISimulatableModel* model, SectionLookup secLookup, const AdJacobianParams& adJac)
+{
+	_model = model;
+	_secLookup = secLookup;
+	_adJac = adJac;
+
+	const unsigned int nDof = _model->numDofs();
+	if (nDof != _nDof)
+	{
+		_nDof = nDof;
+
+		_y.resize(_nDof);
+		_yDot.resize(_nDof);
+		_weight.resize(_nDof);
+		_absTol.resize(_nDof, 0.0);
+		_z.resize(3 * _nDof);
+		_w.resize(3 * _nDof);
+		_dw.resize(3 * _nDof);
+		_cont.resize(3 * _nDof);
+		_stageY.resize(_nDof);
+		_stageYdot.resize(_nDof);
+		_res.resize(3 * _nDof);
+		_tmp.resize(_nDof);
+		_tmp2.resize(2 * _nDof);
+		_gmresRhs.resize(2 * _nDof);
+		_gmresWeight.resize(2 * _nDof);
+
+		_gmres.initialize(2 * _nDof, std::min(2 * _nDof, maxKrylovDim));
+		_gmres.matrixVectorMultiplier([this](void* userData, double const* x, double* z) -> int { return complexBlockMatVec(x, z); });
+	}
+}
+
+void RadauIIA::setTolerances(double relTol, double const* absTol)
+{
+	// The error estimator is of order 3, so the tolerances are adapted as in RADAU5
+	if (relTol > 0.0)
+	{
+		_relTol = 0.1 * std::pow(relTol, 2.0 / 3.0);
+		for (unsigned int i = 0; i < _nDof; ++i)
+			_absTol[i] = _relTol * absTol[i] / relTol;
+
+		_newtonTol = std::max(10.0 * uround / _relTol, std::min(0.03, std::sqrt(_relTol)));
+	}
+	else
+	{
+		_relTol = 0.0;
+		std::copy_n(absTol, _nDof, _absTol.begin());
+		_newtonTol = 0.03;
+	}
+}
+
+void RadauIIA::setLimits(double maxStepSize, unsigned int maxSteps, unsigned int maxErrorTestFails, unsigned int maxConvFails)
+{
+	_maxStepSize = maxStepSize;
+	_maxSteps = (maxSteps > 0) ? maxSteps : 500;
+	_maxErrorTestFails = maxErrorTestFails;
+	_maxConvFails = maxConvFails;
+}
+
+void RadauIIA::clearStatistics() CADET_NOEXCEPT
+{
+	_stats = RadauStatistics{0, 0, 0, 0, 0, 0, 0, 0};
+}
+
+void RadauIIA::reset(double t, double const* y, double const* yDot, double stepSize)
+{
+	_t = t;
+	std::copy_n(y, _nDof, _y.begin());
+	std::copy_n(yDot, _nDof, _yDot.begin());
+
+	_h = stepSize;
+	_hLast = 0.0;
+	_hJac = 0.0;
+	_faccon = 1.0;
+	_contraction = 0.0;
+	_havePolynomial = false;
+	_rejected = false;
+	_stepsSinceRestart = 0;
+
+	++_stats.numRestarts;
+}
+
+void RadauIIA::updateWeights()
+{
+	for (unsigned int i = 0; i < _nDof; ++i)
+		_weight[i] = 1.0 / (_absTol[i] + _relTol * std::abs(_y[i]));
+
+	std::copy(_weight.begin(), _weight.end(), _gmresWeight.begin());
+	std::copy(_weight.begin(), _weight.end(), _gmresWeight.begin() + _nDof);
+}
+
+double RadauIIA::weightedNorm(double const* x) const
+{
+	double sum = 0.0;
+	for (unsigned int i = 0; i < _nDof; ++i)
+	{
+		const double v = x[i] * _weight[i];
+		sum += v * v;
+	}
+	return std::sqrt(sum / _nDof);
+}
+
+int RadauIIA::updateJacobian(double h)
+{
+	// Evaluate Jacobian at the beginning of the step, the model factorizes
+	// the iteration matrix in the next call to linearSolve()
+	const int flag = _model->residualWithJacobian(SimulationTime{_t, _secLookup(_t)}, ConstSimulationState{_y.data(), _yDot.data()}, _tmp.data(), _adJac);
+	++_stats.numJacobianEvals;
+
+	_jacT = _t;
+	_hJac = (flag == 0) ? h : 0.0;
+	return flag;
+}
+
+void RadauIIA::predictStages(double h)
+{
+	double* const z1 = _z.data();
+	double* const z2 = z1 + _nDof;
+	double* const z3 = z2 + _nDof;
+
+	if (_havePolynomial)
+	{
+		// Extrapolate collocation polynomial of last step
+		double const* const k1 = _cont.data();
+		double const* const k2 = k1 + _nDof;
+		double const* const k3 = k2 + _nDof;
+
+		const double q = h / _hLast;
+		const double s1 = c1 * q;
+		const double s2 = c2 * q;
+		const double s3 = q;
+		for (unsigned int i = 0; i < _nDof; ++i)
+		{
+			z1[i] = s1 * (k1[i] + (s1 - c2m1) * (k2[i] + (s1 - c1m1) * k3[i]));
+			z2[i] = s2 * (k1[i] + (s2 - c2m1) * (k2[i] + (s2 - c1m1) * k3[i]));
+			z3[i] = s3 * (k1[i] + (s3 - c2m1) * (k2[i] + (s3 - c1m1) * k3[i]));
+		}
+	}
+	else
+	{
+		// Start from the current state after a restart since extrapolating the
+		// time derivative across a discontinuity may leave the physical domain
+		std::fill(_z.begin(), _z.end(), 0.0);
+	}
+
+	double* const w1 = _w.data();
+	double* const w2 = w1 + _nDof;
+	double* const w3 = w2 + _nDof;
+	for (unsigned int i = 0; i < _nDof; ++i)
+	{
+		w1[i] = ti[0][0] * z1[i] + ti[0][1] * z2[i] + ti[0][2] * z3[i];
+		w2[i] = ti[1][0] * z1[i] + ti[1][1] * z2[i] + ti[1][2] * z3[i];
+		w3[i] = ti[2][0] * z1[i] + ti[2][1] * z2[i] + ti[2][2] * z3[i];
+	}
+}
+
+int RadauIIA::complexBlockMatVec(double const* x, double* z)
+{
+	// Computes the left preconditioned operator
+	//   [u; v] -> [u; v] + M_gamma^{-1} [d J u - e J v; e J u + d J v],
+	// where J denotes the time derivative Jacobian
+	const SimulationTime simTime{_jacT, _secLookup(_jacT)};
+	const ConstSimulationState simState{_y.data(), _yDot.data()};
+
+	double const* const u = x;
+	double const* const v = x + _nDof;
+	double* const ju = _tmp.data();
+	double* const jv = _stageY.data();
+
+	_model->multiplyWithDerivativeJacobian(simTime, simState, u, ju);
+	_model->multiplyWithDerivativeJacobian(simTime, simState, v, jv);
+	++_stats.numGmresIterations;
+
+	for (unsigned int i = 0; i < _nDof; ++i)
+	{
+		z[i] = _gmresShiftRe * ju[i] - _gmresShiftIm * jv[i];
+		z[i + _nDof] = _gmresShiftIm * ju[i] + _gmresShiftRe * jv[i];
+	}
+
+	const double alphaJac = gammaRe / _hJac;
+	int flag = _model->linearSolve(_jacT, alphaJac, _newtonTol, z, _weight.data(), simState);
+	if (flag != 0)
+		return flag;
+
+	flag = _model->linearSolve(_jacT, alphaJac, _newtonTol, z + _nDof, _weight.data(), simState);
+	if (flag != 0)
+		return flag;
+
+	for (unsigned int i = 0; i < 2 * _nDof; ++i)
+		z[i] += x[i];
+
+	return 0;
+}
+
+int RadauIIA::solveComplexBlock(double h, double* rhsRe, double* rhsIm)
+{
+	const ConstSimulationState simState{_y.data(), _yDot.data()};
+	const double alphaJac = gammaRe / h;
+
+	// Apply preconditioner to right hand side
+	std::copy_n(rhsRe, _nDof, _gmresRhs.begin());
+	std::copy_n(rhsIm, _nDof, _gmresRhs.begin() + _nDof);
+
+	int flag = _model->linearSolve(_jacT, alphaJac, _newtonTol, _gmresRhs.data(), _weight.data(), simState);
+	if (flag != 0)
+		return flag;
+
+	flag = _model->linearSolve(_jacT, alphaJac, _newtonTol, _gmresRhs.data() + _nDof, _weight.data(), simState);
+	if (flag != 0)
+		return flag;
+
+	// Preconditioned right hand side is the solution of the system without shift and serves as initial guess
+	std::copy(_gmresRhs.begin(), _gmresRhs.end(), _tmp2.begin());
+
+	_gmresShiftRe = (alpha - gammaRe) / h;
+	_gmresShiftIm = beta / h;
+	flag = _gmres.solve(0.05 * _newtonTol * std::sqrt(2.0 * _nDof), _gmresWeight.data(), _gmresRhs.data(), _tmp2.data());
+
+	std::copy_n(_tmp2.begin(), _nDof, rhsRe);
+	std::copy_n(_tmp2.begin() + _nDof, _nDof, rhsIm);
+
+	// Positive return values indicate that GMRES has not fully converged, which is handled by the Newton iteration
+	return std::min(flag, 0);
+}
+
+RadauIIA::NewtonResult RadauIIA::solveStages(double h, int& flag, double& hFactor)
+{
+	double* const z1 = _z.data();
+	double* const z2 = z1 + _nDof;
+	double* const z3 = z2 + _nDof;
+	double* const w1 = _w.data();
+	double* const w2 = w1 + _nDof;
+	double* const w3 = w2 + _nDof;
+	double* const dw1 = _dw.data();
+	double* const dw2 = dw1 + _nDof;
+	double* const dw3 = dw2 + _nDof;
+
+	const ConstSimulationState simState{_y.data(), _yDot.data()};
+
+	double faccon = std::pow(std::max(_faccon, uround), 0.8);
+	double theta = jacobianReuseContraction;
+	double dynoOld = 0.0;
+	double thqOld = 0.0;
+	hFactor = 0.5;
+	flag = 0;
+
+	for (unsigned int newt = 0; newt < maxNewtonIter; ++newt)
+	{
+		// Stage residuals
+		for (unsigned int k = 0; k < 3; ++k)
+		{
+			double const* const zk = _z.data() + k * _nDof;
+			for (unsigned int i = 0; i < _nDof; ++i)
+			{
+				_stageY[i] = _y[i] + zk[i];
+				_stageYdot[i] = (ai[k][0] * z1[i] + ai[k][1] * z2[i] + ai[k][2] * z3[i]) / h;
+			}
+
+			const double tStage = _t + nodes[k] * h;
+			flag = _model->residual(SimulationTime{tStage, _secLookup(tStage)}, ConstSimulationState{_stageY.data(), _stageYdot.data()}, _res.data() + k * _nDof);
+			++_stats.numResidualEvals;
+
+			if (flag < 0)
+				return NewtonResult::Failed;
+			else if (flag > 0)
+			{
+				flag = 0;
+				return NewtonResult::Diverged;
+			}
+		}
+
+		// Transform residuals
+		double const* const g1 = _res.data();
+		double const* const g2 = g1 + _nDof;
+		double const* const g3 = g2 + _nDof;
+		for (unsigned int i = 0; i < _nDof; ++i)
+		{
+			dw1[i] = -(ti[0][0] * g1[i] + ti[0][1] * g2[i] + ti[0][2] * g3[i]);
+			dw2[i] = -(ti[1][0] * g1[i] + ti[1][1] * g2[i] + ti[1][2] * g3[i]);
+			dw3[i] = -(ti[2][0] * g1[i] + ti[2][1] * g2[i] + ti[2][2] * g3[i]);
+		}
+
+		// Solve real and complex block
+		flag = _model->linearSolve(_jacT, gammaRe / h, _newtonTol, dw1, _weight.data(), simState);
+		if (flag == 0)
+			flag = solveComplexBlock(h, dw2, dw3);
+
+		if (flag < 0)
+			return NewtonResult::Failed;
+		else if (flag > 0)
+		{
+			flag = 0;
+			return NewtonResult::Diverged;
+		}
+
+		++_stats.numNewtonIterations;
+
+		const double n1 = weightedNorm(dw1);
+		const double n2 = weightedNorm(dw2);
+		const double n3 = weightedNorm(dw3);
+		const double dyno = std::sqrt((n1 * n1 + n2 * n2 + n3 * n3) / 3.0);
+
+		if (!std::isfinite(dyno))
+			return NewtonResult::Diverged;
+
+		// Estimate rate of convergence
+		if ((newt > 0) && (newt + 1 < maxNewtonIter))
+		{
+			const double thq = dyno / dynoOld;
+			theta = (newt == 1) ? thq : std::sqrt(thq * thqOld);
+			thqOld = thq;
+
+			if (theta < 0.99)
+			{
+				faccon = theta / (1.0 - theta);
+				const double remainingIter = static_cast<double>(maxNewtonIter - 1 - newt);
+				const double dyth = faccon * dyno * std::pow(theta, remainingIter) / _newtonTol;
+				if (dyth >= 1.0)
+				{
+					// Convergence is too slow, so reduce step size
+					const double qNewt = std::max(1e-4, std::min(20.0, dyth));
+					hFactor = 0.8 * std::pow(qNewt, -1.0 / (4.0 + remainingIter));
+					return NewtonResult::Diverged;
+				}
+			}
+			else
+			{
+				hFactor = 0.5;
+				return NewtonResult::Diverged;
+			}
+		}
+
+		dynoOld = std::max(dyno, uround);
+
+		for (unsigned int i = 0; i < _nDof; ++i)
+		{
+			w1[i] += dw1[i];
+			w2[i] += dw2[i];
+			w3[i] += dw3[i];
+
+			z1[i] = tr[0][0] * w1[i] + tr[0][1] * w2[i] + tr[0][2] * w3[i];
+			z2[i] = tr[1][0] * w1[i] + tr[1][1] * w2[i] + tr[1][2] * w3[i];
+			z3[i] = tr[2][0] * w1[i] + tr[2][1] * w2[i] + tr[2][2] * w3[i];
+		}
+
+		if (faccon * dyno <= _newtonTol)
+		{
+			_faccon = faccon;
+			_contraction = theta;
+			_lastNewtonIter = newt + 1;
+			return NewtonResult::Converged;
+		}
+	}
+
+	hFactor = 0.5;
+	return NewtonResult::Diverged;
+}
+
+double RadauIIA::estimateError(double h, bool refine, int& flag)
+{
+	double const* const z1 = _z.data();
+	double const* const z2 = z1 + _nDof;
+	double const* const z3 = z2 + _nDof;
+
+	const SimulationTime simTime{_jacT, _secLookup(_jacT)};
+	const ConstSimulationState simState{_y.data(), _yDot.data()};
+
+	// Right hand side J_yDot * (yDot + sum_i dd_i Z_i / h) of the embedded method
+	for (unsigned int i = 0; i < _nDof; ++i)
+		_stageYdot[i] = _yDot[i] + (dd1 * z1[i] + dd2 * z2[i] + dd3 * z3[i]) / h;
+
+	double* const rhs = _res.data();
+	double* const err = _res.data() + _nDof;
+	_model->multiplyWithDerivativeJacobian(simTime, simState, _stageYdot.data(), rhs);
+
+	std::copy_n(rhs, _nDof, err);
+	flag = _model->linearSolve(_jacT, gammaRe / h, _newtonTol, err, _weight.data(), simState);
+	if (flag != 0)
+		return 0.0;
+
+	double errNorm = weightedNorm(err);
+
+	// Improve estimate for stiff components after restarts and rejected steps
+	if ((errNorm >= 1.0) && refine)
+	{
+		for (unsigned int i = 0; i < _nDof; ++i)
+			_stageY[i] = _y[i] + err[i];
+
+		flag = _model->residual(SimulationTime{_t, _secLookup(_t)}, ConstSimulationState{_stageY.data(), _yDot.data()}, _tmp.data());
+		++_stats.numResidualEvals;
+		if (flag != 0)
+			return 0.0;
+
+		for (unsigned int i = 0; i < _nDof; ++i)
+			err[i] = rhs[i] - _tmp[i];
+
+		flag = _model->linearSolve(_jacT, gammaRe / h, _newtonTol, err, _weight.data(), simState);
+		if (flag != 0)
+			return 0.0;
+
+		errNorm = weightedNorm(err);
+	}
+
+	return std::max(errNorm, 1e-10);
+}
+
+RadauStepResult RadauIIA::step(double tStop)
+{
+	if (_stepsSinceRestart >= _maxSteps)
+		return RadauStepResult::TooManySteps;
+
+	updateWeights();
+
+	unsigned int nErrorTestFails = 0;
+	unsigned int nConvFails = 0;
+	while (true)
+	{
+		double h = _h;
+		if (_maxStepSize > 0.0)
+			h = std::min(h, _maxStepSize);
+
+		// Hit stop time exactly and avoid tiny last steps
+		const double hRequested = h;
+		const double remaining = tStop - _t;
+		if (1.05 * h >= remaining)
+			h = remaining;
+
+		if (0.1 * std::abs(h) <= std::abs(_t) * uround)
+			return RadauStepResult::StepSizeTooSmall;
+
+		if (_hJac != h)
+		{
+			const int flag = updateJacobian(h);
+			if (flag < 0)
+				return RadauStepResult::ResidualFailure;
+			else if (flag > 0)
+			{
+				++_stats.numConvergenceFailures;
+				if (++nConvFails > _maxConvFails)
+					return RadauStepResult::TooManyConvergenceFailures;
+
+				_h = 0.5 * h;
+				_rejected = true;
+				continue;
+			}
+		}
+
+		predictStages(h);
+
+		int flag = 0;
+		double hFactor = 0.5;
+		const NewtonResult nr = solveStages(h, flag, hFactor);
+		if (nr == NewtonResult::Failed)
+			return RadauStepResult::LinearSolverFailure;
+		else if (nr == NewtonResult::Diverged)
+		{
+			LOG(Debug) << "Radau IIA Newton iteration failed at t = " << _t << " with h = " << h;
+
+			++_stats.numConvergenceFailures;
+			if (++nConvFails > _maxConvFails)
+				return RadauStepResult::TooManyConvergenceFailures;
+
+			// Require new Jacobian
+			_h = h * hFactor;
+			_hJac = 0.0;
+			_rejected = true;
+			continue;
+		}
+
+		// Error estimate and step size proposal
+		const double err = estimateError(h, (_stepsSinceRestart == 0) || _rejected, flag);
+		if (flag < 0)
+			return RadauStepResult::LinearSolverFailure;
+		else if (flag > 0)
+		{
+			++_stats.numConvergenceFailures;
+			if (++nConvFails > _maxConvFails)
+				return RadauStepResult::TooManyConvergenceFailures;
+
+			_h = 0.5 * h;
+			_hJac = 0.0;
+			_rejected = true;
+			continue;
+		}
+
+		const double fac = std::min(safetyFactor, safetyFactor * (1.0 + 2.0 * maxNewtonIter) / (_lastNewtonIter + 2.0 * maxNewtonIter));
+		const double quot = std::max(1.0 / maxStepRatio, std::min(1.0 / minStepRatio, std::pow(err, 0.25) / fac));
+		double hNew = h / quot;
+
+		if (err < 1.0)
+		{
+			// Step is accepted
+			double* const z1 = _z.data();
+			double* const z2 = z1 + _nDof;
+			double* const z3 = z2 + _nDof;
+			double* const k1 = _cont.data();
+			double* const k2 = k1 + _nDof;
+			double* const k3 = k2 + _nDof;
+
+			for (unsigned int i = 0; i < _nDof; ++i)
+			{
+				// Coefficients of the collocation polynomial in Newton form relative to the end of the step
+				k1[i] = (z2[i] - z3[i]) / c2m1;
+				const double ak = (z1[i] - z2[i]) / c1mc2;
+				const double acont3 = (ak - z1[i] / c1) / c2;
+				k2[i] = (ak - k1[i]) / c1m1;
+				k3[i] = k2[i] - acont3;
+
+				// Stiffly accurate: Last stage is the new state
+				_yDot[i] = (ai[2][0] * z1[i] + ai[2][1] * z2[i] + ai[2][2] * z3[i]) / h;
+				_y[i] += z3[i];
+			}
+
+			_t = (h == remaining) ? tStop : _t + h;
+			_hLast = h;
+			_havePolynomial = true;
+			++_stepsSinceRestart;
+			++_stats.numSteps;
+
+			// Do not let a step shortened by the stop time spoil the proposal for a restart
+			if (h < hRequested)
+				hNew = std::max(hNew, hRequested);
+			if (_maxStepSize > 0.0)
+				hNew = std::min(hNew, _maxStepSize);
+			if (_rejected)
+				hNew = std::min(hNew, h);
+
+			_rejected = false;
+
+			// Keep step size and factorization if the Newton iteration converged fast
+			const double ratio = hNew / h;
+			if ((_contraction <= jacobianReuseContraction) && (ratio >= keepStepMinRatio) && (ratio <= keepStepMaxRatio))
+				hNew = h;
+			else
+				_hJac = 0.0;
+
+			_h = hNew;
+			return RadauStepResult::Success;
+		}
+
+		// Step is rejected
+		LOG(Debug) << "Radau IIA error test failed at t = " << _t << " with h = " << h << " err = " << err;
+
+		++_stats.numErrorTestFailures;
+		if (++nErrorTestFails > _maxErrorTestFails)
+			return RadauStepResult::TooManyErrorTestFailures;
+
+		_h = (_stepsSinceRestart == 0) ? 0.1 * h : hNew;
+		_rejected = true;
+	}
+}
+
+void RadauIIA::interpolate(double t, double* y, double* yDot) const
+{
+	double const* const k1 = _cont.data();
+	double const* const k2 = k1 + _nDof;
+	double const* const k3 = k2 + _nDof;
+
+	if (!_havePolynomial)
+	{
+		std::copy(_y.begin(), _y.end(), y);
+		std::copy(_yDot.begin(), _yDot.end(), yDot);
+		return;
+	}
+
+	// Position relative to the end of the last step in [-1, 0]
+	const double s = (t - _t) / _hLast;
+	for (unsigned int i = 0; i < _nDof; ++i)
+	{
+		const double inner = k2[i] + (s - c1m1) * k3[i];
+		const double outer = k1[i] + (s - c2m1) * inner;
+		y[i] = _y[i] + s * outer;
+		yDot[i] = (outer + s * (inner + (s - c2m1) * k3[i])) / _hLast;
+	}
+}
+
+} // namespace timeint
+
+} // namespace cadet
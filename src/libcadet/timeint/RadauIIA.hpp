@@ -0,0 +1,238 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file
+ * Provides a variable step size Radau IIA (order 5) time integrator for DAEs.
+ */
+
+#ifndef LIBCADET_RADAUIIA_HPP_
+#define LIBCADET_RADAUIIA_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "SimulationTypes.hpp"
+#include "linalg/Gmres.hpp"
+
+#include <vector>
+#include <functional>
+
+namespace cadet
+{
+
+class ISimulatableModel;
+
+namespace timeint
+{
+
+/**
+ * @brief Result of a Radau IIA time step
+ */
+enum class RadauStepResult : int
+{
+	Success = 0,
+	ResidualFailure = -1,
+	LinearSolverFailure = -2,
+	TooManyErrorTestFailures = -3,
+	TooManyConvergenceFailures = -4,
+	StepSizeTooSmall = -5,
+	TooManySteps = -6
+};
+
+/**
+ * @brief Converts a RadauStepResult to a string
+ * @param [in] res Result of a time step
+ * @return String representation of the result
+ */
+const char* to_string(RadauStepResult res) CADET_NOEXCEPT;
+
+/**
+ * @brief Counters of the Radau IIA time integrator
+ */
+struct RadauStatistics
+{
+	unsigned long numSteps; //!< Number of accepted time steps
+	unsigned long numErrorTestFailures; //!< Number of steps rejected by the local error test
+	unsigned long numConvergenceFailures; //!< Number of steps rejected due to Newton divergence
+	unsigned long numNewtonIterations; //!< Number of simplified Newton iterations
+	unsigned long numResidualEvals; //!< Number of residual evaluations (without Jacobian update)
+	unsigned long numJacobianEvals; //!< Number of residual evaluations with Jacobian update (i.e., factorizations)
+	unsigned long numGmresIterations; //!< Number of GMRES iterations for the complex stage block
+	unsigned long numRestarts; //!< Number of restarts (initial step and discontinuous section transitions)
+};
+
+/**
+ * @brief Variable step size Radau IIA (order 5) integrator for implicit index-1 DAEs @f$ F(t, y, \dot{y}) = 0 @f$
+ * @details Implements the three-stage Radau IIA collocation method following Hairer and Wanner (RADAU5).
+ *          The stage increments @f$ Z_i = Y_i - y_n @f$ satisfy
+ *          @f[ F\left(t_n + c_i h, y_n + Z_i, \frac{1}{h} \sum_j \left(A^{-1}\right)_{ij} Z_j \right) = 0, @f]
+ *          which is solved by a simplified Newton method. The Newton matrix
+ *          @f$ I \otimes \frac{\partial F}{\partial y} + \frac{1}{h} A^{-1} \otimes \frac{\partial F}{\partial \dot{y}} @f$
+ *          is block diagonalized by the transformation @f$ T @f$ with
+ *          @f$ T^{-1} A^{-1} T = \operatorname{diag}\left(\gamma, \begin{pmatrix} \alpha & -\beta \\ \beta & \alpha \end{pmatrix} \right) @f$.
+ *
+ *          The real block @f$ \frac{\partial F}{\partial y} + \frac{\gamma}{h} \frac{\partial F}{\partial \dot{y}} @f$
+ *          has the same structure as the BDF iteration matrix and is solved by the model's
+ *          ISimulatableModel::linearSolve() with @f$ \alpha = \gamma / h @f$, which reuses the existing
+ *          (block) factorizations of the unit operations. Since the model only provides real factorizations,
+ *          the complex conjugate block is solved in its real @f$ 2n \times 2n @f$ form by GMRES, which is
+ *          preconditioned by the real block. Hence, only one factorization is computed per Jacobian update.
+ *
+ *          Being a one-step method, the integrator runs at full order directly after a restart
+ *          (e.g., at discontinuous section transitions) and does not need to ramp up its order.
+ *          Dense output is provided by the collocation polynomial.
+ */
+class RadauIIA
+{
+public:
+	/**
+	 * @brief Returns the section index of a given time point
+	 */
+	typedef std::function<unsigned int(double)> SectionLookup;
+
+	RadauIIA();
+	~RadauIIA() CADET_NOEXCEPT;
+
+	/**
+	 * @brief Allocates memory for integrating the given model
+	 * @param [in] model Model that is integrated, not owned by the integrator
+	 * @param [in] secLookup Function that maps time points to section indices
+	 * @param [in] adJac AD vectors used for computing the Jacobian
+	 */
+	void initialize(ISimulatableModel* model, SectionLookup secLookup, const AdJacobianParams& adJac);
+
+	/**
+	 * @brief Sets the error tolerances
+	 * @details The tolerances are transformed as in RADAU5 since the error estimator is of order 3.
+	 * @param [in] relTol Relative error tolerance
+	 * @param [in] absTol Absolute error tolerance for each DOF
+	 */
+	void setTolerances(double relTol, double const* absTol);
+
+	/**
+	 * @brief Sets limits of the time integration
+	 * @param [in] maxStepSize Maximum step size, @c 0.0 means unlimited
+	 * @param [in] maxSteps Maximum number of steps between two restarts
+	 * @param [in] maxErrorTestFails Maximum number of consecutive error test failures in one step
+	 * @param [in] maxConvFails Maximum number of consecutive Newton convergence failures in one step
+	 */
+	void setLimits(double maxStepSize, unsigned int maxSteps, unsigned int maxErrorTestFails, unsigned int maxConvFails);
+
+	/**
+	 * @brief Restarts the integrator from a given (consistent) state
+	 * @details The state and its time derivative are copied.
+	 * @param [in] t Time point of the state
+	 * @param [in] y State vector
+	 * @param [in] yDot Time derivative of the state vector
+	 * @param [in] stepSize Initial step size
+	 */
+	void reset(double t, double const* y, double const* yDot, double stepSize);
+
+	/**
+	 * @brief Performs one accepted time step that does not exceed the given stop time
+	 * @param [in] tStop Stop time
+	 * @return Success or cause of failure
+	 */
+	RadauStepResult step(double tStop);
+
+	/**
+	 * @brief Evaluates the collocation polynomial of the last accepted step
+	 * @param [in] t Time point in the last accepted step
+	 * @param [out] y State vector at @p t
+	 * @param [out] yDot Time derivative of the state vector at @p t
+	 */
+	void interpolate(double t, double* y, double* yDot) const;
+
+	inline double time() const CADET_NOEXCEPT { return _t; }
+	inline double lastStepSize() const CADET_NOEXCEPT { return _hLast; }
+	inline double nextStepSize() const CADET_NOEXCEPT { return _h; }
+	inline double const* state() const CADET_NOEXCEPT { return _y.data(); }
+	inline double const* stateDerivative() const CADET_NOEXCEPT { return _yDot.data(); }
+	inline const RadauStatistics& statistics() const CADET_NOEXCEPT { return _stats; }
+
+	/**
+	 * @brief Resets all counters of the integrator
+	 */
+	void clearStatistics() CADET_NOEXCEPT;
+
+protected:
+
+	/**
+	 * @brief Outcome of the simplified Newton iteration
+	 */
+	enum class NewtonResult
+	{
+		Converged,
+		Diverged,
+		Failed
+	};
+
+	NewtonResult solveStages(double h, int& flag, double& hFactor);
+	int updateJacobian(double h);
+	int solveComplexBlock(double h, double* rhsRe, double* rhsIm);
+	int complexBlockMatVec(double const* x, double* z);
+	double estimateError(double h, bool refine, int& flag);
+	void predictStages(double h);
+	void updateWeights();
+	double weightedNorm(double const* x) const;
+
+	ISimulatableModel* _model; //!< Integrated model
+	SectionLookup _secLookup; //!< Maps time points to section indices
+	AdJacobianParams _adJac; //!< AD vectors for Jacobian updates
+	unsigned int _nDof; //!< Number of DOFs
+
+	double _relTol; //!< Transformed relative error tolerance
+	std::vector<double> _absTol; //!< Transformed absolute error tolerance
+	double _newtonTol; //!< Tolerance of the simplified Newton iteration
+	double _maxStepSize; //!< Maximum step size (0.0 means unlimited)
+	unsigned int _maxSteps; //!< Maximum number of steps between restarts
+	unsigned int _maxErrorTestFails; //!< Maximum number of consecutive error test failures
+	unsigned int _maxConvFails; //!< Maximum number of consecutive convergence failures
+
+	double _t; //!< Current time
+	double _h; //!< Next step size
+	double _hLast; //!< Size of the last accepted step
+	double _hJac; //!< Step size of the current factorization, @c 0.0 if a Jacobian update is required
+	double _contraction; //!< Newton contraction factor of the last step
+	double _faccon; //!< Convergence rate estimate carried over from the last step
+	bool _havePolynomial; //!< Determines whether the collocation polynomial of the last step is available
+	bool _rejected; //!< Determines whether the last step has been rejected
+	unsigned int _stepsSinceRestart; //!< Number of accepted steps since last restart
+	unsigned int _lastNewtonIter; //!< Number of Newton iterations in the last converged stage solve
+
+	std::vector<double> _y; //!< Current state
+	std::vector<double> _yDot; //!< Current time derivative of the state
+	std::vector<double> _weight; //!< Error weights of the current step
+	std::vector<double> _z; //!< Stage increments Z_1, Z_2, Z_3
+	std::vector<double> _w; //!< Transformed stage increments
+	std::vector<double> _dw; //!< Newton update of transformed stage increments
+	std::vector<double> _cont; //!< Coefficients of the collocation polynomial of the last accepted step
+	std::vector<double> _stageY; //!< Stage state
+	std::vector<double> _stageYdot; //!< Stage time derivative
+	std::vector<double> _res; //!< Stage residuals
+	std::vector<double> _tmp; //!< Temporary storage
+	std::vector<double> _tmp2; //!< Temporary storage
+	std::vector<double> _gmresRhs; //!< Right hand side of the preconditioned complex block
+	std::vector<double> _gmresWeight; //!< Weights of the complex block
+
+	double _jacT; //!< Time point of the Jacobian
+	double _gmresShiftRe; //!< Real part of shift in preconditioned complex block
+	double _gmresShiftIm; //!< Imaginary part of shift in preconditioned complex block
+	linalg::Gmres _gmres; //!< GMRES for the complex block
+
+	RadauStatistics _stats; //!< Counters
+};
+
+} // namespace timeint
+
+} // namespace cadet
+
+#endif  // LIBCADET_RADAUIIA_HPP_
@@ -17,6 +17,7 @@
 #include <algorithm>
 
 #include "linalg/BandMatrix.hpp"
+#include "linalg/BatchedBandMatrix.hpp"
 #include "linalg/Norms.hpp"
 
 #include "MatrixHelper.hpp"
@@ -124,6 +125,109 @@ TEST_CASE("FactorizableBandMatrix solves", "[BandMatrix],[LinAlg]")
 	REQUIRE(cadet::linalg::linfNorm(y.data(), y.size()) <= 1e-10);
 }
 
+TEST_CASE("FactorizableBandMatrix mixed precision solves", "[BandMatrix],[LinAlg]")
+{
+	using cadet::linalg::FactorizableBandMatrix;
+	using cadet::linalg::BandMatrix;
+
+	const BandMatrix bm = cadet::test::createBandMatrix<BandMatrix>(50, 2, 3);
+	FactorizableBandMatrix fbm = fromBandMatrix(bm);
+	fbm.setMixedPrecision(true, 2);
+
+	REQUIRE(fbm.factorize());
+
+	// Matrix is not overwritten by its factors
+	for (int row = 0; row < bm.rows(); ++row)
+	{
+		for (int diag = -static_cast<int>(bm.lowerBandwidth()); diag <= static_cast<int>(bm.upperBandwidth()); ++diag)
+		{
+			CAPTURE(row);
+			CAPTURE(diag);
+			CHECK(fbm.centered(row, diag) == bm.centered(row, diag));
+		}
+	}
+
+	// Prepare some right hand side
+	std::vector<double> y(fbm.rows(), 0.0);
+	for (int i = 0; i < fbm.rows(); ++i)
+		y[i] = std::sin(6.283185307 * i / static_cast<double>(fbm.rows()));
+
+	// Solve
+	std::vector<double> x = y;
+	REQUIRE(fbm.solve(x.data()));
+
+	// Iterative refinement recovers double precision accuracy
+	bm.multiplyVector(x.data(), 1.0, -1.0, y.data());
+	REQUIRE(cadet::linalg::linfNorm(y.data(), y.size()) <= 1e-10);
+}
+
+TEST_CASE("BatchedBandMatrix solves", "[BandMatrix],[LinAlg]")
+{
+	using cadet::linalg::BatchedBandMatrix;
+	using cadet::linalg::BandMatrix;
+
+	const int nBlocks = 7;
+	const int nRows = 20;
+
+	// Create blocks with different values such that pivoting differs across blocks
+	std::vector<BandMatrix> blocks(nBlocks, cadet::test::createBandMatrix<BandMatrix>(nRows, 2, 3));
+	for (int blk = 0; blk < nBlocks; ++blk)
+	{
+		for (int row = 0; row < nRows; ++row)
+			blocks[blk].centered(row, 0) *= 0.5 * blk - 1.0;
+	}
+
+	BatchedBandMatrix bbm;
+	bbm.resize(nBlocks, nRows, 2, 3);
+	for (int blk = 0; blk < nBlocks; ++blk)
+		bbm.copyBlock(blk, blocks[blk]);
+
+	for (int blk = 0; blk < nBlocks; ++blk)
+	{
+		for (int row = 0; row < nRows; ++row)
+		{
+			for (int col = std::max(0, row - 2); col <= std::min(nRows - 1, row + 3); ++col)
+				CHECK(bbm(blk, row, col) == blocks[blk].centered(row, col - row));
+		}
+	}
+
+	REQUIRE(bbm.factorize());
+
+	// Prepare some right hand sides, stored one after another with some padding
+	const int blockStride = nRows + 3;
+	std::vector<double> y(nBlocks * blockStride, 0.0);
+	for (int blk = 0; blk < nBlocks; ++blk)
+	{
+		for (int i = 0; i < nRows; ++i)
+			y[blk * blockStride + i] = std::sin(6.283185307 * (i + blk) / static_cast<double>(nRows));
+	}
+
+	SECTION("All blocks at once")
+	{
+		std::vector<double> x = y;
+		REQUIRE(bbm.solve(x.data(), blockStride));
+
+		for (int blk = 0; blk < nBlocks; ++blk)
+		{
+			CAPTURE(blk);
+			blocks[blk].multiplyVector(x.data() + blk * blockStride, 1.0, -1.0, y.data() + blk * blockStride);
+			REQUIRE(cadet::linalg::linfNorm(y.data() + blk * blockStride, nRows) <= 1e-10);
+		}
+	}
+
+	SECTION("Single blocks")
+	{
+		std::vector<double> x = y;
+		for (int blk = 0; blk < nBlocks; ++blk)
+		{
+			CAPTURE(blk);
+			REQUIRE(bbm.solve(blk, x.data() + blk * blockStride));
+			blocks[blk].multiplyVector(x.data() + blk * blockStride, 1.0, -1.0, y.data() + blk * blockStride);
+			REQUIRE(cadet::linalg::linfNorm(y.data() + blk * blockStride, nRows) <= 1e-10);
+		}
+	}
+}
+
 /**
  * @brief Tests the extraction of a dense submatrix via submatrixMultiplyVector()
  * @details Combines extractDenseSubMatrix() with checkMatrixAgainstLinearArray().
@@ -471,3 +471,158 @@ TEST_CASE("CSTR linear binding single particle matches particle distribution", "
 	cadet::JsonParameterProvider jpp = createMultiParticleTypesTestCase();
 	cadet::test::particle::testLinearMixedParticleTypes(jpp, 5e-8, 5e-5);
 }
+
+TEST_CASE("CSTR outlet analytics match post-processed outlet", "[CSTR],[Simulation],[Sensitivity],[OutletAnalytics]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(2, 100.0, 0.5);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 1.0);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 1.0, 1.0);
+	setFlowRateFilter(jpp, 0.5);
+	cadet::test::addSensitivity(jpp, "FLOWRATE_FILTER", cadet::makeParamId("FLOWRATE_FILTER", 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 1e-6);
+	cadet::test::returnSensitivities(jpp, 0);
+
+	const std::vector<double> fracTimes = {5.0, 10.0, 30.25, 100.0};
+	jpp.pushScope("return");
+	jpp.pushScope("unit_000");
+	jpp.set("WRITE_OUTLET_ANALYTICS", true);
+	jpp.set("OUTLET_FRACTION_TIMES", fracTimes);
+	jpp.popScope();
+	jpp.popScope();
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	cadet::OutletAnalyticsUnitOpRecorder const* const anaData = drv.solution()->analytics(0);
+	REQUIRE(anaData);
+	REQUIRE(anaData->numDataPoints() == simData->numDataPoints());
+	REQUIRE(anaData->numFractions() == fracTimes.size() - 1);
+
+	// Post-process stored outlet by trapezoidal rule
+	double const* const time = drv.solution()->time();
+	const auto postProcess = [&](double const* c, double& m0, double& m1, double& m2, std::vector<double>& frac)
+	{
+		m0 = 0.0;
+		m1 = 0.0;
+		m2 = 0.0;
+		frac.assign(fracTimes.size() - 1, 0.0);
+		for (unsigned int i = 1; i < simData->numDataPoints(); ++i)
+		{
+			const double t0 = time[i-1];
+			const double t1 = time[i];
+			const double dt = t1 - t0;
+			m0 += 0.5 * dt * (c[i-1] + c[i]);
+			m1 += 0.5 * dt * (t0 * c[i-1] + t1 * c[i]);
+			m2 += 0.5 * dt * (t0 * t0 * c[i-1] + t1 * t1 * c[i]);
+
+			for (std::size_t f = 0; f < frac.size(); ++f)
+			{
+				const double a = std::max(t0, fracTimes[f]);
+				const double b = std::min(t1, fracTimes[f + 1]);
+				if (b <= a)
+					continue;
+
+				const double ca = c[i-1] + (a - t0) / dt * (c[i] - c[i-1]);
+				const double cb = c[i-1] + (b - t0) / dt * (c[i] - c[i-1]);
+				frac[f] += 0.5 * (b - a) * (ca + cb);
+			}
+		}
+	};
+
+	double m0 = 0.0;
+	double m1 = 0.0;
+	double m2 = 0.0;
+	std::vector<double> frac;
+	postProcess(simData->outlet(), m0, m1, m2, frac);
+
+	double mean = 0.0;
+	double variance = 0.0;
+	anaData->centralMoments(&mean, &variance);
+
+	CHECK(anaData->moment0()[0] == cadet::test::makeApprox(m0, 1e-12, 1e-14));
+	CHECK(mean == cadet::test::makeApprox(m1 / m0, 1e-12, 1e-14));
+	CHECK(variance == cadet::test::makeApprox(m2 / m0 - (m1 / m0) * (m1 / m0), 1e-10, 1e-12));
+	for (std::size_t f = 0; f < frac.size(); ++f)
+		CHECK(anaData->fractions()[f] == cadet::test::makeApprox(frac[f], 1e-12, 1e-14));
+
+	// Peak is at the end of the loading phase
+	double const* const outlet = simData->outlet();
+	const unsigned int idxPeak = std::distance(outlet, std::max_element(outlet, outlet + simData->numDataPoints()));
+	CHECK(anaData->peakHeight()[0] == outlet[idxPeak]);
+	CHECK(anaData->peakTime()[0] == time[idxPeak]);
+	CHECK(anaData->sensPeakHeight(0)[0] == simData->sensOutlet(0)[idxPeak]);
+
+	// Sensitivities
+	double sm0 = 0.0;
+	double sm1 = 0.0;
+	double sm2 = 0.0;
+	std::vector<double> sfrac;
+	postProcess(simData->sensOutlet(0), sm0, sm1, sm2, sfrac);
+
+	CHECK(anaData->sensMoment0(0)[0] == cadet::test::makeApprox(sm0, 1e-12, 1e-14));
+	for (std::size_t f = 0; f < sfrac.size(); ++f)
+		CHECK(anaData->sensFractions(0)[f] == cadet::test::makeApprox(sfrac[f], 1e-12, 1e-14));
+}
+
+TEST_CASE("CSTR cyclic steady state with Anderson acceleration", "[CSTR],[Simulation],[CyclicSteadyState]")
+{
+	// Periodic loading and washing of a CSTR with residence time 40 and cycle time 20
+	const auto createCase = [](int andersonDepth) -> cadet::JsonParameterProvider
+	{
+		cadet::JsonParameterProvider jpp = createCSTRBenchmark(2, 20.0, 0.5);
+		cadet::test::setSectionTimes(jpp, {0.0, 10.0, 20.0});
+		cadet::test::setInitialConditions(jpp, {0.0}, {}, 40.0);
+		cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+		cadet::test::setInletProfile(jpp, 1, 0, 0.0, 0.0, 0.0, 0.0);
+		cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+		cadet::test::setFlowRates(jpp, 1, 1.0, 1.0, 0.0);
+
+		jpp.pushScope("solver");
+		jpp.addScope("cyclic_steady_state");
+		jpp.pushScope("cyclic_steady_state");
+		jpp.set("MAX_CYCLES", 200);
+		jpp.set("TOL", 1e-8);
+		jpp.set("ANDERSON_DEPTH", andersonDepth);
+		jpp.popScope();
+		jpp.popScope();
+		return jpp;
+	};
+
+	cadet::JsonParameterProvider jppPlain = createCase(0);
+	cadet::Driver drvPlain;
+	drvPlain.configure(jppPlain);
+	drvPlain.run();
+
+	cadet::JsonParameterProvider jppAccel = createCase(5);
+	cadet::Driver drvAccel;
+	drvAccel.configure(jppAccel);
+	drvAccel.run();
+
+	const std::vector<double>& normsPlain = drvPlain.simulator()->getCyclicSteadyStateNorms();
+	const std::vector<double>& normsAccel = drvAccel.simulator()->getCyclicSteadyStateNorms();
+	REQUIRE(!normsPlain.empty());
+	REQUIRE(!normsAccel.empty());
+	CHECK(normsPlain.back() <= 1e-8);
+	CHECK(normsAccel.back() <= 1e-8);
+	CHECK(normsAccel.size() < normsPlain.size());
+
+	// Analytic concentration at the beginning of the cycle
+	const double decay = std::exp(-10.0 / 40.0);
+	const double cStart = decay / (1.0 + decay);
+
+	cadet::InternalStorageUnitOpRecorder const* const plainData = drvPlain.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const accelData = drvAccel.solution()->unitOperation(0);
+	REQUIRE(plainData->numDataPoints() == accelData->numDataPoints());
+
+	CHECK(accelData->outlet()[0] == cadet::test::makeApprox(cStart, 1e-5, 1e-8));
+	for (unsigned int i = 0; i < accelData->numDataPoints(); ++i)
+	{
+		CAPTURE(i);
+		CHECK(accelData->outlet()[i] == cadet::test::makeApprox(plainData->outlet()[i], 1e-6, 1e-8));
+	}
+}
@@ -37,6 +37,8 @@
 #include <cmath>
 #include <functional>
 #include <cstdint>
+#include <sstream>
+#include <iomanip>
 
 /**
  * @brief Returns the absolute path to the test/ folder of the project
@@ -203,6 +205,195 @@ namespace column
 			jpp.popScope();
 	}
 
+	void setAxialDG(cadet::JsonParameterProvider& jpp, unsigned int polyDeg, unsigned int nElem, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+
+		jpp.set("AXIAL_DISC_TYPE", "DG");
+		jpp.set("POLYDEG", static_cast<int>(polyDeg));
+		jpp.set("NELEM", static_cast<int>(nElem));
+
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void setParticleCollocation(cadet::JsonParameterProvider& jpp, unsigned int nPar, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+
+		jpp.set("PAR_DISC_TYPE", "COLLOCATION_PAR");
+		jpp.set("NPAR", static_cast<int>(nPar));
+
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void setAdaptiveAxialGrid(cadet::JsonParameterProvider& jpp, double threshold, double maxRefinement, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+
+		jpp.set("ADAPTIVE_AXIAL_GRID", true);
+		jpp.set("ADAPTIVE_FRONT_THRESHOLD", threshold);
+		jpp.set("ADAPTIVE_MAX_REFINEMENT", maxRefinement);
+
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void setFactorizationCacheSize(cadet::JsonParameterProvider& jpp, int size, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+		jpp.set("FACTORIZATION_CACHE_SIZE", size);
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void setMixedPrecision(cadet::JsonParameterProvider& jpp, int refinementSteps, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+		jpp.set("MIXED_PRECISION", true);
+		jpp.set("MIXED_PRECISION_REFINEMENT_STEPS", refinementSteps);
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void setBatchedParticleSolver(cadet::JsonParameterProvider& jpp, std::string unitID)
+	{
+		int level = 0;
+
+		if (jpp.exists("model"))
+		{
+			jpp.pushScope("model");
+			++level;
+		}
+		if (jpp.exists("unit_" + unitID))
+		{
+			jpp.pushScope("unit_" + unitID);
+			++level;
+		}
+
+		jpp.pushScope("discretization");
+		jpp.set("BATCHED_PARTICLE_SOLVER", true);
+		jpp.popScope();
+
+		for (int l = 0; l < level; ++l)
+			jpp.popScope();
+	}
+
+	void splitLastSection(cadet::JsonParameterProvider& jpp, unsigned int nParts, std::string inletID)
+	{
+		jpp.pushScope("solver");
+		jpp.pushScope("sections");
+
+		std::vector<double> secTimes = jpp.getDoubleArray("SECTION_TIMES");
+		const unsigned int nSec = secTimes.size() - 1;
+		const double start = secTimes[nSec - 1];
+		const double end = secTimes[nSec];
+
+		secTimes.pop_back();
+		for (unsigned int i = 1; i <= nParts; ++i)
+			secTimes.push_back(start + (end - start) * i / nParts);
+
+		jpp.set("SECTION_TIMES", secTimes);
+		jpp.set("NSEC", static_cast<int>(nSec + nParts - 1));
+		if (jpp.exists("SECTION_CONTINUITY"))
+			jpp.remove("SECTION_CONTINUITY");
+
+		jpp.popScope();
+		jpp.popScope();
+
+		jpp.pushScope("model");
+		jpp.pushScope("unit_" + inletID);
+
+		const auto secName = [](unsigned int secIdx) -> std::string
+			{
+				std::ostringstream ss;
+				ss << "sec_" << std::setfill('0') << std::setw(3) << secIdx;
+				return ss.str();
+			};
+
+		for (unsigned int i = 1; i < nParts; ++i)
+			jpp.copy(secName(nSec - 1), secName(nSec - 1 + i));
+
+		jpp.popScope();
+		jpp.popScope();
+	}
+
 	void setNumParCells(cadet::JsonParameterProvider& jpp, unsigned int nPar, std::string unitID)
 	{
 		int level = 0;
@@ -547,6 +738,127 @@ namespace column
 		}
 	}
 
+	void testFactorizationCache(const char* uoType, bool dynamicBinding)
+	{
+		SECTION(std::string("Factorization cache with ") + (dynamicBinding ? "dynamic" : "quasi-stationary") + " binding")
+		{
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(dynamicBinding, false, uoType);
+			setWenoOrder(jpp, 1);
+
+			// Factorizations are reused across these sections
+			splitLastSection(jpp, 4);
+
+			// Reference without cache
+			setFactorizationCacheSize(jpp, 0);
+			cadet::Driver drvRef;
+			drvRef.configure(jpp);
+			drvRef.run();
+
+			setFactorizationCacheSize(jpp, 4);
+			cadet::Driver drv;
+			drv.configure(jpp);
+			drv.run();
+
+			cadet::InternalStorageUnitOpRecorder const* const refData = drvRef.solution()->unitOperation(0);
+			cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+			REQUIRE(refData->numDataPoints() == simData->numDataPoints());
+
+			// Cached factorizations are only used for identical Jacobians, so the solution does not change
+			double const* refOutlet = refData->outlet();
+			double const* outlet = simData->outlet();
+			for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents() * simData->numInletPorts(); ++i, ++outlet, ++refOutlet)
+			{
+				CAPTURE(i);
+				CHECK((*outlet) == makeApprox(*refOutlet, 1e-10, 1e-14));
+			}
+		}
+	}
+
+	void testSectionConstantCacheUpdate(const std::string& uoType)
+	{
+		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+		REQUIRE(nullptr != mb);
+
+		cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding(uoType);
+		cadet::IUnitOperation* const unit = unitoperation::createAndConfigureUnit(uoType, *mb, jpp);
+
+		// Configure reference model with changed parameters
+		std::vector<double> filmDiff = jpp.getDoubleArray("FILM_DIFFUSION");
+		const double parPorosity = jpp.getDouble("PAR_POROSITY") * 0.9;
+		for (std::size_t i = 0; i < filmDiff.size(); i += jpp.getInt("NCOMP"))
+			filmDiff[i] *= 2.0;
+
+		jpp.set("FILM_DIFFUSION", filmDiff);
+		jpp.set("PAR_POROSITY", parPorosity);
+		cadet::IUnitOperation* const unitRef = unitoperation::createAndConfigureUnit(uoType, *mb, jpp);
+
+		std::vector<double> y(unit->numDofs(), 0.0);
+		std::vector<double> resOld(unit->numDofs(), 0.0);
+		std::vector<double> res(unit->numDofs(), 0.0);
+		std::vector<double> resRef(unit->numDofs(), 0.0);
+		util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, unit->numDofs());
+
+		const AdJacobianParams noAdParams{nullptr, nullptr, 0u};
+		const ConstSimulationState simState{y.data(), nullptr};
+		const SimulationTime simTime{0.0, 0u};
+		cadet::util::ThreadLocalStorage tls;
+		tls.resize(std::max(unit->threadLocalMemorySize(), unitRef->threadLocalMemorySize()));
+
+		unit->notifyDiscontinuousSectionTransition(0.0, 0u, simState, noAdParams);
+		unitRef->notifyDiscontinuousSectionTransition(0.0, 0u, simState, noAdParams);
+
+		// Fill cache with old parameters
+		unit->residual(simTime, simState, resOld.data(), tls);
+
+		// Change parameters without notifying the model of a new section
+		REQUIRE(unit->setParameter(cadet::makeParamId(cadet::hashString("FILM_DIFFUSION"), 0, 0, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), filmDiff[0]));
+		REQUIRE(unit->setParameter(cadet::makeParamId(cadet::hashString("PAR_POROSITY"), 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), parPorosity));
+
+		unit->residual(simTime, simState, res.data(), tls);
+		unitRef->residual(simTime, simState, resRef.data(), tls);
+
+		bool changed = false;
+		for (unsigned int i = 0; i < unit->numDofs(); ++i)
+		{
+			CAPTURE(i);
+			CHECK(res[i] == makeApprox(resRef[i], 1e-14, 1e-14));
+			changed = changed || (res[i] != resOld[i]);
+		}
+		CHECK(changed);
+
+		mb->destroyUnitOperation(unit);
+		mb->destroyUnitOperation(unitRef);
+		destroyModelBuilder(mb);
+	}
+
+	void compareAnalyticBenchmark(cadet::JsonParameterProvider& jpp, const char* refFileRelPath, bool dynamicBinding, double absTol, double relTol)
+	{
+		// Run simulation
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+
+		// Read reference data from test file
+		const std::string refFile = std::string(getTestDirectory()) + std::string(refFileRelPath);
+		ReferenceDataReader rd(refFile.c_str());
+		const std::vector<double> time = rd.time();
+		const std::vector<double> ref = (dynamicBinding ? rd.analyticDynamic() : rd.analyticQuasiStationary());
+
+		// Get data from simulation
+		cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+		double const* outlet = simData->outlet();
+
+		// Compare
+		for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents() * simData->numInletPorts(); ++i, ++outlet)
+		{
+			// Note that the simulation only saves the chromatogram at multiples of 2 (i.e., 0s, 2s, 4s, ...)
+			// whereas the reference solution is given at every second (0s, 1s, 2s, 3s, ...)
+			// Thus, we only take the even indices of the reference array
+			CAPTURE(time[2 * i]);
+			CHECK((*outlet) == makeApprox(ref[2 * i], relTol, absTol));
+		}
+	}
+
 	void testAnalyticBenchmark(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, double absTol, double relTol)
 	{
 		const std::string fwdStr = (forwardFlow ? "forward" : "backward");
@@ -558,30 +870,54 @@ namespace column
 			if (!forwardFlow)
 				reverseFlow(jpp);
 
-			// Run simulation
-			cadet::Driver drv;
-			drv.configure(jpp);
-			drv.run();
+			compareAnalyticBenchmark(jpp, refFileRelPath, dynamicBinding, absTol, relTol);
+		}
+	}
 
-			// Read reference data from test file
-			const std::string refFile = std::string(getTestDirectory()) + std::string(refFileRelPath);
-			ReferenceDataReader rd(refFile.c_str());
-			const std::vector<double> time = rd.time();
-			const std::vector<double> ref = (dynamicBinding ? rd.analyticDynamic() : rd.analyticQuasiStationary());
+	void testAnalyticBenchmarkDG(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int polyDeg, unsigned int nElem, double absTol, double relTol)
+	{
+		const std::string fwdStr = (forwardFlow ? "forward" : "backward");
+		SECTION("Analytic " + fwdStr + " flow with " + (dynamicBinding ? "dynamic" : "quasi-stationary") + " binding (DG)")
+		{
+			// Setup simulation
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(dynamicBinding, false, uoType);
+			setAxialDG(jpp, polyDeg, nElem);
+			if (!forwardFlow)
+				reverseFlow(jpp);
 
-			// Get data from simulation
-			cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
-			double const* outlet = simData->outlet();
+			compareAnalyticBenchmark(jpp, refFileRelPath, dynamicBinding, absTol, relTol);
+		}
+	}
 
-			// Compare
-			for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents() * simData->numInletPorts(); ++i, ++outlet)
-			{
-				// Note that the simulation only saves the chromatogram at multiples of 2 (i.e., 0s, 2s, 4s, ...)
-				// whereas the reference solution is given at every second (0s, 1s, 2s, 3s, ...)
-				// Thus, we only take the even indices of the reference array
-				CAPTURE(time[2 * i]);
-				CHECK((*outlet) == makeApprox(ref[2 * i], relTol, absTol));
-			}
+	void testAnalyticBenchmarkMixedPrecision(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, int refinementSteps, double absTol, double relTol)
+	{
+		const std::string fwdStr = (forwardFlow ? "forward" : "backward");
+		SECTION("Analytic " + fwdStr + " flow with " + (dynamicBinding ? "dynamic" : "quasi-stationary") + " binding (mixed precision)")
+		{
+			// Setup simulation
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(dynamicBinding, false, uoType);
+			setNumAxialCells(jpp, nCol);
+			setMixedPrecision(jpp, refinementSteps);
+			if (!forwardFlow)
+				reverseFlow(jpp);
+
+			compareAnalyticBenchmark(jpp, refFileRelPath, dynamicBinding, absTol, relTol);
+		}
+	}
+
+	void testAnalyticBenchmarkBatchedParticleSolver(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, double absTol, double relTol)
+	{
+		const std::string fwdStr = (forwardFlow ? "forward" : "backward");
+		SECTION("Analytic " + fwdStr + " flow with " + (dynamicBinding ? "dynamic" : "quasi-stationary") + " binding (batched particle solver)")
+		{
+			// Setup simulation
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(dynamicBinding, false, uoType);
+			setNumAxialCells(jpp, nCol);
+			setBatchedParticleSolver(jpp);
+			if (!forwardFlow)
+				reverseFlow(jpp);
+
+			compareAnalyticBenchmark(jpp, refFileRelPath, dynamicBinding, absTol, relTol);
 		}
 	}
 
@@ -42,6 +42,67 @@ namespace column
 	 */
 	void setNumAxialCells(cadet::JsonParameterProvider& jpp, unsigned int nCol, std::string unitID="000");
 
+	/**
+	 * @brief Selects the DG axial discretization in a configuration of a column-like unit operation
+	 * @details Sets the AXIAL_DISC_TYPE, POLYDEG, and NELEM fields in the discretization group of the given ParameterProvider.
+	 * @param [in,out] jpp ParameterProvider to change the axial discretization in
+	 * @param [in] polyDeg Polynomial degree of the DG elements
+	 * @param [in] nElem Number of axial DG elements
+	 * @param [in] unitID unit operation ID
+	 */
+	void setAxialDG(cadet::JsonParameterProvider& jpp, unsigned int polyDeg, unsigned int nElem, std::string unitID="000");
+
+	/**
+	 * @brief Selects the orthogonal collocation particle discretization in a configuration of a column-like unit operation
+	 * @details Sets the PAR_DISC_TYPE and NPAR fields in the discretization group of the given ParameterProvider.
+	 * @param [in,out] jpp ParameterProvider to change the particle discretization in
+	 * @param [in] nPar Number of collocation nodes
+	 * @param [in] unitID unit operation ID
+	 */
+	void setParticleCollocation(cadet::JsonParameterProvider& jpp, unsigned int nPar, std::string unitID="000");
+
+	/**
+	 * @brief Enables the adaptive axial grid in a configuration of a column-like unit operation
+	 * @param [in,out] jpp ParameterProvider to change the configuration in
+	 * @param [in] threshold Front detection threshold
+	 * @param [in] maxRefinement Maximum ratio of largest to smallest cell width
+	 * @param [in] unitID unit operation ID
+	 */
+	void setAdaptiveAxialGrid(cadet::JsonParameterProvider& jpp, double threshold, double maxRefinement, std::string unitID="000");
+
+	/**
+	 * @brief Sets the number of cached factorizations in a configuration of a column-like unit operation
+	 * @param [in,out] jpp ParameterProvider to change the configuration in
+	 * @param [in] size Number of cached factorizations, @c 0 disables the cache
+	 * @param [in] unitID unit operation ID
+	 */
+	void setFactorizationCacheSize(cadet::JsonParameterProvider& jpp, int size, std::string unitID="000");
+
+	/**
+	 * @brief Splits the last section into sections of equal length
+	 * @details The inlet of the last section is copied to the new sections, which requires a constant
+	 *          inlet profile in the last section. All section transitions are marked as discontinuous.
+	 * @param [in,out] jpp ParameterProvider to change the configuration in
+	 * @param [in] nParts Number of sections the last section is split into
+	 * @param [in] inletID unit operation ID of the inlet
+	 */
+	void splitLastSection(cadet::JsonParameterProvider& jpp, unsigned int nParts, std::string inletID="001");
+
+	/**
+	 * @brief Enables mixed precision factorization in a configuration of a column-like unit operation
+	 * @param [in,out] jpp ParameterProvider to change the configuration in
+	 * @param [in] refinementSteps Number of iterative refinement steps
+	 * @param [in] unitID unit operation ID
+	 */
+	void setMixedPrecision(cadet::JsonParameterProvider& jpp, int refinementSteps, std::string unitID="000");
+
+	/**
+	 * @brief Enables the batched factorization of particle blocks in a configuration of a column-like unit operation
+	 * @param [in,out] jpp ParameterProvider to change the configuration in
+	 * @param [in] unitID unit operation ID
+	 */
+	void setBatchedParticleSolver(cadet::JsonParameterProvider& jpp, std::string unitID="000");
+
 	/**
 	 * @brief Sets the WENO order in a configuration of a column-like unit operation
 	 * @details Overwrites the WENO_ORDER field in the weno group of the given ParameterProvider.
@@ -89,6 +150,58 @@ namespace column
 	 */
 	void testAnalyticBenchmark(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, double absTol, double relTol);
 
+	/**
+	 * @brief Runs a simulation test comparing against (semi-)analytic single component pulse injection reference data using the DG axial discretization
+	 * @param [in] uoType Unit operation type
+	 * @param [in] refFileRelPath Path to the reference data file from the directory of this file
+	 * @param [in] forwardFlow Determines whether the unit operates in forward flow (@c true) or backwards flow (@c false)
+	 * @param [in] dynamicBinding Determines whether dynamic binding (@c true) or rapid equilibrium (@c false) is used
+	 * @param [in] polyDeg Polynomial degree of the DG elements
+	 * @param [in] nElem Number of axial DG elements
+	 * @param [in] absTol Absolute error tolerance
+	 * @param [in] relTol Relative error tolerance
+	 */
+	void testAnalyticBenchmarkDG(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int polyDeg, unsigned int nElem, double absTol, double relTol);
+
+	/**
+	 * @brief Runs a given configuration and compares its outlet against (semi-)analytic single component pulse injection reference data
+	 * @param [in] jpp Configuration of the linear benchmark
+	 * @param [in] refFileRelPath Path to the reference data file from the directory of this file
+	 * @param [in] dynamicBinding Determines whether dynamic binding (@c true) or rapid equilibrium (@c false) is used
+	 * @param [in] absTol Absolute error tolerance
+	 * @param [in] relTol Relative error tolerance
+	 */
+	void compareAnalyticBenchmark(cadet::JsonParameterProvider& jpp, const char* refFileRelPath, bool dynamicBinding, double absTol, double relTol);
+
+	/**
+	 * @brief Runs a simulation test comparing against (semi-)analytic single component pulse injection reference data
+	 * @details Linear binding model is used in the column-like unit operation. Diagonal Jacobian blocks are
+	 *          factorized in single precision with iterative refinement.
+	 * @param [in] uoType Unit operation type
+	 * @param [in] refFileRelPath Path to the reference data file from the directory of this file
+	 * @param [in] forwardFlow Determines whether the unit operates in forward flow (@c true) or backwards flow (@c false)
+	 * @param [in] dynamicBinding Determines whether dynamic binding (@c true) or rapid equilibrium (@c false) is used
+	 * @param [in] nCol Number of axial cells
+	 * @param [in] refinementSteps Number of iterative refinement steps
+	 * @param [in] absTol Absolute error tolerance
+	 * @param [in] relTol Relative error tolerance
+	 */
+	void testAnalyticBenchmarkMixedPrecision(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, int refinementSteps, double absTol, double relTol);
+
+	/**
+	 * @brief Runs a simulation test comparing against (semi-)analytic single component pulse injection reference data
+	 * @details Linear binding model is used in the column-like unit operation. All particle blocks of a
+	 *          particle type are factorized and solved together in a batch.
+	 * @param [in] uoType Unit operation type
+	 * @param [in] refFileRelPath Path to the reference data file from the directory of this file
+	 * @param [in] forwardFlow Determines whether the unit operates in forward flow (@c true) or backwards flow (@c false)
+	 * @param [in] dynamicBinding Determines whether dynamic binding (@c true) or rapid equilibrium (@c false) is used
+	 * @param [in] nCol Number of axial cells
+	 * @param [in] absTol Absolute error tolerance
+	 * @param [in] relTol Relative error tolerance
+	 */
+	void testAnalyticBenchmarkBatchedParticleSolver(const char* uoType, const char* refFileRelPath, bool forwardFlow, bool dynamicBinding, unsigned int nCol, double absTol, double relTol);
+
 	/**
 	 * @brief Runs a simulation test comparing against (semi-)analytic single component pulse injection reference data
 	 * @details The component is assumed to be non-binding.
@@ -110,6 +223,23 @@ namespace column
 	 */
 	void testWenoForwardBackward(const char* uoType, int wenoOrder, double absTol, double relTol);
 
+	/**
+	 * @brief Checks that cached factorizations of a constant Jacobian do not change the solution
+	 * @details Runs a linear benchmark with first order WENO (i.e., constant Jacobian) over several
+	 *          discontinuous sections with and without factorization cache and compares the outlets.
+	 * @param [in] uoType Unit operation type
+	 * @param [in] dynamicBinding Determines whether dynamic binding is used
+	 */
+	void testFactorizationCache(const char* uoType, bool dynamicBinding);
+
+	/**
+	 * @brief Checks that cached section constant coefficients are updated on parameter changes
+	 * @details Changes film diffusion and particle porosity of a configured model and compares
+	 *          its residual against a model that has been configured with the new values.
+	 * @param [in] uoType Unit operation type
+	 */
+	void testSectionConstantCacheUpdate(const std::string& uoType);
+
 	/**
 	 * @brief Checks the full Jacobian against AD and FD pattern switching
 	 * @details Checks the analytic Jacobian against the AD Jacobian and checks both against the FD pattern.
@@ -0,0 +1,199 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+#include "Approx.hpp"
+#include "cadet/cadet.hpp"
+
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#include "common/Driver.hpp"
+#include "ModelBuilderImpl.hpp"
+#include "model/UnitOperation.hpp"
+#include "SimulationTypes.hpp"
+
+#include "JsonTestModels.hpp"
+#include "ReactionModelTests.hpp"
+#include "SimHelper.hpp"
+#include "UnitOperationTests.hpp"
+#include "Utils.hpp"
+
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace
+{
+	/**
+	 * @brief Creates a network with four compartments, recycle flows, and an outlet in the middle
+	 * @details Compartment 0 is fed by the inlet and flows into compartments 1 and 3.
+	 *          Compartment 3 recycles some of its flow back into compartment 0 and the
+	 *          rest into compartment 2, which is drained by the unit outlet.
+	 * @param [in] nComp Number of components
+	 * @return Configuration of the compartment network
+	 */
+	inline cadet::JsonParameterProvider createRecycleNetwork(unsigned int nComp)
+	{
+		cadet::JsonParameterProvider jpp = createCompartmentNetwork(nComp, 4);
+		jpp.set("FLOW_MATRIX", std::vector<double>{
+			0.0, 0.6, 0.0, 0.7,
+			0.0, 0.0, 0.0, 0.6,
+			0.0, 0.0, 0.0, 0.0,
+			0.3, 0.0, 1.0, 0.0
+		});
+		jpp.set("COMPARTMENT_VOLUME", std::vector<double>{1.5, 0.7, 2.0, 1.1});
+		jpp.set("INLET_DISTRIBUTION", std::vector<double>{0.8, 0.0, 0.0, 0.2});
+		jpp.set("OUTLET_COMPARTMENT", 2);
+		return jpp;
+	}
+
+	inline cadet::JsonParameterProvider createLinearBindingNetwork(bool dynamic)
+	{
+		cadet::JsonParameterProvider jpp = createRecycleNetwork(2);
+		cadet::test::addBoundStates(jpp, {1, 1}, 0.6);
+		cadet::test::addLinearBindingModel(jpp, dynamic, {5.0, 4.0}, {2.0, 3.0});
+		return jpp;
+	}
+
+	inline cadet::JsonParameterProvider createReactionNetwork()
+	{
+		cadet::JsonParameterProvider jpp = createLinearBindingNetwork(true);
+		jpp.set("REACTION_MODEL", "MASS_ACTION_LAW");
+		cadet::test::reaction::extendModelWithDynamicReactions(jpp, 0, true, false, false);
+		return jpp;
+	}
+
+	inline cadet::IUnitOperation* createAndConfigureNetwork(cadet::IModelBuilder& mb, cadet::JsonParameterProvider& jpp)
+	{
+		cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit(jpp, mb);
+		const cadet::active flowIn = 1.0;
+		const cadet::active flowOut = 1.0;
+		unit->setFlowRates(&flowIn, &flowOut);
+		return unit;
+	}
+}
+
+TEST_CASE("CompartmentNetwork Jacobian vs AD w/o binding model", "[CompartmentNetwork],[UnitOp],[Jacobian],[AD]")
+{
+	cadet::JsonParameterProvider jpp = createRecycleNetwork(3);
+	cadet::test::unitoperation::testJacobianAD(jpp);
+}
+
+TEST_CASE("CompartmentNetwork Jacobian vs AD with linear binding", "[CompartmentNetwork],[UnitOp],[Jacobian],[AD]")
+{
+	for (int bindingMode = 0; bindingMode < 2; ++bindingMode)
+	{
+		const bool isKinetic = (bindingMode == 0);
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createLinearBindingNetwork(isKinetic);
+			cadet::test::unitoperation::testJacobianAD(jpp);
+		}
+	}
+}
+
+TEST_CASE("CompartmentNetwork dynamic reactions Jacobian vs AD", "[CompartmentNetwork],[UnitOp],[Jacobian],[AD],[ReactionModel]")
+{
+	cadet::JsonParameterProvider jpp = createReactionNetwork();
+	cadet::test::unitoperation::testJacobianAD(jpp);
+}
+
+TEST_CASE("CompartmentNetwork time derivative Jacobian vs FD with linear binding", "[CompartmentNetwork],[UnitOp],[Residual],[Jacobian]")
+{
+	for (int bindingMode = 0; bindingMode < 2; ++bindingMode)
+	{
+		const bool isKinetic = (bindingMode == 0);
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createLinearBindingNetwork(isKinetic);
+			cadet::test::unitoperation::testTimeDerivativeJacobianFD(jpp, 1e-6, 0.0, 1e-4);
+		}
+	}
+}
+
+TEST_CASE("CompartmentNetwork consistent initialization with linear binding", "[CompartmentNetwork],[ConsistentInit]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	for (int bindingMode = 0; bindingMode < 2; ++bindingMode)
+	{
+		const bool isKinetic = (bindingMode == 0);
+		for (int adMode = 0; adMode < 2; ++adMode)
+		{
+			const bool adEnabled = (adMode > 0);
+			SECTION(std::string(isKinetic ? "Kinetic binding" : "Quasi-stationary binding") + " with AD " + (adEnabled ? "enabled" : "disabled"))
+			{
+				cadet::JsonParameterProvider jpp = createLinearBindingNetwork(isKinetic);
+				cadet::IUnitOperation* const unit = createAndConfigureNetwork(*mb, jpp);
+
+				std::vector<double> y(unit->numDofs(), 0.0);
+				cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, y.size());
+
+				cadet::test::unitoperation::testConsistentInitialization(unit, adEnabled, y.data(), 1e-14, 1e-12);
+				mb->destroyUnitOperation(unit);
+			}
+		}
+	}
+	destroyModelBuilder(mb);
+}
+
+TEST_CASE("CompartmentNetwork inlet DOF Jacobian", "[CompartmentNetwork],[UnitOp],[Jacobian],[Inlet]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	for (int adMode = 0; adMode < 2; ++adMode)
+	{
+		const bool adEnabled = (adMode > 0);
+		SECTION(std::string("AD ") + (adEnabled ? "enabled" : "disabled"))
+		{
+			cadet::JsonParameterProvider jpp = createLinearBindingNetwork(true);
+			cadet::IUnitOperation* const unit = createAndConfigureNetwork(*mb, jpp);
+			cadet::test::unitoperation::testInletDofJacobian(unit, adEnabled);
+			mb->destroyUnitOperation(unit);
+		}
+	}
+	destroyModelBuilder(mb);
+}
+
+TEST_CASE("CompartmentNetwork tanks in series vs analytic solution", "[CompartmentNetwork],[Simulation]")
+{
+	const unsigned int nCompartment = 5;
+	cadet::JsonParameterProvider jpp = createCompartmentNetworkBenchmark(nCompartment, 20.0, 0.5);
+	cadet::test::setSectionTimes(jpp, {0.0, 20.0});
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	double const* outlet = simData->outlet();
+	double const* time = drv.solution()->time();
+
+	// Step response of N tanks in series with residence time tau = V / Q = 1 each
+	for (unsigned int i = 0; i < simData->numDataPoints(); ++i, ++outlet, ++time)
+	{
+		double sum = 0.0;
+		double term = 1.0;
+		for (unsigned int j = 0; j < nCompartment; ++j)
+		{
+			sum += term;
+			term *= *time / static_cast<double>(j + 1);
+		}
+
+		CAPTURE(*time);
+		CHECK((*outlet) == cadet::test::makeApprox(1.0 - std::exp(-*time) * sum, 1e-5, 2e-5));
+	}
+}
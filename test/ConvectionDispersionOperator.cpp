@@ -112,11 +112,13 @@ namespace
 		}	
 	}
 
-	inline cadet::active* createAndConfigureOperator(cadet::model::parts::ConvectionDispersionOperator& convDispOp, int& nComp, int& nCol, int wenoOrder)
+	inline cadet::active* createAndConfigureOperator(cadet::model::parts::ConvectionDispersionOperator& convDispOp, int& nComp, int& nCol, int wenoOrder, bool adaptive = false)
 	{
 		// Obtain parameters from some test case
 		cadet::JsonParameterProvider jpp = createColumnWithSMA("GENERAL_RATE_MODEL");
 		cadet::test::column::setWenoOrder(jpp, wenoOrder);
+		if (adaptive)
+			cadet::test::column::setAdaptiveAxialGrid(jpp, 0.05, 8.0);
 
 		nComp = jpp.getInt("NCOMP");
 		jpp.pushScope("discretization");
@@ -390,7 +392,8 @@ void testBulkJacobianSparsityWeno(int wenoOrder, bool forwardFlow)
 			static_cast<unsigned int>(nComp),
 			static_cast<unsigned int>(nCol),
 			0u,
-			static_cast<unsigned int>(nComp)
+			static_cast<unsigned int>(nComp),
+			nullptr
 		};
 
 		// Obtain sparsity pattern
@@ -464,7 +467,8 @@ void testBulkJacobianSparseBandedWeno(int wenoOrder, bool forwardFlow)
 			static_cast<unsigned int>(nComp),
 			static_cast<unsigned int>(nCol),
 			0u,
-			static_cast<unsigned int>(nComp)
+			static_cast<unsigned int>(nComp),
+			nullptr
 		};
 
 		// Obtain sparsity pattern
@@ -510,6 +514,118 @@ void testBulkJacobianSparseBandedWeno(int wenoOrder, bool forwardFlow)
 	}
 }
 
+void testBulkJacobianAdaptiveGrid(int wenoOrder, bool forwardFlow)
+{
+	SECTION("WENO=" + std::to_string(wenoOrder))
+	{
+		int nComp = 0;
+		int nCol = 0;
+		cadet::model::parts::ConvectionDispersionOperator opAna;
+		cadet::model::parts::ConvectionDispersionOperator opAD;
+		cadet::active* const anaVelocity = createAndConfigureOperator(opAna, nComp, nCol, wenoOrder, true);
+		cadet::active* const adVelocity = createAndConfigureOperator(opAD, nComp, nCol, wenoOrder, true);
+		if (!forwardFlow)
+		{
+			anaVelocity->setValue(-anaVelocity->getValue());
+			adVelocity->setValue(-adVelocity->getValue());
+		}
+
+		// Enable AD
+		const unsigned int nDof = nComp + nCol * nComp;
+		cadet::ad::setDirections(cadet::ad::getMaxDirections());
+		cadet::active* adRes = new cadet::active[nDof];
+		cadet::active* adY = new cadet::active[nDof];
+
+		opAD.prepareADvectors(cadet::AdJacobianParams{adRes, adY, 0u});
+
+		// State with a front at one third of the column
+		std::vector<double> y(nDof, 0.0);
+		std::vector<double> jacDir(nDof, 0.0);
+		std::vector<double> jacCol1(nDof, 0.0);
+		std::vector<double> jacCol2(nDof, 0.0);
+		for (int i = 0; i < nComp; ++i)
+			y[i] = i + 1.0;
+		fillStateBulkFwd(y.data(), [=](unsigned int comp, unsigned int col, unsigned int idx) { return (3 * col < static_cast<unsigned int>(nCol) ? 1.0 : 1e-3) + 1e-2 * std::abs(std::sin(idx * 0.13)); }, nComp, nCol);
+
+		// Remember mass of a constant and a nonconstant field on the uniform grid
+		std::vector<double> field(2 * nCol, 1.0);
+		double mass = 0.0;
+		for (int col = 0; col < nCol; ++col)
+		{
+			field[2 * col + 1] = y[nComp + col * nComp];
+			mass += field[2 * col + 1] / nCol;
+		}
+
+		REQUIRE(opAna.adaptAxialGrid(y.data()));
+		REQUIRE(opAD.adaptAxialGrid(y.data()));
+
+		// Recover relative cell widths from cell centers
+		std::vector<double> width(nCol, 0.0);
+		width[0] = 2.0 * opAna.relativeCoordinate(0);
+		for (int col = 1; col < nCol; ++col)
+			width[col] = 2.0 * (opAna.relativeCoordinate(col) - opAna.relativeCoordinate(col - 1)) - width[col - 1];
+
+		// Cells around the front are smaller than at the column ends
+		const int front = nCol / 3;
+		CHECK(width[front] < width[0]);
+		CHECK(width[front] < width[nCol - 1]);
+
+		// Remapping preserves constants and mass
+		opAna.remapAxialField(field.data(), 2, 2);
+		double remappedMass = 0.0;
+		for (int col = 0; col < nCol; ++col)
+		{
+			CHECK(field[2 * col] == RelApprox(1.0));
+			remappedMass += field[2 * col + 1] * width[col];
+		}
+		CHECK(remappedMass == RelApprox(mass));
+
+		// Setup matrices
+		opAna.notifyDiscontinuousSectionTransition(0.0, 0u, cadet::AdJacobianParams{nullptr, nullptr, 0u});
+		opAD.notifyDiscontinuousSectionTransition(0.0, 0u, cadet::AdJacobianParams{adRes, adY, 0u});
+
+		// Compute state Jacobian
+		opAna.residual(0.0, 0u, y.data(), nullptr, jacDir.data(), true, cadet::WithoutParamSensitivity());
+		std::fill(jacDir.begin(), jacDir.end(), 0.0);
+
+		cadet::ad::copyToAd(y.data(), adY, nDof);
+		cadet::ad::resetAd(adRes, nDof);
+		opAD.residual(0.0, 0u, adY, nullptr, adRes, false, cadet::WithoutParamSensitivity());
+		opAD.extractJacobianFromAD(adRes, 0);
+
+		const std::function<void(double const*, double*)> anaResidual = [&](double const* lDir, double* res) -> void
+			{
+				opAna.residual(0.0, 0u, lDir - nComp, nullptr, res - nComp, false, cadet::WithoutParamSensitivity());
+			};
+
+		const std::function<void(double const*, double*)> anaMultJac = [&](double const* lDir, double* res) -> void
+			{
+				opAna.jacobian().multiplyVector(lDir, 1.0, 0.0, res);
+			};
+
+		const std::function<void(double const*, double*)> adMultJac = [&](double const* lDir, double* res) -> void
+			{
+				opAD.jacobian().multiplyVector(lDir, 1.0, 0.0, res);
+			};
+
+		// Check analytic Jacobian against FD
+		cadet::test::compareJacobianFD(anaResidual, anaMultJac, y.data() + nComp, jacDir.data() + nComp, jacCol1.data() + nComp, jacCol2.data() + nComp, nDof - nComp, 1e-6, 1e-6, 1e-5);
+
+		// Check analytic vs AD Jacobian
+		cadet::test::compareJacobian(anaMultJac, adMultJac, jacDir.data(), jacCol1.data(), jacCol2.data(), nDof - nComp);
+
+		// Check derivative with respect to inlet against FD (residual is linear in inlet)
+		const int firstCell = nComp + (forwardFlow ? 0 : (nCol - 1) * nComp);
+		opAna.residual(0.0, 0u, y.data(), nullptr, jacCol1.data(), false, cadet::WithoutParamSensitivity());
+		y[0] += 1.0;
+		opAna.residual(0.0, 0u, y.data(), nullptr, jacCol2.data(), false, cadet::WithoutParamSensitivity());
+		CHECK(jacCol2[firstCell] - jacCol1[firstCell] == RelApprox(opAna.inletJacobian()));
+
+		delete[] adRes;
+		delete[] adY;
+	}
+}
+
 TEST_CASE("ConvectionDispersionOperator residual forward vs backward flow", "[Operator],[Residual]")
 {
 	// Test all WENO orders
@@ -560,3 +676,19 @@ TEST_CASE("ConvectionDispersionKernel Jacobian sparse vs banded", "[Operator],[J
 			testBulkJacobianSparseBandedWeno(i, false);
 	}
 }
+
+TEST_CASE("ConvectionDispersionOperator Jacobian on adaptive axial grid", "[Operator],[Residual],[Jacobian],[AD],[AdaptiveGrid]")
+{
+	SECTION("Forward flow")
+	{
+		// Test all WENO orders
+		for (unsigned int i = 1; i <= cadet::Weno::maxOrder(); ++i)
+			testBulkJacobianAdaptiveGrid(i, true);
+	}
+	SECTION("Backward flow")
+	{
+		// Test all WENO orders
+		for (unsigned int i = 1; i <= cadet::Weno::maxOrder(); ++i)
+			testBulkJacobianAdaptiveGrid(i, false);
+	}
+}
@@ -22,6 +22,7 @@
 #include "ParticleHelper.hpp"
 #include "ReactionModelTests.hpp"
 #include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
 #include "Weno.hpp"
 #include "Utils.hpp"
 
@@ -40,6 +41,18 @@ TEST_CASE("GRM linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic
 	cadet::test::column::testAnalyticBenchmark("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", false, false, 512, 6e-5, 1e-7);
 }
 
+TEST_CASE("GRM mixed precision linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic],[MixedPrecision],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", true, true, 512, 2, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", false, false, 512, 2, 6e-5, 1e-7);
+}
+
+TEST_CASE("GRM batched particle solver linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic],[BatchedParticleSolver],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkBatchedParticleSolver("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", true, true, 512, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkBatchedParticleSolver("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", false, false, 512, 6e-5, 1e-7);
+}
+
 TEST_CASE("GRM non-binding linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic],[NonBinding],[CI]")
 {
 	cadet::test::column::testAnalyticNonBindingBenchmark("GENERAL_RATE_MODEL", "/data/grm-nonBinding.data", true, 512, 6e-5, 1e-7);
@@ -201,12 +214,65 @@ TEST_CASE("GRM inlet DOF Jacobian", "[GRM],[UnitOp],[Jacobian],[Inlet],[CI]")
 	cadet::test::column::testInletDofJacobian("GENERAL_RATE_MODEL");
 }
 
+TEST_CASE("GRM cached flux coefficients follow parameter changes", "[GRM],[UnitOp],[Residual],[CI]")
+{
+	cadet::test::column::testSectionConstantCacheUpdate("GENERAL_RATE_MODEL");
+}
+
 TEST_CASE("GRM transport Jacobian", "[GRM],[UnitOp],[Jacobian],[CI]")
 {
 	cadet::JsonParameterProvider jpp = createColumnLinearBenchmark(false, true, "GENERAL_RATE_MODEL");
 	cadet::test::column::testJacobianAD(jpp);
 }
 
+TEST_CASE("GRM DG transport Jacobian", "[GRM],[UnitOp],[Jacobian],[DG],[CI]")
+{
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::test::column::setAxialDG(jpp, 3, 4);
+	cadet::test::column::testJacobianAD(jpp);
+
+	cadet::test::column::reverseFlow(jpp);
+	cadet::test::column::testJacobianAD(jpp);
+}
+
+TEST_CASE("GRM DG linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic],[DG],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkDG("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", true, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", true, false, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", false, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("GENERAL_RATE_MODEL", "/data/grm-pulseBenchmark.data", false, false, 4, 16, 6e-5, 1e-7);
+}
+
+TEST_CASE("GRM collocation particle Jacobian", "[GRM],[UnitOp],[Jacobian],[Collocation],[CI]")
+{
+	for (int bindMode = 0; bindMode < 2; ++bindMode)
+	{
+		const bool isKinetic = bindMode;
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+			cadet::test::setBindingMode(jpp, isKinetic);
+			cadet::test::column::setParticleCollocation(jpp, 5);
+			cadet::test::column::testJacobianAD(jpp);
+			cadet::test::column::testArrowHeadJacobianFD(jpp, 1e-6, 1e-9, 2e-9);
+		}
+	}
+}
+
+TEST_CASE("GRM collocation linear pulse vs analytic solution", "[GRM],[Simulation],[Analytic],[Collocation],[CI]")
+{
+	for (int bindMode = 0; bindMode < 2; ++bindMode)
+	{
+		const bool isKinetic = bindMode;
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(isKinetic, false, "GENERAL_RATE_MODEL");
+			cadet::test::column::setParticleCollocation(jpp, 6);
+			cadet::test::column::compareAnalyticBenchmark(jpp, "/data/grm-pulseBenchmark.data", isKinetic, 6e-5, 1e-7);
+		}
+	}
+}
+
 TEST_CASE("GRM with two component linear binding Jacobian", "[GRM],[UnitOp],[Jacobian],[CI]")
 {
 	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
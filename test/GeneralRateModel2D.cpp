@@ -139,6 +139,11 @@ TEST_CASE("GRM2D inlet DOF Jacobian", "[GRM2D],[UnitOp],[Jacobian],[Inlet],[CIgr
 	cadet::test::column::testInletDofJacobian("GENERAL_RATE_MODEL_2D");
 }
 
+TEST_CASE("GRM2D cached flux coefficients follow parameter changes", "[GRM2D],[UnitOp],[Residual],[CIgrm2d]")
+{
+	cadet::test::column::testSectionConstantCacheUpdate("GENERAL_RATE_MODEL_2D");
+}
+
 TEST_CASE("GRM2D LWE one vs two identical particle types match", "[GRM2D],[Simulation],[ParticleType],[CIgrm2d]")
 {
 	cadet::test::particle::testOneVsTwoIdenticalParticleTypes("GENERAL_RATE_MODEL_2D", 1e-7, 5e-5);
@@ -475,3 +475,56 @@ TEST_CASE("Multi connected components graph all ports all comps no cycles 2", "[
 
 	REQUIRE(!cycle);
 }
+
+TEST_CASE("Strongly connected components of graph with cycles", "[Graph]")
+{
+	/*
+		8 Units
+		0 -> 1 <-> 2 -> 3 -> 4 -> 5 -> 3   (6 -> 6 self loop, 7 not connected)
+		          2 -> 6
+	*/
+
+	const int nUnits = 8;
+	const std::vector<int> connections = {
+		0, 1, -1, -1, -1, -1,
+		1, 2, -1, -1, -1, -1,
+		2, 1, -1, -1, -1, -1,
+		2, 3, -1, -1, -1, -1,
+		3, 4, -1, -1, -1, -1,
+		4, 5, -1, -1, -1, -1,
+		5, 3, -1, -1, -1, -1,
+		2, 6, -1, -1, -1, -1,
+		6, 6, -1, -1, -1, -1
+	};
+	cadet::util::SlicedVector<int> adjList = cadet::graph::adjacencyListFromConnectionList(connections.data(), nUnits, connections.size() / 6);
+	checkAdjacencyList(nUnits, connections, adjList);
+
+	std::vector<int> topoOrder;
+	REQUIRE(cadet::graph::topologicalSort(adjList, topoOrder));
+
+	const cadet::util::SlicedVector<int> scc = cadet::graph::stronglyConnectedComponents(adjList);
+	REQUIRE(scc.slices() == 5);
+	REQUIRE(scc.size() == nUnits);
+
+	// Find component of each node
+	std::vector<int> compIdx(nUnits, -1);
+	for (int i = 0; i < static_cast<int>(scc.slices()); ++i)
+	{
+		for (int j = 0; j < static_cast<int>(scc.sliceSize(i)); ++j)
+			compIdx[scc(i, j)] = i;
+	}
+
+	CHECK(compIdx[1] == compIdx[2]);
+	CHECK(compIdx[3] == compIdx[4]);
+	CHECK(compIdx[3] == compIdx[5]);
+	CHECK(scc.sliceSize(compIdx[0]) == 1);
+	CHECK(scc.sliceSize(compIdx[6]) == 1);
+	CHECK(scc.sliceSize(compIdx[7]) == 1);
+
+	// Reverse topological order: Components are listed before the ones they depend on
+	for (int i = 0; i < static_cast<int>(connections.size() / 6); ++i)
+		CHECK(compIdx[connections[6 * i]] >= compIdx[connections[6 * i + 1]]);
+
+	CHECK(cadet::graph::hasSelfLoop(adjList, 6));
+	CHECK(!cadet::graph::hasSelfLoop(adjList, 2));
+}
@@ -0,0 +1,168 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+#include "Approx.hpp"
+#include "cadet/cadet.hpp"
+
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#include "common/Driver.hpp"
+#include "common/JsonParameterProvider.hpp"
+#include "ModelBuilderImpl.hpp"
+
+#include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace
+{
+	inline std::unique_ptr<cadet::IInletProfile> createTabulatedInlet(const std::vector<double>& time, const std::vector<double>& data, unsigned int nComp, const char* method)
+	{
+		cadet::ModelBuilder mb;
+		std::unique_ptr<cadet::IInletProfile> inlet(mb.createInletProfile("TABULATED"));
+		REQUIRE(inlet);
+
+		cadet::JsonParameterProvider jpp("{}");
+		jpp.set("TIME", time);
+		jpp.set("DATA", data);
+		jpp.set("INTERPOLATION", method);
+
+		REQUIRE(inlet->configure(&jpp, nComp));
+		return inlet;
+	}
+}
+
+TEST_CASE("Tabulated inlet linear interpolation", "[InletProfile]")
+{
+	const std::vector<double> time{0.0, 1.0, 3.0, 4.0};
+	const std::vector<double> data{0.0, 1.0, 2.0, 1.0, 2.0, 5.0, 1.0, 5.0};
+	std::unique_ptr<cadet::IInletProfile> inlet = createTabulatedInlet(time, data, 2, "LINEAR");
+
+	double conc[2];
+	double deriv[2];
+
+	// Section index is ignored
+	inlet->inletConcentration(2.0, 7u, conc);
+	inlet->timeDerivative(2.0, 7u, deriv);
+	CHECK(conc[0] == cadet::test::makeApprox(2.0, 1e-14, 1e-14));
+	CHECK(conc[1] == cadet::test::makeApprox(3.0, 1e-14, 1e-14));
+	CHECK(deriv[0] == cadet::test::makeApprox(0.0, 1e-14, 1e-14));
+	CHECK(deriv[1] == cadet::test::makeApprox(2.0, 1e-14, 1e-14));
+
+	// Constant extrapolation
+	inlet->inletConcentration(-1.0, 0u, conc);
+	inlet->timeDerivative(-1.0, 0u, deriv);
+	CHECK(conc[0] == 0.0);
+	CHECK(conc[1] == 1.0);
+	CHECK(deriv[0] == 0.0);
+
+	inlet->inletConcentration(10.0, 0u, conc);
+	inlet->timeDerivative(10.0, 0u, deriv);
+	CHECK(conc[0] == 1.0);
+	CHECK(conc[1] == 5.0);
+	CHECK(deriv[1] == 0.0);
+
+	// Jump back and forth to invalidate the interval cache
+	inlet->inletConcentration(0.5, 0u, conc);
+	CHECK(conc[0] == cadet::test::makeApprox(1.0, 1e-14, 1e-14));
+	inlet->inletConcentration(3.5, 0u, conc);
+	CHECK(conc[0] == cadet::test::makeApprox(1.5, 1e-14, 1e-14));
+}
+
+TEST_CASE("Tabulated inlet monotone cubic interpolation", "[InletProfile]")
+{
+	// Step-like monotone data that makes unconstrained cubic splines overshoot
+	const std::vector<double> time{0.0, 1.0, 2.0, 2.5, 3.0, 5.0, 8.0};
+	const std::vector<double> data{0.0, 0.0, 0.1, 0.9, 1.0, 1.0, 1.0};
+	std::unique_ptr<cadet::IInletProfile> inlet = createTabulatedInlet(time, data, 1, "MONOTONE_CUBIC");
+
+	double conc = 0.0;
+
+	// Interpolates the data points
+	for (std::size_t i = 0; i < time.size(); ++i)
+	{
+		inlet->inletConcentration(time[i], 0u, &conc);
+		CHECK(conc == cadet::test::makeApprox(data[i], 1e-12, 1e-14));
+	}
+
+	// Monotone and bounded by the data, time derivative matches finite differences
+	double prev = 0.0;
+	const double h = 1e-6;
+	for (double t = 0.005; t < 8.0; t += 0.01)
+	{
+		CAPTURE(t);
+		inlet->inletConcentration(t, 0u, &conc);
+		CHECK(conc >= prev - 1e-14);
+		CHECK(conc >= 0.0);
+		CHECK(conc <= 1.0 + 1e-14);
+		prev = conc;
+
+		double deriv = 0.0;
+		double left = 0.0;
+		double right = 0.0;
+		inlet->timeDerivative(t, 0u, &deriv);
+		inlet->inletConcentration(t - h, 0u, &left);
+		inlet->inletConcentration(t + h, 0u, &right);
+		CHECK(deriv == cadet::test::makeApprox((right - left) / (2.0 * h), 1e-5, 1e-8));
+	}
+}
+
+TEST_CASE("CSTR with tabulated inlet in single section vs piecewise polynomial inlet", "[InletProfile],[CSTR],[Simulation]")
+{
+	// Reference: linear ramp from 0 to 1 on [0, 10] and constant 1 afterwards in two sections
+	cadet::JsonParameterProvider jppRef = createCSTRBenchmark(2, 30.0, 1.0);
+	cadet::test::setSectionTimes(jppRef, {0.0, 10.0, 30.0});
+	cadet::test::setInletProfile(jppRef, 0, 0, 0.0, 0.1, 0.0, 0.0);
+	cadet::test::setInletProfile(jppRef, 1, 0, 1.0, 0.0, 0.0, 0.0);
+
+	// Same profile as tabulated data in a single section
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 30.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 30.0});
+	{
+		jpp.pushScope("model");
+		jpp.pushScope("unit_001");
+
+		jpp.set("INLET_TYPE", "TABULATED");
+		jpp.set("INTERPOLATION", "LINEAR");
+		jpp.set("TIME", std::vector<double>{0.0, 10.0, 30.0});
+		jpp.set("DATA", std::vector<double>{0.0, 1.0, 1.0});
+
+		jpp.popScope();
+		jpp.popScope();
+	}
+
+	cadet::Driver drvRef;
+	drvRef.configure(jppRef);
+	drvRef.run();
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const simDataRef = drvRef.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	REQUIRE(simData->numDataPoints() == simDataRef->numDataPoints());
+
+	double const* outletRef = simDataRef->outlet();
+	double const* outlet = simData->outlet();
+	double const* time = drv.solution()->time();
+	for (unsigned int i = 0; i < simData->numDataPoints(); ++i, ++outlet, ++outletRef, ++time)
+	{
+		CAPTURE(*time);
+		CHECK((*outlet) == cadet::test::makeApprox(*outletRef, 1e-4, 1e-5));
+	}
+}
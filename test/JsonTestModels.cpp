@@ -941,7 +941,30 @@ cadet::JsonParameterProvider createCSTR(unsigned int nComp)
 	return cadet::JsonParameterProvider(createCSTRJson(nComp));
 }
 
-cadet::JsonParameterProvider createCSTRBenchmark(unsigned int nSec, double endTime, double interval)
+json createCompartmentNetworkJson(unsigned int nComp, unsigned int nCompartment)
+{
+	json config;
+	config["UNIT_TYPE"] = std::string("COMPARTMENT_NETWORK");
+	config["NCOMP"] = static_cast<int>(nComp);
+	config["NCOMPARTMENT"] = static_cast<int>(nCompartment);
+	config["COMPARTMENT_VOLUME"] = std::vector<double>(nCompartment, 1.0);
+	config["INIT_C"] = std::vector<double>(nComp, 0.0);
+
+	// Compartments are connected in series with unit flow rate
+	std::vector<double> flow(nCompartment * nCompartment, 0.0);
+	for (unsigned int i = 0; i + 1 < nCompartment; ++i)
+		flow[i * nCompartment + i + 1] = 1.0;
+
+	config["FLOW_MATRIX"] = flow;
+	return config;
+}
+
+cadet::JsonParameterProvider createCompartmentNetwork(unsigned int nComp, unsigned int nCompartment)
+{
+	return cadet::JsonParameterProvider(createCompartmentNetworkJson(nComp, nCompartment));
+}
+
+json createCSTRBenchmarkJson(unsigned int nSec, double endTime, double interval)
 {
 	std::ostringstream ss;
 
@@ -1103,5 +1126,18 @@ cadet::JsonParameterProvider createCSTRBenchmark(unsigned int nSec, double endTi
 
 		config["solver"] = solver;
 	}
+	return config;
+}
+
+cadet::JsonParameterProvider createCSTRBenchmark(unsigned int nSec, double endTime, double interval)
+{
+	return cadet::JsonParameterProvider(createCSTRBenchmarkJson(nSec, endTime, interval));
+}
+
+cadet::JsonParameterProvider createCompartmentNetworkBenchmark(unsigned int nCompartment, double endTime, double interval)
+{
+	json config = createCSTRBenchmarkJson(1, endTime, interval);
+	config["model"]["unit_000"] = createCompartmentNetworkJson(1, nCompartment);
+	config["return"]["unit_000"]["WRITE_SOLUTION_VOLUME"] = false;
 	return cadet::JsonParameterProvider(config);
 }
@@ -28,5 +28,7 @@ cadet::JsonParameterProvider createPulseInjectionColumn(const std::string& uoTyp
 cadet::JsonParameterProvider createLinearBenchmark(bool dynamicBinding, bool nonBinding, const std::string& uoType);
 cadet::JsonParameterProvider createCSTR(unsigned int nComp);
 cadet::JsonParameterProvider createCSTRBenchmark(unsigned int nSec, double endTime, double interval);
+cadet::JsonParameterProvider createCompartmentNetwork(unsigned int nComp, unsigned int nCompartment);
+cadet::JsonParameterProvider createCompartmentNetworkBenchmark(unsigned int nCompartment, double endTime, double interval);
 
 #endif  // CADETTEST_JSONTESTMODELS_HPP_
@@ -34,6 +34,12 @@ TEST_CASE("LRMP linear pulse vs analytic solution", "[LRMP],[Simulation],[Analyt
 	cadet::test::column::testAnalyticBenchmark("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", false, false, 512, 6e-5, 1e-7);
 }
 
+TEST_CASE("LRMP mixed precision linear pulse vs analytic solution", "[LRMP],[Simulation],[Analytic],[MixedPrecision],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", true, true, 512, 2, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", false, false, 512, 2, 6e-5, 1e-7);
+}
+
 TEST_CASE("LRMP non-binding linear pulse vs analytic solution", "[LRMP],[Simulation],[Analytic],[NonBinding],[CI]")
 {
 	cadet::test::column::testAnalyticNonBindingBenchmark("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-nonBinding.data", true, 512, 6e-5, 1e-7);
@@ -176,12 +182,35 @@ TEST_CASE("LRMP inlet DOF Jacobian", "[LRMP],[UnitOp],[Jacobian],[Inlet],[CI]")
 	cadet::test::column::testInletDofJacobian("LUMPED_RATE_MODEL_WITH_PORES");
 }
 
+TEST_CASE("LRMP cached flux coefficients follow parameter changes", "[LRMP],[UnitOp],[Residual],[CI]")
+{
+	cadet::test::column::testSectionConstantCacheUpdate("LUMPED_RATE_MODEL_WITH_PORES");
+}
+
 TEST_CASE("LRMP transport Jacobian", "[LRMP],[UnitOp],[Jacobian],[CI]")
 {
 	cadet::JsonParameterProvider jpp = createColumnLinearBenchmark(false, true, "LUMPED_RATE_MODEL_WITH_PORES");
 	cadet::test::column::testJacobianAD(jpp);
 }
 
+TEST_CASE("LRMP DG transport Jacobian", "[LRMP],[UnitOp],[Jacobian],[DG],[CI]")
+{
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("LUMPED_RATE_MODEL_WITH_PORES");
+	cadet::test::column::setAxialDG(jpp, 3, 4);
+	cadet::test::column::testJacobianAD(jpp);
+
+	cadet::test::column::reverseFlow(jpp);
+	cadet::test::column::testJacobianAD(jpp);
+}
+
+TEST_CASE("LRMP DG linear pulse vs analytic solution", "[LRMP],[Simulation],[Analytic],[DG],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", true, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", true, false, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", false, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITH_PORES", "/data/lrmp-pulseBenchmark.data", false, false, 4, 16, 6e-5, 1e-7);
+}
+
 TEST_CASE("LRMP with two component linear binding Jacobian", "[LRMP],[UnitOp],[Jacobian],[CI]")
 {
 	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("LUMPED_RATE_MODEL_WITH_PORES");
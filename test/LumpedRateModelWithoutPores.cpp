@@ -33,6 +33,12 @@ TEST_CASE("LRM linear pulse vs analytic solution", "[LRM],[Simulation],[Referenc
 	cadet::test::column::testAnalyticBenchmark("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", false, false, 1024, 2e-5, 1e-7);
 }
 
+TEST_CASE("LRM mixed precision linear pulse vs analytic solution", "[LRM],[Simulation],[Analytic],[MixedPrecision],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", true, true, 1024, 2, 2e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkMixedPrecision("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", false, false, 1024, 2, 2e-5, 1e-7);
+}
+
 TEST_CASE("LRM non-binding linear pulse vs analytic solution", "[LRM],[Simulation],[Reference],[Analytic],[NonBinding],[CI]")
 {
 	cadet::test::column::testAnalyticNonBindingBenchmark("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-nonBinding.data", true, 1024, 2e-5, 1e-7);
@@ -172,6 +178,51 @@ TEST_CASE("LRM transport Jacobian", "[LRM],[UnitOp],[Jacobian],[CI]")
 	cadet::test::column::testJacobianAD(jpp);
 }
 
+TEST_CASE("LRM DG transport Jacobian", "[LRM],[UnitOp],[Jacobian],[DG],[CI]")
+{
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("LUMPED_RATE_MODEL_WITHOUT_PORES");
+	cadet::test::column::setAxialDG(jpp, 3, 4);
+	cadet::test::column::testJacobianAD(jpp);
+
+	cadet::test::column::reverseFlow(jpp);
+	cadet::test::column::testJacobianAD(jpp);
+}
+
+TEST_CASE("LRM DG linear pulse vs analytic solution", "[LRM],[Simulation],[Analytic],[DG],[CI]")
+{
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", true, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", true, false, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", false, true, 4, 16, 6e-5, 1e-7);
+	cadet::test::column::testAnalyticBenchmarkDG("LUMPED_RATE_MODEL_WITHOUT_PORES", "/data/lrm-pulseBenchmark.data", false, false, 4, 16, 6e-5, 1e-7);
+}
+
+TEST_CASE("LRM adaptive axial grid linear pulse vs analytic solution", "[LRM],[Simulation],[Analytic],[AdaptiveGrid],[CI]")
+{
+	for (int dir = 0; dir < 2; ++dir)
+	{
+		const bool forwardFlow = (dir == 0);
+		SECTION(forwardFlow ? "Forward flow" : "Backward flow")
+		{
+			cadet::JsonParameterProvider jpp = createLinearBenchmark(true, false, "LUMPED_RATE_MODEL_WITHOUT_PORES");
+			cadet::test::column::setNumAxialCells(jpp, 256);
+			cadet::test::column::setAdaptiveAxialGrid(jpp, 0.05, 4.0);
+			if (!forwardFlow)
+				cadet::test::column::reverseFlow(jpp);
+
+			// Adapt grid several times while the pulse travels through the column
+			cadet::test::column::splitLastSection(jpp, 16);
+
+			cadet::test::column::compareAnalyticBenchmark(jpp, "/data/lrm-pulseBenchmark.data", true, 5e-4, 1e-7);
+		}
+	}
+}
+
+TEST_CASE("LRM factorization cache with constant Jacobian", "[LRM],[Simulation],[FactorizationCache],[CI]")
+{
+	cadet::test::column::testFactorizationCache("LUMPED_RATE_MODEL_WITHOUT_PORES", false);
+	cadet::test::column::testFactorizationCache("LUMPED_RATE_MODEL_WITHOUT_PORES", true);
+}
+
 TEST_CASE("LRM with two component linear binding Jacobian", "[LRM],[UnitOp],[Jacobian],[CI]")
 {
 	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("LUMPED_RATE_MODEL_WITHOUT_PORES");
@@ -25,7 +25,9 @@
 #include "ColumnTests.hpp"
 #include "Utils.hpp"
 #include "model/UnitOperation.hpp"
+#include "common/Driver.hpp"
 
+#include <cmath>
 #include <limits>
 #include <vector>
 #include <set>
@@ -87,6 +89,7 @@ namespace
 		virtual bool setParameter(const cadet::ParameterId& pId, int value) { return false; }
 		virtual bool setParameter(const cadet::ParameterId& pId, double value) { return false; }
 		virtual bool setParameter(const cadet::ParameterId& pId, bool value) { return false; }
+		virtual bool getParameterPointers(const cadet::ParameterId& pId, std::vector<cadet::active*>& ptrs) { return false; }
 		virtual bool hasParameter(const cadet::ParameterId& pId) const { return false; }
 		virtual std::unordered_map<cadet::ParameterId, double> getAllParameterValues() const { return std::unordered_map<cadet::ParameterId, double>(); }
 		virtual double getParameterDouble(const cadet::ParameterId& pId) const { return 0.0; }
@@ -115,6 +118,7 @@ namespace
 		virtual unsigned int numSensParams() const { return 0; }
 
 		virtual void notifyDiscontinuousSectionTransition(double t, unsigned int secIdx, const cadet::ConstSimulationState& simState, const cadet::AdJacobianParams& adJac) { }
+		virtual bool adaptDiscretization(double t, unsigned int secIdx, const cadet::SimulationState& simState) { return false; }
 		virtual void applyInitialCondition(const cadet::SimulationState& simState) const { }
 		virtual void readInitialCondition(cadet::IParameterProvider& paramProvider) { }
 
@@ -1296,3 +1300,159 @@ TEST_CASE("ModelSystem coupling Jacobian component Y", "[ModelSystem],[Jacobian]
 
 	checkCouplingJacobian(sysDescription, connections, inFlow, outFlow);
 }
+
+TEST_CASE("ModelSystem parameter handles match parameter IDs", "[ModelSystem],[ParameterHandle]")
+{
+	const std::vector<cadet::ParameterId> params = {
+		// Binding model parameter (direct)
+		cadet::makeParamId(cadet::hashString("LIN_KA"), 0, 0, cadet::ParTypeIndep, 0, cadet::ReactionIndep, cadet::SectionIndep),
+		// Unit operation parameter multiplexed over particle types (direct)
+		cadet::makeParamId(cadet::hashString("FILM_DIFFUSION"), 0, 0, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep),
+		// Plain unit operation parameter (direct)
+		cadet::makeParamId(cadet::hashString("VELOCITY"), 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep),
+		// Parameter that requires an update of the discretization (fallback)
+		cadet::makeParamId(cadet::hashString("PAR_RADIUS"), 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep)
+	};
+	const std::vector<double> factors = {1.2, 0.8, 1.1, 0.9};
+
+	cadet::JsonParameterProvider jpp = createLinearBenchmark(false, false, "GENERAL_RATE_MODEL");
+
+	// Reference: Set parameters by ID
+	cadet::Driver drvRef;
+	drvRef.configure(jpp);
+	std::vector<double> values(params.size());
+	for (std::size_t i = 0; i < params.size(); ++i)
+	{
+		values[i] = drvRef.simulator()->model()->getParameterDouble(params[i]) * factors[i];
+		REQUIRE(!std::isnan(values[i]));
+		drvRef.simulator()->setParameterValue(params[i], values[i]);
+	}
+	drvRef.run();
+
+	// Set parameters by handle
+	cadet::Driver drv;
+	drv.configure(jpp);
+	std::vector<cadet::ParameterHandle> handles(params.size());
+	for (std::size_t i = 0; i < params.size(); ++i)
+		handles[i] = drv.simulator()->resolveParameter(params[i]);
+
+	// Resolving a parameter again returns the same handle
+	CHECK(drv.simulator()->resolveParameter(params[0]) == handles[0]);
+
+	drv.simulator()->setParameterValues(handles.data(), values.data(), handles.size());
+	for (std::size_t i = 0; i < params.size(); ++i)
+		CHECK(drv.simulator()->model()->getParameterDouble(params[i]) == values[i]);
+
+	drv.run();
+
+	// Compare outlets
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const simDataRef = drvRef.solution()->unitOperation(0);
+	REQUIRE(simData->numDataPoints() == simDataRef->numDataPoints());
+
+	double const* outlet = simData->outlet();
+	double const* outletRef = simDataRef->outlet();
+	for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents(); ++i)
+		CHECK(outlet[i] == outletRef[i]);
+}
+
+TEST_CASE("ModelSystem distributed unit operations", "[ModelSystem],[MPI],[CI]")
+{
+	// Distributes the unit operations only if run with multiple MPI processes (e.g., mpirun -n 2),
+	// otherwise the simulation is performed as usual
+	cadet::JsonParameterProvider jpp = createLinearBenchmark(false, false, "GENERAL_RATE_MODEL");
+
+	// Reference: All unit operations are handled by each process
+	cadet::Driver drvRef;
+	drvRef.configure(jpp);
+	drvRef.run();
+
+	jpp.pushScope("model");
+	jpp.pushScope("solver");
+	jpp.set("DISTRIBUTE_UNIT_OPERATIONS", true);
+	jpp.popScope();
+	jpp.popScope();
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	// Compare outlets
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	cadet::InternalStorageUnitOpRecorder const* const simDataRef = drvRef.solution()->unitOperation(0);
+	REQUIRE(simData->numDataPoints() == simDataRef->numDataPoints());
+
+	double const* outlet = simData->outlet();
+	double const* outletRef = simDataRef->outlet();
+	for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents(); ++i)
+		CHECK(outlet[i] == cadet::test::makeApprox(outletRef[i], 1e-6, 1e-10));
+}
+
+TEST_CASE("ModelSystem block-triangular linear solver matches parallel solver on flowsheet with recycle", "[ModelSystem],[LinearSolver],[CI]")
+{
+	/*
+		Inlet (1) -> Column (0) <-> Column (3) -> Outlet (2)
+		Columns 0 and 3 form a recycle loop, inlet and outlet are solved directly
+	*/
+	cadet::JsonParameterProvider jpp = createLinearBenchmark(false, false, "LUMPED_RATE_MODEL_WITH_PORES");
+	jpp.pushScope("model");
+	jpp.set("NUNITS", 4);
+	jpp.copy("unit_000", "unit_003");
+
+	jpp.addScope("unit_002");
+	jpp.pushScope("unit_002");
+	jpp.set("UNIT_TYPE", "OUTLET");
+	jpp.set("NCOMP", 1);
+	jpp.popScope();
+
+	jpp.pushScope("connections");
+	jpp.pushScope("switch_000");
+	jpp.set("CONNECTIONS", std::vector<double>{
+		1.0, 0.0, -1.0, -1.0, -1.0, -1.0, 1.0,
+		0.0, 3.0, -1.0, -1.0, -1.0, -1.0, 1.5,
+		3.0, 0.0, -1.0, -1.0, -1.0, -1.0, 0.5,
+		3.0, 2.0, -1.0, -1.0, -1.0, -1.0, 1.0
+	});
+	jpp.popScope();
+	jpp.popScope();
+	jpp.popScope();
+
+	jpp.pushScope("return");
+	jpp.copy("unit_000", "unit_003");
+	jpp.popScope();
+
+	const auto runWithLinearSolutionMode = [&](int mode) -> cadet::Driver*
+	{
+		jpp.pushScope("model");
+		jpp.pushScope("solver");
+		jpp.set("LINEAR_SOLUTION_MODE", mode);
+		jpp.popScope();
+		jpp.popScope();
+
+		cadet::Driver* const drv = new cadet::Driver();
+		drv->configure(jpp);
+		drv->run();
+		return drv;
+	};
+
+	// Reference: Parallel solver with GMRES on all coupling DOFs
+	std::unique_ptr<cadet::Driver> drvRef(runWithLinearSolutionMode(1));
+
+	// Block-triangular solver, explicitly requested or selected automatically
+	for (int mode : {0, 3})
+	{
+		SECTION("Linear solution mode " + std::to_string(mode))
+		{
+			std::unique_ptr<cadet::Driver> drv(runWithLinearSolutionMode(mode));
+
+			cadet::InternalStorageUnitOpRecorder const* const simData = drv->solution()->unitOperation(3);
+			cadet::InternalStorageUnitOpRecorder const* const simDataRef = drvRef->solution()->unitOperation(3);
+			REQUIRE(simData->numDataPoints() == simDataRef->numDataPoints());
+
+			double const* outlet = simData->outlet();
+			double const* outletRef = simDataRef->outlet();
+			for (unsigned int i = 0; i < simData->numDataPoints() * simData->numComponents(); ++i)
+				CHECK(outlet[i] == cadet::test::makeApprox(outletRef[i], 1e-6, 1e-10));
+		}
+	}
+}
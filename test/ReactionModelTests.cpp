@@ -185,7 +185,8 @@ namespace reaction
 		}
 
 		const std::string uoType = jpp.getString("UNIT_TYPE");
-		const bool isLRMP = (uoType == "LUMPED_RATE_MODEL_WITHOUT_PORES");
+		// These models only have a single reaction model for liquid and solid phase
+		const bool isLRMP = (uoType == "LUMPED_RATE_MODEL_WITHOUT_PORES") || (uoType == "COMPARTMENT_NETWORK");
 		const int nTotalBound = std::accumulate(nBound.begin(), nBound.end(), 0);
 
 		if (!isLRMP && bulk)
@@ -13,6 +13,10 @@
 #include <catch.hpp>
 
 #include "ReactionModelTests.hpp"
+#include "model/ReactionModel.hpp"
+#include "SimulationTypes.hpp"
+
+#include <vector>
 
 TEST_CASE("MassActionLaw kinetic analytic Jacobian vs AD", "[MassActionLaw],[ReactionModel],[Jacobian],[AD]")
 {
@@ -76,3 +80,151 @@ TEST_CASE("MassActionLaw kinetic analytic Jacobian vs AD", "[MassActionLaw],[Rea
 		point, 1e-15, 1e-15
 	);
 }
+
+namespace
+{
+	const char* const polymerizationConfig = R"json({
+			"MAL_KFWD_BULK": [1.0, 2.0, 0.4, 0.7, 1.3],
+			"MAL_KBWD_BULK": [0.1, 0.2, 1.5, 0.0, 0.6],
+			"MAL_STOICHIOMETRY_BULK": [-2.0, -1.0, -1.0, -1.0, -3.0,
+			                            1.0, -1.0,  0.0,  0.0,  0.0,
+			                            0.0,  1.0, -1.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0, -1.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  1.0],
+			"MAL_EXPONENTS_BULK_FWD": [ 2.0,  1.0,  1.0,  1.5,  3.0,
+			                            0.0,  1.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.7,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0],
+			"MAL_EXPONENTS_BULK_BWD": [ 0.0,  0.0,  0.0,  0.0,  0.0,
+			                            1.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  1.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  2.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  1.2]
+		})json";
+
+	const char* const polymerizationLogSpaceConfig = R"json({
+			"MAL_LOG_SPACE": true,
+			"MAL_KFWD_BULK": [1.0, 2.0, 0.4, 0.7, 1.3],
+			"MAL_KBWD_BULK": [0.1, 0.2, 1.5, 0.0, 0.6],
+			"MAL_STOICHIOMETRY_BULK": [-2.0, -1.0, -1.0, -1.0, -3.0,
+			                            1.0, -1.0,  0.0,  0.0,  0.0,
+			                            0.0,  1.0, -1.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0, -1.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  1.0],
+			"MAL_EXPONENTS_BULK_FWD": [ 2.0,  1.0,  1.0,  1.5,  3.0,
+			                            0.0,  1.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.7,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0],
+			"MAL_EXPONENTS_BULK_BWD": [ 0.0,  0.0,  0.0,  0.0,  0.0,
+			                            1.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  1.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  2.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  1.2]
+		})json";
+
+	std::vector<double> bulkResidual(cadet::test::reaction::ConfiguredDynamicReactionModel& crm, double const* y)
+	{
+		std::vector<double> res(crm.nComp(), 0.0);
+		crm.model().residualLiquidAdd(1.0, 0u, cadet::ColumnPosition{0.0, 0.0, 0.0}, y, res.data(), 1.0, crm.buffer());
+		return res;
+	}
+}
+
+TEST_CASE("MassActionLaw polymerization network analytic Jacobian vs AD", "[MassActionLaw],[ReactionModel],[Jacobian],[AD]")
+{
+	const unsigned int nBound[] = {0, 0, 0, 0, 0, 0};
+	const double point[] = {1.2, 0.8, 0.5, 0.3, 0.2, 0.1};
+
+	SECTION("Direct evaluation")
+	{
+		cadet::test::reaction::testDynamicJacobianAD("MASS_ACTION_LAW", 6, nBound, polymerizationConfig, point, 1e-15, 1e-15);
+	}
+
+	SECTION("Log-space evaluation")
+	{
+		cadet::test::reaction::testDynamicJacobianAD("MASS_ACTION_LAW", 6, nBound, polymerizationLogSpaceConfig, point, 1e-12, 1e-12);
+	}
+}
+
+TEST_CASE("MassActionLaw log-space evaluation matches direct evaluation", "[MassActionLaw],[ReactionModel],[Residual]")
+{
+	const unsigned int nBound[] = {0, 0, 0, 0, 0, 0};
+	const double point[] = {1.2, 0.8, 0.5, 0.3, 0.2, 0.1};
+
+	cadet::test::reaction::ConfiguredDynamicReactionModel direct = cadet::test::reaction::ConfiguredDynamicReactionModel::create("MASS_ACTION_LAW", 6, nBound, polymerizationConfig);
+	cadet::test::reaction::ConfiguredDynamicReactionModel logSpace = cadet::test::reaction::ConfiguredDynamicReactionModel::create("MASS_ACTION_LAW", 6, nBound, polymerizationLogSpaceConfig);
+
+	const std::vector<double> resDirect = bulkResidual(direct, point);
+	const std::vector<double> resLogSpace = bulkResidual(logSpace, point);
+	for (unsigned int i = 0; i < resDirect.size(); ++i)
+	{
+		CAPTURE(i);
+		CHECK(resLogSpace[i] == Approx(resDirect[i]).epsilon(1e-12).margin(1e-14));
+	}
+
+	// Rate laws with non-positive concentrations vanish in both modes
+	const double pointZero[] = {0.0, 0.8, 0.5, 0.3, 0.2, 0.1};
+	const std::vector<double> resDirectZero = bulkResidual(direct, pointZero);
+	const std::vector<double> resLogSpaceZero = bulkResidual(logSpace, pointZero);
+	for (unsigned int i = 0; i < resDirectZero.size(); ++i)
+	{
+		CAPTURE(i);
+		CHECK(resLogSpaceZero[i] == Approx(resDirectZero[i]).epsilon(1e-12).margin(1e-14));
+	}
+}
+
+TEST_CASE("MassActionLaw participants follow parameter changes", "[MassActionLaw],[ReactionModel],[Residual]")
+{
+	const unsigned int nBound[] = {0, 0, 0, 0, 0, 0};
+	const double point[] = {1.2, 0.8, 0.5, 0.3, 0.2, 0.1};
+
+	cadet::test::reaction::ConfiguredDynamicReactionModel crm = cadet::test::reaction::ConfiguredDynamicReactionModel::create("MASS_ACTION_LAW", 6, nBound, polymerizationConfig);
+
+	// Add component 5 to the forward rate law of reaction 0 and remove component 2 from the backward rate law of reaction 1
+	const cadet::StringHash expFwd = cadet::hashString("MAL_EXPONENTS_BULK_FWD");
+	const cadet::StringHash expBwd = cadet::hashString("MAL_EXPONENTS_BULK_BWD");
+	REQUIRE(crm.model().setParameter(cadet::makeParamId(expFwd, 0, 5, 0, cadet::BoundStateIndep, 0, cadet::SectionIndep), 2.0));
+	REQUIRE(crm.model().setParameter(cadet::makeParamId(expBwd, 0, 2, 0, cadet::BoundStateIndep, 1, cadet::SectionIndep), 0.0));
+
+	// Add component 5 as product of reaction 2
+	REQUIRE(crm.model().setParameter(cadet::makeParamId(cadet::hashString("MAL_STOICHIOMETRY_BULK"), 0, 5, 0, cadet::BoundStateIndep, 2, cadet::SectionIndep), 0.5));
+
+	cadet::test::reaction::ConfiguredDynamicReactionModel ref = cadet::test::reaction::ConfiguredDynamicReactionModel::create("MASS_ACTION_LAW", 6, nBound, R"json({
+			"MAL_KFWD_BULK": [1.0, 2.0, 0.4, 0.7, 1.3],
+			"MAL_KBWD_BULK": [0.1, 0.2, 1.5, 0.0, 0.6],
+			"MAL_STOICHIOMETRY_BULK": [-2.0, -1.0, -1.0, -1.0, -3.0,
+			                            1.0, -1.0,  0.0,  0.0,  0.0,
+			                            0.0,  1.0, -1.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0, -1.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.5,  0.0,  1.0],
+			"MAL_EXPONENTS_BULK_FWD": [ 2.0,  1.0,  1.0,  1.5,  3.0,
+			                            0.0,  1.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  1.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.7,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0,
+			                            2.0,  0.0,  0.0,  0.0,  0.0],
+			"MAL_EXPONENTS_BULK_BWD": [ 0.0,  0.0,  0.0,  0.0,  0.0,
+			                            1.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  0.0,
+			                            0.0,  0.0,  2.0,  0.0,  0.0,
+			                            0.0,  0.0,  0.0,  1.0,  0.0,
+			                            0.0,  0.0,  0.0,  0.0,  1.2]
+		})json");
+
+	const std::vector<double> res = bulkResidual(crm, point);
+	const std::vector<double> resRef = bulkResidual(ref, point);
+	for (unsigned int i = 0; i < res.size(); ++i)
+	{
+		CAPTURE(i);
+		CHECK(res[i] == resRef[i]);
+	}
+}
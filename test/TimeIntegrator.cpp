@@ -0,0 +1,261 @@
+// =============================================================================
+//  CADET
+//
+//  Copyright © 2008-2024: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+#include "Approx.hpp"
+#include "cadet/cadet.hpp"
+
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#include "common/Driver.hpp"
+#include "common/JsonParameterProvider.hpp"
+
+#include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
+
+#include <cmath>
+#include <functional>
+#include <string>
+
+namespace
+{
+	inline void setTimeIntegrator(cadet::JsonParameterProvider& jpp, const std::string& method)
+	{
+		jpp.pushScope("solver");
+		jpp.pushScope("time_integrator");
+
+		jpp.set("METHOD", method);
+
+		jpp.popScope();
+		jpp.popScope();
+	}
+
+	inline void removeUserSolutionTimes(cadet::JsonParameterProvider& jpp)
+	{
+		jpp.pushScope("solver");
+		jpp.remove("USER_SOLUTION_TIMES");
+		jpp.popScope();
+	}
+
+	void runRadauSim(cadet::JsonParameterProvider& jpp, std::function<double(double)> solC, std::function<double(double)> solQ, std::function<double(double)> solV, double relTol, double absTol)
+	{
+		setTimeIntegrator(jpp, "RADAU_IIA");
+
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+
+		cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+		const unsigned int nDataPoints = simData->numDataPoints();
+		REQUIRE(nDataPoints > 0);
+
+		double const* outlet = simData->outlet();
+		double const* volume = simData->volume();
+		double const* solid = solQ ? simData->solid() : nullptr;
+		double const* time = drv.solution()->time();
+
+		for (unsigned int i = 0; i < nDataPoints; ++i, ++time, ++outlet, ++volume)
+		{
+			CAPTURE(*time);
+			CHECK((*outlet) == cadet::test::makeApprox(solC(*time), relTol, absTol));
+			CHECK((*volume) == cadet::test::makeApprox(solV(*time), relTol, absTol));
+
+			if (solQ)
+			{
+				CHECK((*solid) == cadet::test::makeApprox(solQ(*time), relTol, absTol));
+				++solid;
+			}
+		}
+	}
+
+	void compareWithIdas(cadet::JsonParameterProvider& jpp, double relTol, double absTol)
+	{
+		cadet::Driver drvRef;
+		drvRef.configure(jpp);
+		drvRef.run();
+
+		setTimeIntegrator(jpp, "RADAU_IIA");
+
+		cadet::Driver drv;
+		drv.configure(jpp);
+		drv.run();
+
+		cadet::InternalStorageUnitOpRecorder const* const simDataRef = drvRef.solution()->unitOperation(0);
+		cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+		REQUIRE(simData->numDataPoints() == simDataRef->numDataPoints());
+
+		const unsigned int nValues = simData->numDataPoints() * simData->numComponents();
+		double const* outletRef = simDataRef->outlet();
+		double const* outlet = simData->outlet();
+		for (unsigned int i = 0; i < nValues; ++i)
+		{
+			CAPTURE(i);
+			CHECK(outlet[i] == cadet::test::makeApprox(outletRef[i], relTol, absTol));
+		}
+	}
+}
+
+TEST_CASE("Radau IIA CSTR vs analytic solution (V constant) w/o binding model", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+
+	const double temp = 10.0 * (9.0 + 2.0 * std::sqrt(std::exp(1.0)));
+	const double temp2 = 2.0 / 9.0 * (-9.0 - 2.0 * std::sqrt(std::exp(1.0)) + 2 * std::exp(5));
+	runRadauSim(jpp, [=](double t) {
+			if (t <= 10.0)
+				return -2.0 * std::expm1(-t / 20.0);
+			else if (t <= 100.0)
+				return (120.0 - temp * std::exp(-t / 20.0) - t)  / 45.0;
+			else
+				return std::exp(-5.0 - (t - 100.0) / 20.0) * temp2;
+		},
+		nullptr,
+		[](double t) {
+			return 10.0;
+		}, 1e-5, 1e-8);
+}
+
+TEST_CASE("Radau IIA CSTR vs analytic solution (V increasing) w/o binding model", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 100.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 100.0});
+	cadet::test::setInitialConditions(jpp, {1.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 2.0, 1.0, 0.5);
+
+	runRadauSim(jpp, [=](double t) {
+			return 4.0 * (6000.0 + t * (1200.0 + t * (60.0 + t))) / (3.0 * std::pow(20.0 + t, 3.0));
+		},
+		nullptr,
+		[](double t) {
+			return 10.0 + 0.5 * t;
+		}, 1e-5, 1e-8);
+}
+
+TEST_CASE("Radau IIA CSTR vs analytic solution (V constant) with dynamic linear binding", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 100.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 100.0});
+	cadet::test::addBoundStates(jpp, {1}, 0.5);
+	cadet::test::setInitialConditions(jpp, {0.0}, {0.0}, 1.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 0.1, 0.1, 0.0);
+	cadet::test::addLinearBindingModel(jpp, true, {0.1}, {10.0});
+
+	const double sqrt2501 = std::sqrt(2501.0);
+	runRadauSim(jpp, [=](double t) {
+			return 1.0 - std::exp(-5.1 * t) * (2501.0 * std::cosh(sqrt2501 * t / 10.0) + 50.0 * sqrt2501 * std::sinh(sqrt2501 * t / 10.0)) / 2501.0;
+		},
+		[=](double t) {
+			return 0.01 - std::exp(-5.1 * t) * (2501.0 * std::cosh(sqrt2501 * t / 10.0) + 51.0 * sqrt2501 * std::sinh(sqrt2501 * t / 10.0)) / 250100.0;
+		},
+		[](double t) {
+			return 1.0;
+		}, 1e-5, 1e-8);
+}
+
+TEST_CASE("Radau IIA CSTR vs analytic solution (V constant) with quasi-stationary linear binding", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 100.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 100.0});
+	cadet::test::addBoundStates(jpp, {1}, 0.5);
+	cadet::test::setInitialConditions(jpp, {0.0}, {0.0}, 1.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 0.1, 0.1, 0.0);
+	cadet::test::addLinearBindingModel(jpp, false, {0.1}, {10.0});
+
+	runRadauSim(jpp, [=](double t) {
+			return -std::expm1(-10.0 / 101.0 * t);
+		},
+		[=](double t) {
+			return -std::expm1(-10.0 / 101.0 * t) * 0.01;
+		},
+		[](double t) {
+			return 1.0;
+		}, 1e-5, 1e-8);
+}
+
+TEST_CASE("Radau IIA CSTR with many short sections vs IDAS", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	// Pulses of alternating concentration restart the integrator frequently
+	const unsigned int nSec = 20;
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(nSec, 100.0, 0.5);
+
+	std::vector<double> secTimes(nSec + 1, 0.0);
+	for (unsigned int i = 0; i <= nSec; ++i)
+		secTimes[i] = 100.0 * static_cast<double>(i) / static_cast<double>(nSec);
+
+	cadet::test::setSectionTimes(jpp, secTimes);
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 1.0);
+	for (unsigned int i = 0; i < nSec; ++i)
+	{
+		cadet::test::setInletProfile(jpp, i, 0, (i % 2 == 0) ? 1.0 : 0.0, 0.0, 0.0, 0.0);
+		cadet::test::setFlowRates(jpp, i, 0.5, 0.5, 0.0);
+	}
+
+	compareWithIdas(jpp, 1e-4, 1e-6);
+}
+
+TEST_CASE("Radau IIA CSTR without user solution times", "[TimeIntegrator],[CSTR],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(2, 100.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 50.0, 100.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 1.0, 0.0);
+	removeUserSolutionTimes(jpp);
+	setTimeIntegrator(jpp, "RADAU_IIA");
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	const unsigned int nDataPoints = simData->numDataPoints();
+	REQUIRE(nDataPoints > 2);
+
+	double const* outlet = simData->outlet();
+	double const* time = drv.solution()->time();
+
+	// Internal time steps are strictly increasing and cover the whole time domain
+	CHECK(time[0] == 0.0);
+	CHECK(time[nDataPoints - 1] == cadet::test::makeApprox(100.0, 1e-12, 1e-12));
+	for (unsigned int i = 1; i < nDataPoints; ++i)
+		CHECK(time[i] > time[i-1]);
+
+	const double c50 = -std::expm1(-5.0);
+	for (unsigned int i = 0; i < nDataPoints; ++i)
+	{
+		const double t = time[i];
+		const double ref = (t <= 50.0) ? -std::expm1(-t / 10.0) : c50 * std::exp(-(t - 50.0) / 10.0);
+
+		CAPTURE(t);
+		CHECK(outlet[i] == cadet::test::makeApprox(ref, 1e-5, 1e-8));
+	}
+}
+
+TEST_CASE("Radau IIA LRM with SMA binding vs IDAS", "[TimeIntegrator],[LRM],[Simulation]")
+{
+	cadet::JsonParameterProvider jpp = createLWE("LUMPED_RATE_MODEL_WITHOUT_PORES");
+	compareWithIdas(jpp, 1e-3, 1e-5);
+}
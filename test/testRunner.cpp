@@ -22,6 +22,10 @@
 	#endif
 #endif
 
+#ifdef CADET_MPI
+	#include <mpi.h>
+#endif
+
 
 // Uncomment the next line to enable logging output of CADET in unit tests
 //#define CADETTEST_ENABLE_LOG
@@ -84,7 +88,17 @@ int main(int argc, char* argv[])
 	#endif
 #endif
 
+#ifdef CADET_MPI
+	// Tests of distributed execution are run with mpirun
+	MPI_Init(&argc, &argv);
+#endif
+
 	// Run tests
 	const int result = session.run();
+
+#ifdef CADET_MPI
+	MPI_Finalize();
+#endif
+
 	return result;
 }